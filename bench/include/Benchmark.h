@@ -0,0 +1,101 @@
+#pragma once
+
+// Marco mínimo de benchmarks para engine_bench.
+// Cada benchmark ejecuta una "muestra" por llamada a Run, que devuelve cuántos elementos procesó.
+// El runner repite muestras hasta cubrir un tiempo mínimo y resume sus duraciones
+// (media, mediana, p99) y el rendimiento en elementos por segundo. Los resultados se escriben
+// en JSON para comparar entre commits.
+
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <utility>
+#include <vector>
+
+struct BenchmarkResult;
+
+struct Benchmark
+{
+    std::string Name;
+    // Necesita un contexto de OpenGL; se omite con --no-gl o si no se pudo crear la ventana
+    bool RequiresGL{};
+    // Límite propio de muestras (0 = el de las opciones), para benchmarks caros o que acumulan memoria
+    size_t MaxSamples{};
+
+    std::function<void()> Setup;
+    std::function<uint64_t()> Run;
+    std::function<void()> Teardown;
+    // Opcional: se llama tras medir y antes de Teardown para añadir contadores al resultado
+    // y comprobar presupuestos (cada fallo hace que engine_bench termine con error)
+    std::function<void(BenchmarkResult&)> Finish{};
+};
+
+struct BenchmarkResult
+{
+    std::string Name;
+    size_t Samples{};
+    uint64_t Items{};
+    double MeanNs{};
+    double MedianNs{};
+    double P99Ns{};
+    double MinNs{};
+    double MaxNs{};
+    double ItemsPerSecond{};
+
+    std::vector<std::pair<std::string, double>> Counters;
+    std::vector<std::string> Failures;
+};
+
+struct BenchmarkOptions
+{
+    // Solo se ejecutan los benchmarks cuyo nombre contiene este texto
+    std::string Filter;
+    double MinTimeSeconds = 0.5;
+    size_t MinSamples = 10;
+    size_t MaxSamples = 100000;
+    size_t WarmupSamples = 3;
+};
+
+struct BenchmarkReport
+{
+    std::string Label;
+    std::string GLVendor;
+    std::string GLRenderer;
+    bool Profiling{};
+    BenchmarkOptions Options;
+    std::vector<BenchmarkResult> Results;
+};
+
+class BenchmarkRunner
+{
+public:
+    static void Add(Benchmark benchmark);
+    static const std::vector<Benchmark>& GetBenchmarks() { return s_Benchmarks; }
+
+    static std::vector<BenchmarkResult> Run(const BenchmarkOptions& options, bool hasGL);
+
+    static void Print(const BenchmarkResult& result);
+    static bool WriteJSON(const std::string& path, const BenchmarkReport& report);
+
+private:
+    static BenchmarkResult Measure(const Benchmark& benchmark, const BenchmarkOptions& options);
+
+    static std::vector<Benchmark> s_Benchmarks;
+};
+
+// Impide que el compilador elimine un cálculo cuyo resultado no se usa
+template<typename T>
+inline void DoNotOptimize(const T& value)
+{
+#if defined(__GNUC__) || defined(__clang__)
+    asm volatile("" : : "g"(&value) : "memory");
+#else
+    static const void* volatile sink;
+    sink = &value;
+#endif
+}
+
+void RegisterMicroBenchmarks();
+void RegisterSceneBenchmarks();
+// Reproduce una captura de RenderCapture por muestra ("replay/<archivo>")
+void RegisterReplayBenchmark(const std::string& path);
@@ -0,0 +1,197 @@
+#include "Benchmark.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <ctime>
+#include <fstream>
+#include <iostream>
+
+std::vector<Benchmark> BenchmarkRunner::s_Benchmarks;
+
+namespace
+{
+    using Clock = std::chrono::steady_clock;
+
+    void WriteString(std::ofstream& file, const std::string& text)
+    {
+        file << '"';
+        for (char c : text)
+        {
+            if (c == '"' || c == '\\')
+                file << '\\' << c;
+            else if (static_cast<unsigned char>(c) < 0x20)
+                file << ' ';
+            else
+                file << c;
+        }
+        file << '"';
+    }
+
+    std::string UTCTimestamp()
+    {
+        const std::time_t now = std::time(nullptr);
+        std::tm utc{};
+#ifdef _WIN32
+        gmtime_s(&utc, &now);
+#else
+        gmtime_r(&now, &utc);
+#endif
+        char buffer[32];
+        std::strftime(buffer, sizeof(buffer), "%Y-%m-%dT%H:%M:%SZ", &utc);
+        return buffer;
+    }
+}
+
+void BenchmarkRunner::Add(Benchmark benchmark)
+{
+    s_Benchmarks.push_back(std::move(benchmark));
+}
+
+BenchmarkResult BenchmarkRunner::Measure(const Benchmark& benchmark, const BenchmarkOptions& options)
+{
+    const size_t maxSamples = benchmark.MaxSamples ? std::min(benchmark.MaxSamples, options.MaxSamples) : options.MaxSamples;
+
+    for (size_t i = 0; i < options.WarmupSamples; i++)
+        benchmark.Run();
+
+    std::vector<double> durations;
+    uint64_t items = 0;
+    double elapsed = 0.0;
+
+    while (durations.size() < maxSamples && (elapsed < options.MinTimeSeconds || durations.size() < options.MinSamples))
+    {
+        const Clock::time_point start = Clock::now();
+        items += benchmark.Run();
+        const double nanoseconds = std::chrono::duration<double, std::nano>(Clock::now() - start).count();
+
+        durations.push_back(nanoseconds);
+        elapsed += nanoseconds * 1e-9;
+    }
+
+    BenchmarkResult result;
+    result.Name = benchmark.Name;
+    result.Samples = durations.size();
+    result.Items = items;
+    if (durations.empty())
+        return result;
+
+    std::sort(durations.begin(), durations.end());
+    const size_t count = durations.size();
+
+    double total = 0.0;
+    for (double duration : durations)
+        total += duration;
+
+    result.MeanNs = total / static_cast<double>(count);
+    result.MedianNs = count % 2 ? durations[count / 2] : 0.5 * (durations[count / 2 - 1] + durations[count / 2]);
+    // Percentil por rango más cercano
+    const size_t p99 = static_cast<size_t>(std::ceil(0.99 * static_cast<double>(count)));
+    result.P99Ns = durations[std::max<size_t>(p99, 1) - 1];
+    result.MinNs = durations.front();
+    result.MaxNs = durations.back();
+    result.ItemsPerSecond = total > 0.0 ? static_cast<double>(items) / (total * 1e-9) : 0.0;
+    return result;
+}
+
+std::vector<BenchmarkResult> BenchmarkRunner::Run(const BenchmarkOptions& options, bool hasGL)
+{
+    std::vector<BenchmarkResult> results;
+    for (const Benchmark& benchmark : s_Benchmarks)
+    {
+        if (!options.Filter.empty() && benchmark.Name.find(options.Filter) == std::string::npos)
+            continue;
+        if (benchmark.RequiresGL && !hasGL)
+        {
+            std::cout << "Skipping " << benchmark.Name << " (no OpenGL context)" << std::endl;
+            continue;
+        }
+
+        if (benchmark.Setup)
+            benchmark.Setup();
+        results.push_back(Measure(benchmark, options));
+        if (benchmark.Finish)
+            benchmark.Finish(results.back());
+        if (benchmark.Teardown)
+            benchmark.Teardown();
+
+        Print(results.back());
+    }
+    return results;
+}
+
+void BenchmarkRunner::Print(const BenchmarkResult& result)
+{
+    std::printf("%-40s %8zu samples  mean %12.1f ns  median %12.1f ns  p99 %12.1f ns  %14.1f items/s\n",
+                result.Name.c_str(), result.Samples, result.MeanNs, result.MedianNs, result.P99Ns, result.ItemsPerSecond);
+    for (const std::string& failure : result.Failures)
+        std::printf("    FAILED %s\n", failure.c_str());
+}
+
+bool BenchmarkRunner::WriteJSON(const std::string& path, const BenchmarkReport& report)
+{
+    std::ofstream file(path);
+    if (!file.is_open())
+    {
+        std::cerr << "Failed to write benchmark results: " << path << std::endl;
+        return false;
+    }
+
+    file.precision(3);
+    file << std::fixed;
+
+    file << "{\n  \"suite\": \"engine_bench\",\n  \"timestamp\": ";
+    WriteString(file, UTCTimestamp());
+    file << ",\n  \"label\": ";
+    WriteString(file, report.Label);
+    file << ",\n  \"profiling\": " << (report.Profiling ? "true" : "false");
+    file << ",\n  \"gl\": {\"vendor\": ";
+    WriteString(file, report.GLVendor);
+    file << ", \"renderer\": ";
+    WriteString(file, report.GLRenderer);
+    file << "},\n  \"options\": {\"min_time_s\": " << report.Options.MinTimeSeconds
+         << ", \"min_samples\": " << report.Options.MinSamples
+         << ", \"warmup_samples\": " << report.Options.WarmupSamples << "},\n";
+
+    file << "  \"benchmarks\": [";
+    for (size_t i = 0; i < report.Results.size(); i++)
+    {
+        const BenchmarkResult& result = report.Results[i];
+        file << (i ? ",\n" : "\n") << "    {\"name\": ";
+        WriteString(file, result.Name);
+        file << ", \"samples\": " << result.Samples
+             << ", \"items\": " << result.Items
+             << ", \"mean_ns\": " << result.MeanNs
+             << ", \"median_ns\": " << result.MedianNs
+             << ", \"p99_ns\": " << result.P99Ns
+             << ", \"min_ns\": " << result.MinNs
+             << ", \"max_ns\": " << result.MaxNs
+             << ", \"items_per_second\": " << result.ItemsPerSecond;
+
+        if (!result.Counters.empty())
+        {
+            file << ", \"counters\": {";
+            for (size_t c = 0; c < result.Counters.size(); c++)
+            {
+                file << (c ? ", " : "");
+                WriteString(file, result.Counters[c].first);
+                file << ": " << result.Counters[c].second;
+            }
+            file << "}";
+        }
+        if (!result.Failures.empty())
+        {
+            file << ", \"failures\": [";
+            for (size_t f = 0; f < result.Failures.size(); f++)
+            {
+                file << (f ? ", " : "");
+                WriteString(file, result.Failures[f]);
+            }
+            file << "]";
+        }
+        file << "}";
+    }
+    file << "\n  ]\n}\n";
+    return true;
+}
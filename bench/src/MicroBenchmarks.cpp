@@ -0,0 +1,272 @@
+#include "Benchmark.h"
+
+#include <algorithm>
+#include <cmath>
+#include <memory>
+#include <random>
+
+#include <glm/gtc/constants.hpp>
+
+#include "Renderer.h"
+
+// Microbenchmarks de las operaciones que el renderizador repite por objeto y por frame
+namespace
+{
+    constexpr size_t SceneSize = 1000;
+    constexpr size_t LookupCount = 256;
+    constexpr size_t SortCount = 10000;
+    constexpr size_t UniformLookupCount = 1024;
+
+    std::vector<std::string> MakeNames(size_t count)
+    {
+        std::vector<std::string> names;
+        names.reserve(count);
+        for (size_t i = 0; i < count; i++)
+            names.push_back("Cube " + std::to_string(i));
+        return names;
+    }
+
+    // Esfera UV con normales y UV, suficiente para generar cientos de meshlets
+    MeshData MakeSphere(unsigned int rings, unsigned int segments)
+    {
+        MeshData mesh;
+        mesh.Name = "Sphere";
+        for (unsigned int ring = 0; ring <= rings; ring++)
+        {
+            const float v = static_cast<float>(ring) / static_cast<float>(rings);
+            const float phi = v * glm::pi<float>();
+            for (unsigned int segment = 0; segment <= segments; segment++)
+            {
+                const float u = static_cast<float>(segment) / static_cast<float>(segments);
+                const float theta = u * glm::two_pi<float>();
+                const glm::vec3 normal(std::sin(phi) * std::cos(theta), std::cos(phi), std::sin(phi) * std::sin(theta));
+                mesh.Vertices.push_back({ normal, glm::vec3(1.0f), normal, glm::vec2(u, v) });
+            }
+        }
+        for (unsigned int ring = 0; ring < rings; ring++)
+        {
+            for (unsigned int segment = 0; segment < segments; segment++)
+            {
+                const unsigned int a = ring * (segments + 1) + segment;
+                const unsigned int b = a + segments + 1;
+                mesh.Indices.insert(mesh.Indices.end(), { a, b, a + 1, a + 1, b, b + 1 });
+            }
+        }
+        return mesh;
+    }
+
+    struct DrawItem
+    {
+        uint64_t Key;
+        uint32_t Index;
+    };
+
+    // Clave de orden típica: LOD en los bits altos y profundidad cuantizada de delante hacia atrás
+    uint64_t MakeSortKey(unsigned int lod, float depth)
+    {
+        const auto quantizedDepth = static_cast<uint64_t>(std::clamp(depth / 1000.0f, 0.0f, 1.0f) * 16777215.0f);
+        return (static_cast<uint64_t>(lod) << 24) | quantizedDepth;
+    }
+
+    void RegisterSceneInsertion()
+    {
+        auto names = std::make_shared<std::vector<std::string>>(MakeNames(SceneSize));
+
+        BenchmarkRunner::Add({ "scene/add_cubes/1000", false, 0, nullptr, [names]
+        {
+            Scene scene;
+            for (const std::string& name : *names)
+                scene.AddCube(std::make_shared<Cube>(name));
+            DoNotOptimize(scene.GetCubes().size());
+            return static_cast<uint64_t>(names->size());
+        }, nullptr });
+    }
+
+    void RegisterSceneLookup()
+    {
+        struct State
+        {
+            Scene Objects;
+            std::vector<std::string> Queries;
+        };
+        auto state = std::make_shared<State>();
+
+        BenchmarkRunner::Add({ "scene/lookup_by_name/1000", false, 0, [state]
+        {
+            const std::vector<std::string> names = MakeNames(SceneSize);
+            for (const std::string& name : names)
+                state->Objects.AddCube(std::make_shared<Cube>(name));
+
+            std::mt19937 random(42);
+            std::uniform_int_distribution<size_t> pick(0, names.size() - 1);
+            for (size_t i = 0; i < LookupCount; i++)
+                state->Queries.push_back(names[pick(random)]);
+        }, [state]
+        {
+            for (const std::string& query : state->Queries)
+                DoNotOptimize(state->Objects.GetCubeByName(query));
+            return static_cast<uint64_t>(state->Queries.size());
+        }, nullptr });
+    }
+
+    void RegisterTransforms()
+    {
+        auto cubes = std::make_shared<std::vector<std::shared_ptr<Cube>>>();
+
+        BenchmarkRunner::Add({ "transform/model_matrix/1000", false, 0, [cubes]
+        {
+            std::mt19937 random(7);
+            std::uniform_real_distribution<float> position(-50.0f, 50.0f);
+            std::uniform_real_distribution<float> angle(0.0f, 360.0f);
+            for (size_t i = 0; i < SceneSize; i++)
+            {
+                auto cube = std::make_shared<Cube>("Cube");
+                cube->SetPosition({ position(random), position(random), position(random) });
+                cube->SetRotation({ angle(random), angle(random), 0.0f });
+                cube->SetScale(glm::vec3(0.5f));
+                cubes->push_back(cube);
+            }
+        }, [cubes]
+        {
+            // Igual que el bucle de Renderer::Render: calcula la matriz, la usa y la restablece
+            for (const auto& cube : *cubes)
+            {
+                cube->Draw();
+                DoNotOptimize(*cube->GetModelMatrix());
+                *cube->GetModelMatrix() = glm::mat4(1.0f);
+            }
+            return static_cast<uint64_t>(cubes->size());
+        }, nullptr });
+    }
+
+    void RegisterMeshlets()
+    {
+        struct State
+        {
+            MeshData Mesh;
+            MeshletDrawList DrawList;
+            glm::mat4 ViewProjection{1.0f};
+        };
+        auto state = std::make_shared<State>();
+
+        auto setup = [state]
+        {
+            if (!state->Mesh.Vertices.empty())
+                return;
+            state->Mesh = MakeSphere(128, 256);
+            state->Mesh.Meshlets = MeshletBuilder::Build(state->Mesh.Vertices, state->Mesh.Indices, 0, static_cast<unsigned int>(state->Mesh.Indices.size()));
+
+            const glm::mat4 view = glm::lookAt(glm::vec3(0.0f, 0.0f, 3.0f), glm::vec3(0.5f, 0.0f, 0.0f), glm::vec3(0.0f, 1.0f, 0.0f));
+            state->ViewProjection = glm::perspective(glm::radians(45.0f), 16.0f / 9.0f, 0.1f, 100.0f) * view;
+        };
+
+        BenchmarkRunner::Add({ "mesh/meshlet_build/sphere", false, 0, setup, [state]
+        {
+            const auto meshlets = MeshletBuilder::Build(state->Mesh.Vertices, state->Mesh.Indices, 0, static_cast<unsigned int>(state->Mesh.Indices.size()));
+            DoNotOptimize(meshlets.data());
+            return static_cast<uint64_t>(state->Mesh.Indices.size() / 3);
+        }, nullptr });
+
+        BenchmarkRunner::Add({ "culling/meshlets/sphere", false, 0, setup, [state]
+        {
+            MeshletCuller::Cull(state->Mesh.Meshlets, glm::mat4(1.0f), state->ViewProjection, glm::vec3(0.0f, 0.0f, 3.0f), state->DrawList);
+            DoNotOptimize(state->DrawList.Counts.data());
+            return static_cast<uint64_t>(state->Mesh.Meshlets.size());
+        }, nullptr });
+    }
+
+    void RegisterSorting()
+    {
+        struct State
+        {
+            std::vector<DrawItem> Source;
+            std::vector<DrawItem> Items;
+        };
+        auto state = std::make_shared<State>();
+
+        BenchmarkRunner::Add({ "sort/draw_items/10000", false, 0, [state]
+        {
+            std::mt19937 random(1234);
+            std::uniform_int_distribution<unsigned int> lod(0, MeshOptimizer::MaxLODCount - 1);
+            std::uniform_real_distribution<float> depth(0.1f, 500.0f);
+            for (uint32_t i = 0; i < SortCount; i++)
+                state->Source.push_back({ MakeSortKey(lod(random), depth(random)), i });
+            state->Items.reserve(SortCount);
+        }, [state]
+        {
+            state->Items.assign(state->Source.begin(), state->Source.end());
+            std::sort(state->Items.begin(), state->Items.end(), [](const DrawItem& a, const DrawItem& b) { return a.Key < b.Key; });
+            DoNotOptimize(state->Items.data());
+            return static_cast<uint64_t>(state->Items.size());
+        }, nullptr });
+    }
+
+    void RegisterUniformLookup()
+    {
+        static const std::vector<std::string> uniforms = { "model", "view", "projection", "color", "useTexture", "diffuseTexture" };
+
+        // Caché de Shader (unordered_map por nombre), como lo usa el renderizador cada frame
+        BenchmarkRunner::Add({ "shader/uniform_lookup/cached", true, 0, []
+        {
+            Renderer::GetData().m_Shader->Use();
+        }, []
+        {
+            Shader& shader = *Renderer::GetData().m_Shader;
+            for (size_t i = 0; i < UniformLookupCount; i++)
+                DoNotOptimize(shader.GetUniformLocation(uniforms[i % uniforms.size()]));
+            return static_cast<uint64_t>(UniformLookupCount);
+        }, nullptr });
+
+        // Referencia: consulta directa al driver en cada llamada
+        BenchmarkRunner::Add({ "shader/uniform_lookup/driver", true, 0, []
+        {
+            Renderer::GetData().m_Shader->Use();
+        }, []
+        {
+            GLint program = 0;
+            glGetIntegerv(GL_CURRENT_PROGRAM, &program);
+            for (size_t i = 0; i < UniformLookupCount; i++)
+                DoNotOptimize(glGetUniformLocation(static_cast<GLuint>(program), uniforms[i % uniforms.size()].c_str()));
+            return static_cast<uint64_t>(UniformLookupCount);
+        }, nullptr });
+    }
+
+    void RegisterBufferUpload(const std::string& name, size_t bytes)
+    {
+        struct State
+        {
+            std::unique_ptr<VertexBuffer> Buffer;
+            std::vector<unsigned char> Data;
+        };
+        auto state = std::make_shared<State>();
+
+        // glFinish incluye la copia real al driver/GPU en la medida, no solo la llamada
+        BenchmarkRunner::Add({ name, true, 0, [state, bytes]
+        {
+            state->Buffer = std::make_unique<VertexBuffer>();
+            state->Data.assign(bytes, 0x5a);
+        }, [state]
+        {
+            state->Buffer->SetData(static_cast<int>(state->Data.size()), state->Data.data());
+            glFinish();
+            return static_cast<uint64_t>(state->Data.size());
+        }, [state]
+        {
+            state->Buffer.reset();
+            state->Data = {};
+        } });
+    }
+}
+
+void RegisterMicroBenchmarks()
+{
+    RegisterSceneInsertion();
+    RegisterSceneLookup();
+    RegisterTransforms();
+    RegisterMeshlets();
+    RegisterSorting();
+    RegisterUniformLookup();
+    RegisterBufferUpload("buffer/upload/64KiB", 64 * 1024);
+    RegisterBufferUpload("buffer/upload/1MiB", 1024 * 1024);
+    RegisterBufferUpload("buffer/upload/16MiB", 16 * 1024 * 1024);
+}
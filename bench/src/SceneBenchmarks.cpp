@@ -0,0 +1,119 @@
+#include "Benchmark.h"
+
+#include <cmath>
+#include <memory>
+
+#include "Renderer.h"
+#include "RenderReplay.h"
+
+// Benchmarks de frame completo: Renderer::Render sobre escenas de N cubos en el FBO de una ventana oculta.
+// Cada muestra es un frame con glFinish al final, así que mide CPU y GPU juntas.
+// Al terminar se comprueban los contadores de RenderStats del último frame contra un presupuesto
+// proporcional al número de cubos: un draw call y un cambio de VAO por objeto como mucho.
+namespace
+{
+    void RegisterRenderScene(size_t cubeCount)
+    {
+        struct State
+        {
+            Scene* Original = nullptr;
+            Scene* Bench = nullptr;
+        };
+        auto state = std::make_shared<State>();
+
+        BenchmarkRunner::Add({ "render/cubes/" + std::to_string(cubeCount), true, 0, [state, cubeCount]
+        {
+            // Rejilla cúbica delante de la cámara inicial (0, 0, 3), que mira hacia -Z
+            const auto side = static_cast<size_t>(std::ceil(std::cbrt(static_cast<double>(cubeCount))));
+            const float spacing = 1.5f;
+            const float offset = 0.5f * spacing * static_cast<float>(side - 1);
+
+            state->Bench = new Scene();
+            for (size_t i = 0; i < cubeCount; i++)
+            {
+                const size_t x = i % side, y = (i / side) % side, z = i / (side * side);
+                auto cube = std::make_shared<Cube>("Cube " + std::to_string(i));
+                cube->SetPosition({ static_cast<float>(x) * spacing - offset, static_cast<float>(y) * spacing - offset, -2.0f - static_cast<float>(z) * spacing });
+                cube->SetScale(glm::vec3(0.5f));
+                state->Bench->AddCube(cube);
+            }
+
+            RendererData& data = Renderer::GetData();
+            state->Original = data.m_Scene;
+            data.m_Scene = state->Bench;
+        }, []
+        {
+            // Mismo orden que Editor::Run para que el profiler vacíe sus búferes en cada frame
+            PROFILE_FRAME_BEGIN();
+            PROFILE_GPU_FRAME_BEGIN();
+            Renderer::Render();
+            PROFILE_GPU_FRAME_END();
+            glFinish();
+            PROFILE_FRAME_END();
+            return static_cast<uint64_t>(Renderer::GetData().m_Scene->GetCubes().size());
+        }, [state]
+        {
+            Renderer::GetData().m_Scene = state->Original;
+            delete state->Bench;
+            state->Bench = nullptr;
+        }, [cubeCount](BenchmarkResult& result)
+        {
+            const RenderStats& stats = RenderCounters::GetLastFrame();
+
+            uint64_t stateChanges = 0;
+            for (uint32_t binds : stats.Binds)
+                stateChanges += binds;
+            const uint64_t uploadBytes = stats.UniformBytes + stats.BufferUploadBytes + stats.TextureUploadBytes;
+
+            result.Counters = {
+                { "draw_calls", stats.DrawCalls },
+                { "triangles", static_cast<double>(stats.Triangles) },
+                { "state_changes", static_cast<double>(stateChanges) },
+                { "upload_bytes", static_cast<double>(uploadBytes) },
+                { "fbo_switches", stats.GetFrameBufferSwitches() },
+            };
+
+            const Mesh& mesh = *Renderer::GetData().m_Mesh;
+            const uint64_t meshTriangles = mesh.GetData().LODs.empty() ? 0 : mesh.GetData().LODs[0].IndexCount / 3;
+            const auto objects = static_cast<uint32_t>(cubeCount);
+
+            RenderBudget budget;
+            budget.MaxDrawCalls = objects;
+            budget.MaxTriangles = meshTriangles * cubeCount;
+            // VAO por objeto más shader, textura y el FBO de entrada y salida
+            budget.MaxStateChanges = objects + 8;
+            // Matriz de modelo y color por objeto; el margen cubre la cámara y el streaming de mips
+            budget.MaxUploadBytes = cubeCount * (sizeof(glm::mat4) + sizeof(glm::vec3)) + 64 * 1024;
+            budget.MaxFrameBufferSwitches = 2;
+            result.Failures = RenderCounters::CheckBudget(stats, budget);
+        } });
+    }
+}
+
+void RegisterReplayBenchmark(const std::string& path)
+{
+    // Mismo trabajo de GPU en cada commit: la captura no depende de la escena ni del renderizador actual
+    auto replay = std::make_shared<RenderReplay>();
+    const std::string name = path.substr(path.find_last_of("/\\") + 1);
+
+    BenchmarkRunner::Add({ "replay/" + name, true, 0, [replay, path]
+    {
+        // La primera pasada crea los recursos; las muestras solo miden los frames
+        if (replay->Load(path))
+            replay->Run();
+    }, [replay]
+    {
+        return static_cast<uint64_t>(replay->Run().size());
+    }, [replay]
+    {
+        replay->Shutdown();
+    } });
+}
+
+void RegisterSceneBenchmarks()
+{
+    RegisterRenderScene(1);
+    RegisterRenderScene(100);
+    RegisterRenderScene(1000);
+    RegisterRenderScene(5000);
+}
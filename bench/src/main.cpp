@@ -0,0 +1,120 @@
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <memory>
+
+#include "Benchmark.h"
+#include "Engine.h"
+
+namespace
+{
+    void PrintUsage()
+    {
+        std::cout << "Usage: engine_bench [options]\n"
+                     "  --filter <text>     run only benchmarks whose name contains <text>\n"
+                     "  --out <file>        write results as JSON\n"
+                     "  --label <text>      label stored in the JSON (e.g. the commit hash)\n"
+                     "  --min-time <secs>   minimum measured time per benchmark (default 0.5)\n"
+                     "  --no-gl             skip benchmarks that need an OpenGL context\n"
+                     "  --headless          use an EGL context instead of a hidden window\n"
+                     "  --replay <file>     also benchmark replaying a render capture\n"
+                     "  --list              list benchmarks and exit\n";
+    }
+}
+
+int main(int argc, char** argv)
+{
+    BenchmarkOptions options;
+    std::string outPath;
+    std::string label;
+    std::string replayPath;
+    bool useGL = true;
+    bool headless = false;
+    bool list = false;
+
+    for (int i = 1; i < argc; i++)
+    {
+        const bool hasValue = i + 1 < argc;
+        if (std::strcmp(argv[i], "--filter") == 0 && hasValue)
+            options.Filter = argv[++i];
+        else if (std::strcmp(argv[i], "--out") == 0 && hasValue)
+            outPath = argv[++i];
+        else if (std::strcmp(argv[i], "--label") == 0 && hasValue)
+            label = argv[++i];
+        else if (std::strcmp(argv[i], "--min-time") == 0 && hasValue)
+            options.MinTimeSeconds = std::atof(argv[++i]);
+        else if (std::strcmp(argv[i], "--no-gl") == 0)
+            useGL = false;
+        else if (std::strcmp(argv[i], "--replay") == 0 && hasValue)
+            replayPath = argv[++i];
+        else if (std::strcmp(argv[i], "--headless") == 0)
+            headless = true;
+        else if (std::strcmp(argv[i], "--list") == 0)
+            list = true;
+        else
+        {
+            PrintUsage();
+            return std::strcmp(argv[i], "--help") == 0 ? 0 : 1;
+        }
+    }
+
+    RegisterMicroBenchmarks();
+    RegisterSceneBenchmarks();
+    if (!replayPath.empty())
+        RegisterReplayBenchmark(replayPath);
+
+    if (list)
+    {
+        for (const Benchmark& benchmark : BenchmarkRunner::GetBenchmarks())
+            std::cout << benchmark.Name << (benchmark.RequiresGL ? " (gl)" : "") << std::endl;
+        return 0;
+    }
+
+    BenchmarkReport report;
+    report.Label = label;
+    report.Options = options;
+#ifdef FERX_PROFILING
+    report.Profiling = true;
+#endif
+
+    // El motor con una ventana oculta (o un contexto EGL) aporta el contexto, los shaders y el FBO del renderizador
+    std::unique_ptr<Engine> engine;
+    if (useGL)
+    {
+        WindowData windowData("Ferx Bench", 1280, 720);
+        windowData.Visible = false;
+        windowData.Headless = headless;
+        engine = std::make_unique<Engine>(windowData);
+        if (!engine->IsInitialized())
+            engine.reset();
+    }
+
+    if (engine)
+    {
+        report.GLVendor = reinterpret_cast<const char*>(glGetString(GL_VENDOR));
+        report.GLRenderer = reinterpret_cast<const char*>(glGetString(GL_RENDERER));
+        std::cout << "OpenGL: " << report.GLRenderer << " (" << report.GLVendor << ")" << std::endl;
+    }
+    else if (useGL)
+    {
+        std::cerr << "Failed to create an OpenGL context, running CPU benchmarks only" << std::endl;
+    }
+
+    report.Results = BenchmarkRunner::Run(options, engine != nullptr);
+
+    engine.reset();
+
+    if (!outPath.empty() && !BenchmarkRunner::WriteJSON(outPath, report))
+        return 1;
+
+    // Un presupuesto superado (p. ej. draw calls de más) rompe la CI aunque los tiempos sean buenos
+    size_t failures = 0;
+    for (const BenchmarkResult& result : report.Results)
+        failures += result.Failures.size();
+    if (failures > 0)
+    {
+        std::cerr << failures << " benchmark budget check(s) failed" << std::endl;
+        return 1;
+    }
+    return 0;
+}
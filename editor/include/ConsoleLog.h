@@ -0,0 +1,72 @@
+#pragma once
+
+#include "Log.h"
+
+#include <imgui.h>
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <vector>
+
+struct LogEntry
+{
+    // Número de la entrada desde el arranque; la posición en el anillo es Sequence % Capacity
+    uint64_t Sequence{};
+    LogSeverity Severity = LogSeverity::Info;
+    uint16_t Category{};
+    // Segundos desde el arranque (LogMessage::Time)
+    double Time{};
+    std::string Message;
+};
+
+// Mensajes del panel Console. Es un anillo de tamaño fijo: al llenarse, cada mensaje nuevo
+// sustituye al más antiguo y reutiliza su texto, así que la memoria deja de crecer. Las categorías
+// se guardan una sola vez (Intern) y las entradas llevan su índice.
+// El panel solo dibuja las líneas visibles (ImGuiListClipper); con filtros activos guarda la lista
+// de entradas que pasan y solo comprueba las nuevas, sin recorrer el anillo en cada frame.
+// Los mensajes llegan del registro del motor (Log) en su hilo de fondo; Draw solo desde el de la GUI.
+class ConsoleLog
+{
+public:
+    static constexpr size_t Capacity = 4096;
+
+    static void Add(const LogMessage& message);
+    static void Clear();
+
+    // Barra de filtros y líneas dentro de la ventana actual
+    static void Draw();
+
+    static size_t GetCount();
+    // Mensajes sustituidos al llenarse el anillo
+    static uint64_t GetDropped();
+
+private:
+    // Lo que sigue, con s_Mutex tomado
+    static uint16_t Intern(std::string_view category);
+    // Primera entrada que sigue en el anillo y no se ha borrado con Clear
+    static uint64_t GetOldest();
+    static bool PassesFilter(const LogEntry& entry);
+    static void RebuildFiltered();
+    static void UpdateFiltered();
+    static void DrawEntry(const LogEntry& entry);
+
+    static std::mutex s_Mutex;
+    static std::vector<LogEntry> s_Entries;
+    // Siguiente número de secuencia; las entradas válidas son [s_Next - tamaño, s_Next)
+    static uint64_t s_Next;
+    static uint64_t s_Cleared;
+    static std::vector<std::string> s_Categories;
+
+    // Filtros del panel y entradas que los pasan, en orden
+    static std::array<bool, static_cast<size_t>(LogSeverity::Count)> s_ShowSeverity;
+    static int s_CategoryFilter;
+    static ImGuiTextFilter s_TextFilter;
+    static std::deque<uint64_t> s_Filtered;
+    static uint64_t s_FilteredUpTo;
+    static bool s_AutoScroll;
+};
@@ -23,10 +23,19 @@ public:
     static Editor* GetInstance();
     static Engine* GetEngine();
 
+    // Redibujo bajo demanda: tras IdleFrameThreshold frames sin cambios en la escena, el bucle espera
+    // a un evento (o a IdleTimeout segundos, para refrescar los paneles) en lugar de sondear
+    static constexpr unsigned int IdleFrameThreshold = 3;
+    static constexpr double IdleTimeout = 0.25;
+    static bool IsIdle();
+
 private:
     // Miembros estáticos que ahora usan std::unique_ptr para una gestión
     // de memoria segura y automática. Esto elimina la necesidad de llamar
     // a 'delete' manualmente en el Shutdown().
     static std::unique_ptr<Editor> s_Instance;
     static std::unique_ptr<Engine> s_Engine;
+
+    // Frames seguidos en los que la escena no cambió
+    static unsigned int s_IdleFrames;
 };
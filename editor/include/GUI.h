@@ -2,8 +2,10 @@
 
 #define GLFW_INCLUDE_NONE
 #include "FrameBuffer.h"
+#include "FramePacket.h"
 #include <GLFW/glfw3.h>
 #include <imgui.h>
+#include <future>
 #include <string>
 #include <IconsFontAwesome6.h>
 
@@ -15,23 +17,36 @@ public:
     GUI();
     ~GUI();
 
+    // Rasteriza las fuentes en un hilo de trabajo; se puede llamar antes de crear el motor
+    // (solo depende de la escala) y GUI::Init recoge el atlas
+    static void LoadFontsAsync(float scale);
     static void Init(GLFWwindow* window);
     static void LoadConfigs();
     static void Run();
-    static void Render(const FrameBuffer& sceneBuffer);
+    // Construye los paneles y deja la GUI del frame en 'packet' para el hilo de render
+    static void Render(const FrameBuffer& sceneBuffer, FramePacket& packet);
     static void Shutdown();
 
-    static void Print(const std::string& message);
-
     static void ShowMenu();
     static void ShowEntities();
     static void ShowFiles();
     static void ShowConsole();
     static void ShowScene(const FrameBuffer& sceneBuffer);
     static void ShowProperties();
+    static void ShowProfiler();
+    static void ShowMemory();
+    static void ShowRenderStats();
+    static void ShowFrameTimes();
 
 private:
-    static std::string s_Log;
+    // No toca el contexto de ImGui, así que puede ejecutarse en otro hilo
+    static ImFontAtlas* BuildFontAtlas(float scale);
+
     static ImVec4* s_StyleColors;
     static WindowScale s_WindowScale;
+    static std::future<ImFontAtlas*> s_FontAtlasLoad;
+    static ImFontAtlas* s_FontAtlas;
+    static float s_FontScale;
+    // Destino de Log que llena el panel Console
+    static size_t s_LogSink;
 };
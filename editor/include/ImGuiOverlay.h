@@ -0,0 +1,28 @@
+#pragma once
+
+#include "FramePacket.h"
+#include <imgui.h>
+#include <vector>
+
+// Copia de las listas de dibujo de ImGui de un frame para dibujarlas en el hilo de render.
+// ImGui reescribe sus listas en cada NewFrame, así que el hilo principal no puede empezar el
+// frame siguiente mientras el de render usa las originales. Las listas se reutilizan entre
+// frames para no reservar memoria cada vez.
+class ImGuiOverlay : public FrameOverlay
+{
+public:
+    ImGuiOverlay() = default;
+    ~ImGuiOverlay() override;
+
+    ImGuiOverlay(const ImGuiOverlay&) = delete;
+    ImGuiOverlay& operator=(const ImGuiOverlay&) = delete;
+
+    // Hilo principal, después de ImGui::Render()
+    void Capture(const ImDrawData& drawData);
+    // Hilo de render
+    void Render() override;
+
+private:
+    ImDrawData m_DrawData;
+    std::vector<ImDrawList*> m_Lists;
+};
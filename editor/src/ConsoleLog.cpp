@@ -0,0 +1,201 @@
+#include "ConsoleLog.h"
+
+#include <algorithm>
+
+std::mutex ConsoleLog::s_Mutex;
+std::vector<LogEntry> ConsoleLog::s_Entries;
+uint64_t ConsoleLog::s_Next = 0;
+uint64_t ConsoleLog::s_Cleared = 0;
+std::vector<std::string> ConsoleLog::s_Categories;
+
+std::array<bool, static_cast<size_t>(LogSeverity::Count)> ConsoleLog::s_ShowSeverity = { true, true, true, true };
+int ConsoleLog::s_CategoryFilter = -1;
+ImGuiTextFilter ConsoleLog::s_TextFilter;
+std::deque<uint64_t> ConsoleLog::s_Filtered;
+uint64_t ConsoleLog::s_FilteredUpTo = 0;
+bool ConsoleLog::s_AutoScroll = true;
+
+void ConsoleLog::Add(const LogMessage& message)
+{
+    std::lock_guard<std::mutex> lock(s_Mutex);
+    if(s_Entries.empty())
+        s_Entries.resize(Capacity);
+
+    const uint16_t category = Intern(message.Category);
+
+    // Una entrada por línea (p. ej. el registro de un shader): el clipper necesita líneas de la misma altura
+    std::string_view text = message.Text;
+    while(true)
+    {
+        const size_t end = text.find('\n');
+
+        // Con el anillo lleno se sobrescribe la más antigua; su texto conserva la capacidad
+        LogEntry& entry = s_Entries[s_Next % Capacity];
+        entry.Sequence = s_Next++;
+        entry.Severity = message.Severity;
+        entry.Category = category;
+        entry.Time = message.Time;
+        entry.Message.assign(text.substr(0, end));
+
+        if(end == std::string_view::npos)
+            break;
+        text.remove_prefix(end + 1);
+    }
+}
+
+void ConsoleLog::Clear()
+{
+    std::lock_guard<std::mutex> lock(s_Mutex);
+    s_Cleared = s_Next;
+    s_Filtered.clear();
+    s_FilteredUpTo = s_Next;
+}
+
+size_t ConsoleLog::GetCount()
+{
+    std::lock_guard<std::mutex> lock(s_Mutex);
+    return static_cast<size_t>(s_Next - GetOldest());
+}
+
+uint64_t ConsoleLog::GetDropped()
+{
+    std::lock_guard<std::mutex> lock(s_Mutex);
+    return s_Next > Capacity ? s_Next - Capacity : 0;
+}
+
+uint16_t ConsoleLog::Intern(std::string_view category)
+{
+    // Pocas categorías y casi siempre las mismas: basta una búsqueda lineal
+    for(size_t i = 0; i < s_Categories.size(); i++)
+    {
+        if(s_Categories[i] == category)
+            return static_cast<uint16_t>(i);
+    }
+    s_Categories.emplace_back(category);
+    return static_cast<uint16_t>(s_Categories.size() - 1);
+}
+
+uint64_t ConsoleLog::GetOldest()
+{
+    const uint64_t first = s_Next > Capacity ? s_Next - Capacity : 0;
+    return std::max(first, s_Cleared);
+}
+
+bool ConsoleLog::PassesFilter(const LogEntry& entry)
+{
+    if(!s_ShowSeverity[static_cast<size_t>(entry.Severity)])
+        return false;
+    if(s_CategoryFilter >= 0 && entry.Category != s_CategoryFilter)
+        return false;
+    return s_TextFilter.PassFilter(entry.Message.data(), entry.Message.data() + entry.Message.size());
+}
+
+void ConsoleLog::RebuildFiltered()
+{
+    s_Filtered.clear();
+    s_FilteredUpTo = GetOldest();
+    UpdateFiltered();
+}
+
+void ConsoleLog::UpdateFiltered()
+{
+    // Fuera las que el anillo ya ha sobrescrito; solo se comprueban las llegadas desde el último frame
+    const uint64_t oldest = GetOldest();
+    while(!s_Filtered.empty() && s_Filtered.front() < oldest)
+        s_Filtered.pop_front();
+
+    for(uint64_t sequence = std::max(s_FilteredUpTo, oldest); sequence < s_Next; sequence++)
+    {
+        if(PassesFilter(s_Entries[sequence % Capacity]))
+            s_Filtered.push_back(sequence);
+    }
+    s_FilteredUpTo = s_Next;
+}
+
+void ConsoleLog::Draw()
+{
+    std::lock_guard<std::mutex> lock(s_Mutex);
+
+    bool changed = false;
+    for(size_t i = 0; i < s_ShowSeverity.size(); i++)
+    {
+        changed |= ImGui::Checkbox(Log::GetSeverityName(static_cast<LogSeverity>(i)), &s_ShowSeverity[i]);
+        ImGui::SameLine();
+    }
+
+    ImGui::SetNextItemWidth(140.0f);
+    if(ImGui::BeginCombo("##Category", s_CategoryFilter < 0 ? "All categories" : s_Categories[s_CategoryFilter].c_str()))
+    {
+        if(ImGui::Selectable("All categories", s_CategoryFilter < 0))
+        {
+            s_CategoryFilter = -1;
+            changed = true;
+        }
+        for(size_t i = 0; i < s_Categories.size(); i++)
+        {
+            if(ImGui::Selectable(s_Categories[i].c_str(), s_CategoryFilter == static_cast<int>(i)))
+            {
+                s_CategoryFilter = static_cast<int>(i);
+                changed = true;
+            }
+        }
+        ImGui::EndCombo();
+    }
+    ImGui::SameLine();
+    changed |= s_TextFilter.Draw("Filter", 180.0f);
+    ImGui::SameLine();
+    ImGui::Checkbox("Auto-scroll", &s_AutoScroll);
+
+    if(changed)
+        RebuildFiltered();
+    else
+        UpdateFiltered();
+
+    const uint64_t count = s_Next - GetOldest();
+    ImGui::TextDisabled("%zu of %llu lines", s_Filtered.size(), static_cast<unsigned long long>(count));
+
+    ImGui::Separator();
+    ImGui::BeginChild("ConsoleLines", ImVec2(0, 0), 0, ImGuiWindowFlags_HorizontalScrollbar);
+
+    // Solo se recorren las líneas que caben en la vista
+    ImGuiListClipper clipper;
+    clipper.Begin(static_cast<int>(s_Filtered.size()));
+    while(clipper.Step())
+    {
+        for(int i = clipper.DisplayStart; i < clipper.DisplayEnd; i++)
+            DrawEntry(s_Entries[s_Filtered[i] % Capacity]);
+    }
+    clipper.End();
+
+    // Sigue a los mensajes nuevos mientras la vista esté abajo del todo
+    if(s_AutoScroll && ImGui::GetScrollY() >= ImGui::GetScrollMaxY())
+        ImGui::SetScrollHereY(1.0f);
+
+    ImGui::EndChild();
+}
+
+void ConsoleLog::DrawEntry(const LogEntry& entry)
+{
+    static const ImVec4 colors[static_cast<size_t>(LogSeverity::Count)] = {
+        ImVec4(0.6f, 0.6f, 0.6f, 1.0f),
+        ImVec4(1.0f, 1.0f, 1.0f, 1.0f),
+        ImVec4(1.0f, 0.8f, 0.3f, 1.0f),
+        ImVec4(1.0f, 0.35f, 0.35f, 1.0f)
+    };
+    const ImVec4& color = colors[static_cast<size_t>(entry.Severity)];
+
+    ImGui::TextDisabled("%9.3f", entry.Time);
+    ImGui::SameLine();
+    ImGui::TextColored(color, "%-7s", Log::GetSeverityName(entry.Severity));
+    ImGui::SameLine();
+    ImGui::TextDisabled("[%s]", s_Categories[entry.Category].c_str());
+    ImGui::SameLine();
+
+    // Los avisos y errores se leen en su color; el resto en el del tema
+    const bool highlight = entry.Severity >= LogSeverity::Warning;
+    if(highlight)
+        ImGui::PushStyleColor(ImGuiCol_Text, color);
+    ImGui::TextUnformatted(entry.Message.data(), entry.Message.data() + entry.Message.size());
+    if(highlight)
+        ImGui::PopStyleColor();
+}
@@ -11,12 +11,21 @@
 #include <GLFW/glfw3.h>     // Necesario para glfwWindowShouldClose, glfwSwapBuffers, glfwPollEvents
 #include "Renderer.h" // Asumiendo que Renderer.h está en una ruta de inclusión como 'engine/rendering'
 #include <memory>           // Necesario para std::unique_ptr y std::make_unique
+#include "Profiler.h"       // Macros PROFILE_* (vacías en builds de shipping)
+#include "GPUProfiler.h"    // Macros PROFILE_GPU_* para los tiempos de GPU por pase
+#include "MemoryTracker.h"  // MEMORY_FRAME_END para las reservas por frame
+#include "FrameTimer.h"     // Historial de tiempos por frame, percentiles y tirones
+#include "StartupTimer.h"   // Fases del arranque y tiempo hasta el primer frame
+#include "RenderThread.h"   // Hilo con el contexto de OpenGL y paquetes de frame
+#include "FramePacer.h"     // Modos de presentación: limitador y espera de baja latencia
+#include "FixedTimestep.h"  // Reloj de simulación (no avanza durante el reposo)
 
 // --- INICIALIZACIÓN DE MIEMBROS ESTÁTICOS ---
 // Estos punteros estáticos ahora son std::unique_ptr y se inicializan a nullptr.
 // std::unique_ptr se encarga automáticamente de la gestión de memoria.
 std::unique_ptr<Editor> Editor::s_Instance = nullptr;
 std::unique_ptr<Engine> Editor::s_Engine = nullptr;
+unsigned int Editor::s_IdleFrames = 0;
 
 // --- CONSTRUCTOR ---
 Editor::Editor()
@@ -48,6 +57,13 @@ Engine* Editor::GetEngine()
     return s_Engine.get();
 }
 
+// --- ESTADO DE REPOSO ---
+bool Editor::IsIdle()
+{
+    // Solo se espera a eventos si el renderizador puede saltarse la escena
+    return Renderer::GetData().m_OnDemand && s_IdleFrames >= IdleFrameThreshold;
+}
+
 // --- INICIALIZACIÓN DEL EDITOR ---
 void Editor::Init()
 {
@@ -57,6 +73,10 @@ void Editor::Init()
         s_Instance = std::make_unique<Editor>(); // Crea la única instancia de Editor dinámicamente.
     }
 
+    // Las fuentes de la GUI solo dependen de la escala del monitor, así que se rasterizan en un hilo
+    // de trabajo mientras se crea la ventana, se carga OpenGL y se compilan los shaders.
+    GUI::LoadFontsAsync(Window::GetMonitorScale().X);
+
     // Crea una nueva instancia del motor usando std::make_unique.
     // La inicialización del Engine se asume que ocurre en su constructor.
     s_Engine = std::make_unique<Engine>();
@@ -64,10 +84,12 @@ void Editor::Init()
     // Inicializa la GUI.
     // GUI::Init() devuelve 'void', por lo que no se puede usar en una condición 'if (!...)'.
     // Se pasa la ventana nativa de GLFW obtenida del motor para que la GUI se adjunte a ella.
+    // GUI::Init() ya carga las configuraciones (imgui.ini, estilo): no hay que llamar a LoadConfigs() aparte.
     GUI::Init(s_Engine->GetWindow()->GetNativeWindow());
 
-    // Carga las configuraciones guardadas de la GUI (ej. desde imgui.ini).
-    GUI::LoadConfigs();
+    // El editor solo vuelve a dibujar la escena cuando algo cambia (los modos headless y los
+    // benchmarks dibujan siempre)
+    Renderer::GetData().m_OnDemand = true;
 
     // Inicia el bucle principal del editor.
     Run();
@@ -84,30 +106,84 @@ void Editor::Run()
         return; // Sale si la ventana no es válida.
     }
 
+    // El contexto de OpenGL pasa al hilo de render: desde aquí el hilo principal prepara el frame N+1
+    // (GUI, simulación, selección de lo visible) mientras el de render envía el frame N a la GPU.
+    // Las llamadas a OpenGL que queden en este hilo (cargar mallas, redimensionar) van por RenderThread::Invoke.
+    RenderThread::Start(editorWindow);
+
     // Bucle principal del editor. Se ejecuta continuamente mientras la ventana de GLFW no reciba una señal de cierre.
     // Se usa glfwWindowShouldClose directamente ya que Window::ShouldClose() no está declarado.
     while (!glfwWindowShouldClose(editorWindow->GetNativeWindow())) {
+        // Abre el frame del profiler; todo lo medido hasta PROFILE_FRAME_END() cuelga de él.
+        PROFILE_FRAME_BEGIN();
+
+        // Paquete del frame que se está preparando; el hilo de render tiene el otro.
+        FramePacket& packet = RenderThread::GetWritePacket();
+
+        // Limitador de frames o, en modo de baja latencia, espera a que la GPU termine el frame anterior.
+        FramePacer::WaitForFrame();
+
+        // Procesa los eventos de entrada (teclado, ratón) y del sistema operativo.
+        // Se usa glfwPollEvents directamente ya que Window::PollEvents() no está declarado.
+        // Va después de la espera del FramePacer para que la entrada sea lo más reciente posible.
+        // Con la escena en reposo se espera al siguiente evento en lugar de girar en vacío;
+        // Renderer::Invalidate (recargas, mips nuevos) despierta el bucle con glfwPostEmptyEvent.
+        if (IsIdle()) {
+            PROFILE_SCOPE("WaitEvents");
+            const double waitStart = glfwGetTime();
+            glfwWaitEventsTimeout(IdleTimeout);
+            // Si despertó un evento (y no el tiempo máximo) se vuelve a sondear unos frames: una tecla
+            // recién pulsada solo mueve la cámara en los pasos de simulación siguientes
+            if (glfwGetTime() - waitStart < IdleTimeout)
+                s_IdleFrames = 0;
+            // La espera no es tiempo de frame: no cuenta como tirón ni se simula de golpe al despertar
+            FrameTimer::SkipIdle();
+            FixedTimestep::SkipIdle();
+        } else {
+            glfwPollEvents();
+        }
+#ifdef FERX_PROFILING
+        // Inicio de la latencia de entrada a pantalla de este frame (GPUProfiler).
+        packet.InputTicks = Profiler::Now();
+#endif
+
         // Ejecuta la parte de actualización de la GUI (ej. manejo de eventos de ImGui, preparación de nuevos frames).
         GUI::Run();
 
-        // Llama al método estático Run() del Engine.
-        // Asumimos que Engine::Run() es el que se encarga de llamar a Renderer::Render()
-        // para dibujar la escena del motor.
-        Engine::Run(); // Llamada al método estático Run() del Engine.
+        // Simulación, entrada y cámara del motor; deja en el paquete lo que hay que dibujar.
+        // Se solapa con el frame anterior, que el hilo de render aún puede estar dibujando.
+        Engine::Update(packet.Scene);
+        s_IdleFrames = packet.Scene.Dirty ? 0 : s_IdleFrames + 1;
+
+        // Los paneles leen estado que escribe el hilo de render (estadísticas, tiempos de GPU, el FBO):
+        // a partir de aquí el frame anterior está terminado y no hay carreras.
+        {
+            PROFILE_SCOPE("WaitForRenderThread");
+            RenderThread::WaitIdle();
+        }
+        // Con los dos hilos parados se aplican las texturas que terminaron de cargarse
+        Renderer::ApplyPendingResources();
+        // Registra el tiempo de pared del frame (presentación incluida). Va aquí porque casa los tiempos
+        // de GPU, que escribe el hilo de render; si es un tirón, guarda el árbol del Profiler del frame anterior.
+        FrameTimer::EndFrame();
 
         // La GUI renderiza sus propios elementos (paneles, botones, etc.)
         // y luego incrusta el contenido del FrameBuffer de la escena 3D
         // (obtenido de Renderer::GetData().m_FBO) dentro de uno de sus paneles (ej. ShowScene).
-        GUI::Render(*Renderer::GetData().m_FBO); // Asegúrate de que Renderer::GetData().m_FBO es accesible y válido.
+        // No dibuja: copia sus listas de dibujo al paquete.
+        GUI::Render(*Renderer::GetData().m_FBO, packet);
 
-        // Intercambia los buffers de la ventana para mostrar el frame renderizado en pantalla.
-        // Se usa glfwSwapBuffers directamente ya que Window::SwapBuffers() no está declarado.
-        glfwSwapBuffers(editorWindow->GetNativeWindow());
+        // Entrega el paquete al hilo de render, que dibuja la escena y la GUI e intercambia los buffers.
+        RenderThread::Submit();
 
-        // Procesa los eventos de entrada (teclado, ratón) y del sistema operativo.
-        // Se usa glfwPollEvents directamente ya que Window::PollEvents() no está declarado.
-        glfwPollEvents();
+        // Cierra el frame: vacía los búferes de los hilos y construye el árbol del panel Profiler.
+        PROFILE_FRAME_END();
+        // Cierra también el frame del MemoryTracker (reservas por frame para el panel Memory).
+        MEMORY_FRAME_END();
     }
+
+    // Devuelve el contexto a este hilo antes de apagar la GUI y el motor.
+    RenderThread::Stop();
 }
 
 // --- APAGADO DEL EDITOR ---
@@ -128,6 +204,9 @@ void Editor::Shutdown()
         // que los objetos ya no son válidos, aunque unique_ptr ya se encarga de la liberación.
         s_Engine = nullptr;
         s_Instance = nullptr;
+
+        // Informe del arranque al salir: fases, hilos de trabajo y tiempo hasta el primer frame
+        StartupTimer::PrintReport();
     } else {
         // En un entorno real, aquí se podría registrar una advertencia.
     }
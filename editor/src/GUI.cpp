@@ -6,25 +6,136 @@
 #include "Editor.h"
 #include "FrameBuffer.h"
 #include "Window.h"
+#include "Profiler.h"
+#include "GPUProfiler.h"
+#include "MemoryTracker.h"
+#include "RenderStats.h"
+#include "RenderCapture.h"
+#include "FrameTimer.h"
+#include "StartupTimer.h"
+#include "ThreadPool.h"
+#include "AsyncIO.h"
+#include "TaskScheduler.h"
+#include "FrameAllocator.h"
+#include "Log.h"
+#include "ConsoleLog.h"
+#include "FixedTimestep.h"
+#include "FramePacer.h"
+#include "ImGuiOverlay.h"
+
+#include <algorithm>
+#include <cfloat>
+#include <cmath>
 
-std::string GUI::s_Log;
 ImVec4* GUI::s_StyleColors;
 WindowScale GUI::s_WindowScale;
+std::future<ImFontAtlas*> GUI::s_FontAtlasLoad;
+ImFontAtlas* GUI::s_FontAtlas = nullptr;
+float GUI::s_FontScale = 0.0f;
+size_t GUI::s_LogSink = 0;
 
 GUI::GUI()= default;
 
 GUI::~GUI()= default;
 
+void GUI::LoadFontsAsync(float scale)
+{
+    s_FontScale = scale;
+    s_FontAtlasLoad = ThreadPool::Get().Submit([scale]() {
+        StartupScope phase("Font atlas");
+        return BuildFontAtlas(scale);
+    });
+}
+
+ImFontAtlas* GUI::BuildFontAtlas(float scale)
+{
+    const float baseFontSize = 14.0f * scale;
+    const float iconFontSize = baseFontSize * 2.0f / 2.4f; // FontAwesome fonts need to have their sizes reduced by 2.0f/3.0f in order to align correctly
+
+    // Las dos fuentes se leen en un mismo lote directamente en memoria de ImGui: el atlas la adopta
+    // (FontDataOwnedByAtlas) y la libera él, sin copias intermedias
+    const char* fontPaths[] = { ENGINE_RESOURCES_PATH"fonts/Ruda-Bold.ttf", ENGINE_RESOURCES_PATH"fonts/" FONT_ICON_FILE_NAME_FAS };
+    std::vector<FileReadRequest> requests;
+    for(const char* path : fontPaths)
+    {
+        FileReadRequest request;
+        request.Path = path;
+        request.Size = AsyncIO::GetFileSize(path);
+        request.Buffer = request.Size ? IM_ALLOC(request.Size) : nullptr;
+        requests.push_back(std::move(request));
+    }
+    std::vector<std::future<FileReadResult>> reads = AsyncIO::Get().ReadBatch(requests);
+    FileReadResult fonts[2];
+    for(size_t i = 0; i < reads.size(); i++)
+    {
+        fonts[i] = reads[i].get();
+        // Sin búfer propio (tamaño 0) AsyncIO reserva uno que no sirve aquí
+        if(!requests[i].Buffer || !fonts[i].Success)
+        {
+            LOG_ERROR("Editor", "Failed to load font: {}", fontPaths[i]);
+            if(requests[i].Buffer)
+                IM_FREE(requests[i].Buffer);
+            requests[i].Buffer = nullptr;
+        }
+    }
+
+    // Los iconos se mezclan con la fuente base (MergeMode): sin ella no se pueden añadir
+    if(!requests[0].Buffer && requests[1].Buffer)
+    {
+        IM_FREE(requests[1].Buffer);
+        requests[1].Buffer = nullptr;
+    }
+
+    ImFontAtlas* atlas = IM_NEW(ImFontAtlas)();
+    if(requests[0].Buffer)
+        atlas->AddFontFromMemoryTTF(requests[0].Buffer, static_cast<int>(fonts[0].BytesRead), baseFontSize);
+
+    static constexpr ImWchar iconsRanges[] = { ICON_MIN_FA, ICON_MAX_16_FA, 0 };
+    ImFontConfig iconsConfig;
+    iconsConfig.MergeMode = true;
+    iconsConfig.PixelSnapH = true;
+    iconsConfig.GlyphMinAdvanceX = iconFontSize;
+    if(requests[1].Buffer)
+        atlas->AddFontFromMemoryTTF(requests[1].Buffer, static_cast<int>(fonts[1].BytesRead), iconFontSize, &iconsConfig, iconsRanges );
+
+    // Rasteriza ya en el formato que sube el backend de OpenGL, para que el primer frame no lo haga
+    unsigned char* pixels;
+    int width, height;
+    atlas->GetTexDataAsRGBA32(&pixels, &width, &height);
+    return atlas;
+}
+
 void GUI::Init(GLFWwindow* window)
 {
+    StartupScope phase("GUI::Init");
+    MEMORY_TAG(Editor);
     IMGUI_CHECKVERSION();
-    ImGui::CreateContext();
+
+    // El atlas se construye sin contexto de ImGui: hay que recogerlo antes de crearlo. Si la ventana
+    // acabó en un monitor con otra escala que la prevista, se reconstruye aquí.
+    const float scale = Engine::Get()->GetWindow()->GetScale().X;
+    if(s_FontAtlasLoad.valid())
+        s_FontAtlas = s_FontAtlasLoad.get();
+    if(!s_FontAtlas || s_FontScale != scale)
+    {
+        if(s_FontAtlas)
+            IM_DELETE(s_FontAtlas);
+        s_FontAtlas = BuildFontAtlas(scale);
+        s_FontScale = scale;
+    }
+    ImGui::CreateContext(s_FontAtlas);
 
     LoadConfigs();
 
+    // El panel Console recibe los mensajes del registro del motor (en el hilo de fondo de Log)
+    s_LogSink = Log::AddSink([](const LogMessage& message) { ConsoleLog::Add(message); });
+
     // Setup Platform/Renderer backends
     ImGui_ImplGlfw_InitForOpenGL(window, true);
     ImGui_ImplOpenGL3_Init();
+    // Shaders y textura de fuentes ahora, con el contexto aún en este hilo: después solo el hilo
+    // de render dibuja y GUI::Run ya no llama a ImGui_ImplOpenGL3_NewFrame
+    ImGui_ImplOpenGL3_CreateDeviceObjects();
 }
 
 void GUI::LoadConfigs()
@@ -37,17 +148,7 @@ void GUI::LoadConfigs()
 
     s_WindowScale = Engine::Get()->GetWindow()->GetScale();
 
-    const float baseFontSize = 14.0f * s_WindowScale.X;
-    const float iconFontSize = baseFontSize * 2.0f / 2.4f; // FontAwesome fonts need to have their sizes reduced by 2.0f/3.0f in order to align correctly
-
-    io.Fonts->AddFontFromFileTTF(ENGINE_RESOURCES_PATH"fonts/Ruda-Bold.ttf", baseFontSize);
-
-    static constexpr ImWchar iconsRanges[] = { ICON_MIN_FA, ICON_MAX_16_FA, 0 };
-    ImFontConfig iconsConfig;
-    iconsConfig.MergeMode = true;
-    iconsConfig.PixelSnapH = true;
-    iconsConfig.GlyphMinAdvanceX = iconFontSize;
-    io.Fonts->AddFontFromFileTTF(ENGINE_RESOURCES_PATH"fonts/" FONT_ICON_FILE_NAME_FAS, iconFontSize, &iconsConfig, iconsRanges );
+    // Las fuentes vienen del atlas compartido que recibe ImGui::CreateContext (GUI::Init)
 
     ImGui::StyleColorsDark();
 
@@ -105,53 +206,77 @@ void GUI::LoadConfigs()
 
 void GUI::Run()
 {
-    ImGui_ImplOpenGL3_NewFrame();
+    PROFILE_SCOPE("GUI::NewFrame");
+    MEMORY_TAG(Editor);
+
     ImGui_ImplGlfw_NewFrame();
     ImGui::NewFrame();
     ImGui::DockSpaceOverViewport(ImGui::GetMainViewport()->ID);
 }
 
-void GUI::Render(const FrameBuffer& sceneBuffer)
+void GUI::Render(const FrameBuffer& sceneBuffer, FramePacket& packet)
 {
+    PROFILE_SCOPE("GUI::Render");
+    MEMORY_TAG(Editor);
+
     ShowConsole();
     ShowEntities();
     ShowProperties();
     ShowMenu();
     ShowFiles();
     ShowScene(sceneBuffer);
+    ShowRenderStats();
+    ShowFrameTimes();
+#ifdef FERX_PROFILING
+    ShowProfiler();
+    ShowMemory();
+#endif
 
     ImGui::Render();
-    ImGui_ImplOpenGL3_RenderDrawData(ImGui::GetDrawData());
+
+    // El hilo de render dibuja una copia: ImGui reescribe sus listas en el siguiente NewFrame
+    if(!packet.Overlay)
+        packet.Overlay = std::make_unique<ImGuiOverlay>();
+    static_cast<ImGuiOverlay&>(*packet.Overlay).Capture(*ImGui::GetDrawData());
 }
 
 void GUI::Shutdown()
 {
+    Log::RemoveSink(s_LogSink);
+    s_LogSink = 0;
+
     ImGui_ImplOpenGL3_Shutdown();
     ImGui_ImplGlfw_Shutdown();
     ImGui::DestroyContext();
-}
 
-void GUI::Print(const std::string& message)
-{
-    s_Log += message + '\n';
+    // El contexto no es dueño de un atlas compartido
+    if(s_FontAtlasLoad.valid())
+        s_FontAtlas = s_FontAtlasLoad.get();
+    if(s_FontAtlas)
+        IM_DELETE(s_FontAtlas);
+    s_FontAtlas = nullptr;
 }
 
 void GUI::ShowConsole(){
     ImGui::Begin(ICON_FA_TERMINAL" Console");
 
     if(ImGui::Button("Clear")){
-        s_Log.clear();
+        ConsoleLog::Clear();
     }
 
     ImGui::SameLine();
 
     if(ImGui::Button("Debug")){
-        Print("Debug message");
+        LOG_DEBUG("Editor", "Debug message");
     }
 
-    ImGui::Text("Application average %.3f ms/frame (%.1f FPS)", 1000.0f / ImGui::GetIO().Framerate, ImGui::GetIO().Framerate);
+    // La media esconde los tirones: se muestran también los percentiles altos (panel Frame Times)
+    const FrameTimeStats frameTimes = FrameTimer::GetCPUStats();
+    ImGui::Text("Frame time p50 %.2f ms | p99 %.2f ms | max %.2f ms (%.1f FPS)", frameTimes.P50Ms, frameTimes.P99Ms, frameTimes.MaxMs,
+                frameTimes.MeanMs > 0.0 ? 1000.0 / frameTimes.MeanMs : 0.0);
 
-    ImGui::Text("%s", s_Log.c_str());
+    // Solo se dibujan las líneas visibles del anillo, con los filtros del panel
+    ConsoleLog::Draw();
 
     ImGui::End();
 }
@@ -184,6 +309,102 @@ void GUI::ShowProperties()
         ImGui::EndGroup();
     }
 
+    if(ImGui::CollapsingHeader("Mesh"))
+    {
+        static char meshPath[256] = "";
+
+        const Mesh* mesh = Renderer::GetData().m_Mesh;
+        const MeshStats& stats = mesh->GetStats();
+        ImGui::Text("%s", mesh->GetName().c_str());
+        ImGui::Text("Vertices: %u (imported %u)", stats.VertexCount, stats.ImportedVertexCount);
+        ImGui::Text("Triangles: %u", stats.TriangleCount);
+        ImGui::Text("ACMR: %.3f -> %.3f", stats.ACMRBefore, stats.ACMRAfter);
+        ImGui::Text("ATVR: %.3f -> %.3f", stats.ATVRBefore, stats.ATVRAfter);
+
+        bool compressed = Renderer::GetData().m_VertexFormat == MeshVertexFormat::Compressed;
+        if(ImGui::Checkbox("Compressed Vertices", &compressed))
+        {
+            Renderer::SetVertexFormat(compressed ? MeshVertexFormat::Compressed : MeshVertexFormat::Float);
+        }
+        ImGui::Text("Vertex size: %u bytes (%.1f KB)", mesh->GetVertexSize(), mesh->GetVertexSize() * stats.VertexCount / 1024.0f);
+
+        const std::vector<MeshLOD>& lods = mesh->GetData().LODs;
+        for(size_t i = 0; i < lods.size(); i++)
+        {
+            const bool selected = i == Renderer::GetData().m_Cube->GetLOD();
+            ImGui::Text("%s LOD %zu: %u triangles, error %.4f", selected ? ">" : " ", i, lods[i].IndexCount / 3, lods[i].Error);
+        }
+        ImGui::DragFloat("LOD Threshold (px)", &Renderer::GetData().m_LODThreshold, 0.05f, 0.1f, 32.0f);
+        ImGui::DragFloat("LOD Hysteresis", &Renderer::GetData().m_LODHysteresis, 0.01f, 0.0f, 0.9f);
+
+        const MeshletCullStats& meshlets = Renderer::GetData().m_MeshletStats;
+        ImGui::Checkbox("Meshlet Culling", &Renderer::GetData().m_MeshletCulling);
+        ImGui::Text("Meshlets: %zu per object", mesh->GetMeshlets().size());
+        ImGui::Text("Visible: %u / %u (%u ranges)", meshlets.Visible, meshlets.Total, meshlets.Ranges);
+        ImGui::Text("Culled: %u frustum, %u backface", meshlets.FrustumCulled, meshlets.BackfaceCulled);
+
+        ImGui::InputText("Path", meshPath, sizeof(meshPath));
+        if(ImGui::Button("Import"))
+        {
+            if(Renderer::LoadMesh(meshPath))
+                LOG_INFO("Editor", "Imported mesh: {}", meshPath);
+            else
+                LOG_ERROR("Editor", "Failed to import mesh: {}", meshPath);
+        }
+    }
+
+    if(ImGui::CollapsingHeader("Texture Streaming"))
+    {
+        static char texturePath[256] = "";
+        // Carga en curso (Renderer::LoadTextureAsync): la GUI sigue dibujándose mientras tanto
+        static std::future<bool> textureLoad;
+        static std::string textureLoadPath;
+        ImGui::InputText("Texture Path", texturePath, sizeof(texturePath));
+        const bool loading = textureLoad.valid();
+        if(loading)
+            ImGui::BeginDisabled();
+        if(ImGui::Button("Load Texture"))
+        {
+            textureLoadPath = texturePath;
+            textureLoad = TaskScheduler::Run(Renderer::LoadTextureAsync(textureLoadPath));
+        }
+        if(loading)
+        {
+            ImGui::EndDisabled();
+            ImGui::SameLine();
+            ImGui::TextUnformatted("Loading...");
+            if(textureLoad.wait_for(std::chrono::seconds(0)) == std::future_status::ready)
+            {
+                if(textureLoad.get())
+                    LOG_INFO("Editor", "Loaded texture: {}", textureLoadPath);
+                else
+                    LOG_ERROR("Editor", "Failed to load texture: {}", textureLoadPath);
+            }
+        }
+
+        int budgetMB = static_cast<int>(TextureStreamer::GetBudget() / (1024 * 1024));
+        if(ImGui::SliderInt("VRAM Budget (MB)", &budgetMB, 1, 1024))
+        {
+            TextureStreamer::SetBudget(static_cast<size_t>(budgetMB) * 1024 * 1024);
+            // Las expulsiones se hacen al dibujar la escena
+            Renderer::Invalidate();
+        }
+
+        const TextureStreamingStats& streaming = TextureStreamer::GetStats();
+        const float toMB = 1.0f / (1024.0f * 1024.0f);
+        ImGui::Text("Resident: %.2f / %.2f MB (full chains %.2f MB)", streaming.ResidentBytes * toMB, streaming.BudgetBytes * toMB, streaming.FullBytes * toMB);
+        ImGui::Text("CPU mip copies: %.2f MB (%u textures reading mips from disk)", streaming.CPUBytes * toMB, streaming.ReloadingTextures);
+        ImGui::Text("Pending mips: %u", streaming.PendingMips);
+        ImGui::Text("Streamed in: %u, evicted: %u", streaming.StreamedIn, streaming.Evicted);
+
+        for(const Texture* texture : TextureStreamer::GetTextures())
+        {
+            ImGui::Text("%s: mip %d/%d resident (%dx%d), %.2f MB", texture->GetPath().c_str(), texture->GetResidentMip(),
+                        texture->GetMipCount() - 1, std::max(1, texture->GetWidth() >> texture->GetResidentMip()),
+                        std::max(1, texture->GetHeight() >> texture->GetResidentMip()), texture->GetResidentBytes() * toMB);
+        }
+    }
+
     ImGui::NewLine();
 
     ImGui::BeginGroup();
@@ -234,3 +455,488 @@ void GUI::ShowScene(const FrameBuffer& sceneBuffer)
 
 
 
+
+#ifdef FERX_PROFILING
+namespace
+{
+    // Tabla con el árbol agregado de un frame del Profiler, agrupado por hilo
+    void ShowProfileTree(const char* id, const ProfileFrame& frame)
+    {
+        if(ImGui::BeginTable(id, 3, ImGuiTableFlags_RowBg | ImGuiTableFlags_BordersInnerV | ImGuiTableFlags_Resizable))
+        {
+            ImGui::TableSetupColumn("Scope");
+            ImGui::TableSetupColumn("ms");
+            ImGui::TableSetupColumn("Calls");
+            ImGui::TableHeadersRow();
+
+            const std::vector<ProfileThreadInfo> threads = Profiler::GetThreads();
+            const std::vector<ProfileNode>& nodes = frame.Nodes;
+            uint32_t currentThread = ~0u;
+            uint32_t collapsedDepth = ~0u;
+
+            for(size_t i = 0; i < nodes.size(); i++)
+            {
+                const ProfileNode& node = nodes[i];
+
+                if(node.ThreadID != currentThread)
+                {
+                    currentThread = node.ThreadID;
+                    collapsedDepth = ~0u;
+                    ImGui::TableNextRow();
+                    ImGui::TableNextColumn();
+                    ImGui::TextDisabled("%s", node.ThreadID < threads.size() ? threads[node.ThreadID].Name.c_str() : "Thread");
+                }
+
+                // Los hijos de un nodo cerrado se saltan hasta volver a su profundidad
+                if(node.Depth > collapsedDepth)
+                    continue;
+                collapsedDepth = ~0u;
+
+                const bool leaf = i + 1 >= nodes.size() || nodes[i + 1].Depth <= node.Depth || nodes[i + 1].ThreadID != node.ThreadID;
+
+                ImGui::TableNextRow();
+                ImGui::TableNextColumn();
+                ImGui::PushID(static_cast<int>(node.ThreadID));
+                ImGui::PushID(static_cast<int>(node.Depth));
+                ImGui::Indent(static_cast<float>(node.Depth) * ImGui::GetStyle().IndentSpacing);
+                const bool open = ImGui::TreeNodeEx(node.Name, ImGuiTreeNodeFlags_NoTreePushOnOpen | ImGuiTreeNodeFlags_DefaultOpen |
+                                                    (leaf ? ImGuiTreeNodeFlags_Leaf : 0), "%s", node.Name);
+                ImGui::Unindent(static_cast<float>(node.Depth) * ImGui::GetStyle().IndentSpacing);
+                ImGui::PopID();
+                ImGui::PopID();
+                if(!open)
+                    collapsedDepth = node.Depth;
+
+                ImGui::TableNextColumn();
+                ImGui::Text("%.3f", node.TotalMs);
+                ImGui::TableNextColumn();
+                ImGui::Text("%u", node.Calls);
+            }
+
+            ImGui::EndTable();
+        }
+    }
+}
+#endif
+
+void GUI::ShowProfiler()
+{
+#ifdef FERX_PROFILING
+    static bool paused = false;
+    static ProfileFrame pausedFrame;
+    static char tracePath[256] = "profile_trace.json";
+
+    ImGui::Begin(ICON_FA_GAUGE_HIGH" Profiler");
+
+    if(ImGui::Checkbox("Pause", &paused) && paused)
+        pausedFrame = Profiler::GetLastFrame();
+    const ProfileFrame& frame = paused ? pausedFrame : Profiler::GetLastFrame();
+
+    ImGui::SameLine();
+    if(!Profiler::IsCapturing())
+    {
+        if(ImGui::Button("Start Capture"))
+            Profiler::BeginCapture();
+    }
+    else if(ImGui::Button("Stop Capture"))
+    {
+        Profiler::EndCapture();
+    }
+
+    ImGui::SameLine();
+    if(ImGui::Button("Export Trace"))
+    {
+        if(Profiler::ExportChromeTrace(tracePath))
+            LOG_INFO("Profiler", "Exported {} frames to {}", Profiler::GetCapturedFrameCount(), tracePath);
+    }
+    ImGui::InputText("Trace Path", tracePath, sizeof(tracePath));
+
+    ImGui::Text("Frame %llu: %.3f ms", static_cast<unsigned long long>(frame.Index), frame.DurationMs);
+    if(Profiler::IsCapturing())
+        ImGui::Text("Capturing: %zu frames", Profiler::GetCapturedFrameCount());
+    // La GPU va FrameLatency frames por detrás: se compara con su propio frame, no con el actual
+    const GPUFrameTiming& gpuFrame = GPUProfiler::GetLastFrame();
+    if(GPUProfiler::IsAvailable())
+    {
+        ImGui::Text("GPU frame %llu: %.3f ms (%s-bound)", static_cast<unsigned long long>(gpuFrame.Index), gpuFrame.Milliseconds,
+                    gpuFrame.Milliseconds > frame.DurationMs * 0.9 ? "GPU" : "CPU");
+        for(const GPUPassTiming& pass : gpuFrame.Passes)
+        {
+            if(pass.Depth > 0)
+                ImGui::BulletText("%s: %.3f ms", pass.Name, pass.Milliseconds);
+        }
+    }
+    if(Profiler::GetDroppedEvents() > 0)
+        ImGui::Text("Dropped events: %llu", static_cast<unsigned long long>(Profiler::GetDroppedEvents()));
+
+    ShowProfileTree("ProfilerTree", frame);
+
+    ImGui::End();
+#endif
+}
+
+void GUI::ShowMemory()
+{
+#ifdef FERX_PROFILING
+    ImGui::Begin(ICON_FA_MEMORY" Memory");
+
+    const float toKB = 1.0f / 1024.0f;
+    const float toMB = 1.0f / (1024.0f * 1024.0f);
+
+    // Reservas totales de los últimos frames; los picos delatan reservas en el bucle caliente
+    const auto& history = MemoryTracker::GetAllocationHistory();
+    uint64_t frameAllocations = 0, frameBytes = 0;
+    int64_t heapBytes = 0;
+    for(size_t i = 0; i < MemoryTracker::TagCount; i++)
+    {
+        const MemoryTagStats stats = MemoryTracker::GetTagStats(static_cast<MemoryTag>(i));
+        frameAllocations += stats.FrameAllocations;
+        frameBytes += stats.FrameBytes;
+        heapBytes += stats.CurrentBytes;
+    }
+    ImGui::Text("Heap: %.2f MB | %llu allocations (%.1f KB) last frame", heapBytes * toMB,
+                static_cast<unsigned long long>(frameAllocations), frameBytes * toKB);
+    ImGui::PlotLines("Allocs/frame", history.data(), static_cast<int>(history.size()), 0, nullptr, 0.0f, FLT_MAX, ImVec2(0, 60));
+
+    // Memoria temporal por frame: los bloques extra indican que el frame no cupo y se pidió más al heap
+    const FrameAllocatorStats frameArena = FrameAllocator::GetStats();
+    ImGui::Text("Frame arena: %.1f / %.1f KB used | %u overflow blocks | %u threads", frameArena.UsedBytes * toKB,
+                frameArena.CapacityBytes * toKB, frameArena.OverflowBlocks, frameArena.Threads);
+
+    if(ImGui::BeginTable("MemoryTags", 6, ImGuiTableFlags_RowBg | ImGuiTableFlags_BordersInnerV | ImGuiTableFlags_Resizable))
+    {
+        ImGui::TableSetupColumn("Tag");
+        ImGui::TableSetupColumn("Current KB");
+        ImGui::TableSetupColumn("Peak KB");
+        ImGui::TableSetupColumn("Live");
+        ImGui::TableSetupColumn("Allocs/frame");
+        ImGui::TableSetupColumn("KB/frame");
+        ImGui::TableHeadersRow();
+
+        for(size_t i = 0; i < MemoryTracker::TagCount; i++)
+        {
+            const MemoryTagStats stats = MemoryTracker::GetTagStats(static_cast<MemoryTag>(i));
+            ImGui::TableNextRow();
+            ImGui::TableNextColumn();
+            ImGui::Text("%s", stats.Name);
+            ImGui::TableNextColumn();
+            ImGui::Text("%.1f", stats.CurrentBytes * toKB);
+            ImGui::TableNextColumn();
+            ImGui::Text("%.1f", stats.PeakBytes * toKB);
+            ImGui::TableNextColumn();
+            ImGui::Text("%llu", static_cast<unsigned long long>(stats.LiveAllocations));
+            ImGui::TableNextColumn();
+            ImGui::Text("%llu", static_cast<unsigned long long>(stats.FrameAllocations));
+            ImGui::TableNextColumn();
+            ImGui::Text("%.1f", stats.FrameBytes * toKB);
+        }
+        ImGui::EndTable();
+    }
+
+    ImGui::Separator();
+    if(ImGui::BeginTable("GPUMemory", 3, ImGuiTableFlags_RowBg | ImGuiTableFlags_BordersInnerV))
+    {
+        ImGui::TableSetupColumn("GPU");
+        ImGui::TableSetupColumn("Current MB");
+        ImGui::TableSetupColumn("Peak MB");
+        ImGui::TableHeadersRow();
+
+        for(size_t i = 0; i < MemoryTracker::GPUKindCount; i++)
+        {
+            const GPUMemoryStats stats = MemoryTracker::GetGPUStats(static_cast<GPUMemoryKind>(i));
+            ImGui::TableNextRow();
+            ImGui::TableNextColumn();
+            ImGui::Text("%s", stats.Name);
+            ImGui::TableNextColumn();
+            ImGui::Text("%.2f", stats.CurrentBytes * toMB);
+            ImGui::TableNextColumn();
+            ImGui::Text("%.2f", stats.PeakBytes * toMB);
+        }
+        ImGui::EndTable();
+    }
+
+    ImGui::End();
+#endif
+}
+
+void GUI::ShowRenderStats()
+{
+    ImGui::Begin(ICON_FA_CHART_LINE" Render Stats");
+
+    const RenderStats& stats = RenderCounters::GetLastFrame();
+    const float toKB = 1.0f / 1024.0f;
+
+    // Historial por contador para las gráficas; de más antiguo a más reciente
+    const std::vector<RenderStats> history = RenderCounters::GetHistory();
+    std::pmr::memory_resource* frameMemory = FrameAllocator::GetResource();
+    std::pmr::vector<float> drawCalls(frameMemory), triangles(frameMemory), binds(frameMemory), uploadKB(frameMemory);
+    drawCalls.reserve(history.size());
+    triangles.reserve(history.size());
+    binds.reserve(history.size());
+    uploadKB.reserve(history.size());
+    for(const RenderStats& frame : history)
+    {
+        uint32_t frameBinds = 0;
+        for(uint32_t count : frame.Binds)
+            frameBinds += count;
+
+        drawCalls.push_back(static_cast<float>(frame.DrawCalls));
+        triangles.push_back(static_cast<float>(frame.Triangles));
+        binds.push_back(static_cast<float>(frameBinds));
+        uploadKB.push_back((frame.UniformBytes + frame.BufferUploadBytes + frame.TextureUploadBytes) * toKB);
+    }
+
+    ImGui::Text("Draw calls: %u (%u multi-draw ranges) | Instances: %u | Triangles: %llu", stats.DrawCalls,
+                stats.MultiDrawRanges, stats.Instances, static_cast<unsigned long long>(stats.Triangles));
+    ImGui::PlotLines("Draw calls", drawCalls.data(), static_cast<int>(drawCalls.size()), 0, nullptr, 0.0f, FLT_MAX, ImVec2(0, 50));
+    ImGui::PlotLines("Triangles", triangles.data(), static_cast<int>(triangles.size()), 0, nullptr, 0.0f, FLT_MAX, ImVec2(0, 50));
+    ImGui::PlotLines("Binds", binds.data(), static_cast<int>(binds.size()), 0, nullptr, 0.0f, FLT_MAX, ImVec2(0, 50));
+    ImGui::PlotLines("Upload KB", uploadKB.data(), static_cast<int>(uploadKB.size()), 0, nullptr, 0.0f, FLT_MAX, ImVec2(0, 50));
+
+    if(ImGui::BeginTable("RenderBinds", 2, ImGuiTableFlags_RowBg | ImGuiTableFlags_BordersInnerV))
+    {
+        ImGui::TableSetupColumn("Counter");
+        ImGui::TableSetupColumn("Last frame");
+        ImGui::TableHeadersRow();
+
+        // Deja el cursor en la columna del valor
+        auto row = [](const char* name)
+        {
+            ImGui::TableNextRow();
+            ImGui::TableNextColumn();
+            ImGui::Text("%s", name);
+            ImGui::TableNextColumn();
+        };
+
+        for(size_t i = 0; i < static_cast<size_t>(RenderBind::Count); i++)
+        {
+            row(RenderCounters::GetBindName(static_cast<RenderBind>(i)));
+            ImGui::Text("%u binds", stats.Binds[i]);
+        }
+        row("Uniforms");
+        ImGui::Text("%u updates (%.2f KB)", stats.UniformUpdates, stats.UniformBytes * toKB);
+        row("Buffer uploads");
+        ImGui::Text("%.2f KB", stats.BufferUploadBytes * toKB);
+        row("Texture uploads");
+        ImGui::Text("%.2f KB", stats.TextureUploadBytes * toKB);
+        ImGui::EndTable();
+    }
+
+    // Presupuestos por frame (0 = sin límite); los excesos se listan en rojo
+    if(ImGui::CollapsingHeader("Budget"))
+    {
+        RenderBudget budget = RenderCounters::GetBudget();
+        ImGui::InputScalar("Max draw calls", ImGuiDataType_U32, &budget.MaxDrawCalls);
+        ImGui::InputScalar("Max triangles", ImGuiDataType_U64, &budget.MaxTriangles);
+        ImGui::InputScalar("Max state changes", ImGuiDataType_U32, &budget.MaxStateChanges);
+        ImGui::InputScalar("Max upload bytes", ImGuiDataType_U64, &budget.MaxUploadBytes);
+        ImGui::InputScalar("Max FBO switches", ImGuiDataType_U32, &budget.MaxFrameBufferSwitches);
+        RenderCounters::SetBudget(budget);
+
+        for(const std::string& violation : RenderCounters::CheckBudget(stats, budget))
+            ImGui::TextColored(ImVec4(1.0f, 0.35f, 0.35f, 1.0f), "%s", violation.c_str());
+    }
+
+    // Graba los próximos frames para reproducirlos con 'ferx --replay <archivo>'
+    if(ImGui::CollapsingHeader("Capture"))
+    {
+        static char capturePath[256] = "frame.ferxcap";
+        static int captureFrames = 1;
+        ImGui::InputText("Capture Path", capturePath, sizeof(capturePath));
+        ImGui::InputInt("Frames", &captureFrames);
+        captureFrames = std::max(captureFrames, 1);
+
+        if(RenderCapture::IsActive())
+            ImGui::Text("Capturing...");
+        else if(ImGui::Button("Capture Frames"))
+        {
+            RenderCapture::Start(capturePath, static_cast<unsigned int>(captureFrames));
+            LOG_INFO("RenderCapture", "Capturing {} frames to {}", captureFrames, capturePath);
+        }
+    }
+
+    ImGui::End();
+}
+
+void GUI::ShowFrameTimes()
+{
+    ImGui::Begin(ICON_FA_STOPWATCH" Frame Times");
+
+    const std::vector<FrameTiming> history = FrameTimer::GetHistory();
+    const FrameTimeStats cpu = FrameTimer::GetCPUStats();
+    const FrameTimeStats gpu = FrameTimer::GetGPUStats();
+    const FrameTimeStats latency = FrameTimer::GetLatencyStats();
+
+    if(ImGui::BeginTable("FrameTimeStats", 6, ImGuiTableFlags_RowBg | ImGuiTableFlags_BordersInnerV))
+    {
+        ImGui::TableSetupColumn("");
+        ImGui::TableSetupColumn("Mean");
+        ImGui::TableSetupColumn("p50");
+        ImGui::TableSetupColumn("p95");
+        ImGui::TableSetupColumn("p99");
+        ImGui::TableSetupColumn("Max");
+        ImGui::TableHeadersRow();
+
+        auto row = [](const char* name, const FrameTimeStats& stats)
+        {
+            ImGui::TableNextRow();
+            ImGui::TableNextColumn();
+            ImGui::Text("%s", name);
+            for(double value : { stats.MeanMs, stats.P50Ms, stats.P95Ms, stats.P99Ms, stats.MaxMs })
+            {
+                ImGui::TableNextColumn();
+                ImGui::Text("%.2f", value);
+            }
+        };
+        row("Frame", cpu);
+        if(gpu.Samples > 0)
+            row("GPU", gpu);
+        if(latency.Samples > 0)
+            row("Input latency", latency);
+        ImGui::EndTable();
+    }
+
+    // Tiempos en orden y su distribución en cubos de 1 ms; la cola derecha son los tirones
+    std::pmr::memory_resource* frameMemory = FrameAllocator::GetResource();
+    std::pmr::vector<float> cpuTimes(frameMemory), gpuTimes(frameMemory);
+    cpuTimes.reserve(history.size());
+    gpuTimes.reserve(history.size());
+    for(const FrameTiming& frame : history)
+    {
+        cpuTimes.push_back(static_cast<float>(frame.CPUMs));
+        gpuTimes.push_back(static_cast<float>(std::max(frame.GPUMs, 0.0)));
+    }
+
+    const float threshold = static_cast<float>(FrameTimer::GetHitchThreshold());
+    const float plotMax = std::max(static_cast<float>(cpu.MaxMs), threshold) * 1.1f;
+    ImGui::PlotLines("Frame ms", cpuTimes.data(), static_cast<int>(cpuTimes.size()), 0, nullptr, 0.0f, plotMax, ImVec2(0, 60));
+    if(gpu.Samples > 0)
+        ImGui::PlotLines("GPU ms", gpuTimes.data(), static_cast<int>(gpuTimes.size()), 0, nullptr, 0.0f, plotMax, ImVec2(0, 60));
+
+    std::pmr::vector<float> buckets(static_cast<size_t>(std::max(1.0, std::ceil(cpu.MaxMs))), 0.0f, frameMemory);
+    for(float time : cpuTimes)
+        buckets[std::min(buckets.size() - 1, static_cast<size_t>(time))] += 1.0f;
+    ImGui::PlotHistogram("Histogram", buckets.data(), static_cast<int>(buckets.size()), 0, "1 ms buckets", 0.0f, FLT_MAX, ImVec2(0, 60));
+
+    double hitchThreshold = FrameTimer::GetHitchThreshold();
+    ImGui::InputDouble("Hitch threshold (ms)", &hitchThreshold, 1.0, 10.0, "%.1f");
+    FrameTimer::SetHitchThreshold(std::max(hitchThreshold, 0.0));
+
+    // Una fila por frame para analizar la sesión fuera del editor
+    static char logPath[256] = "frame_times.csv";
+    ImGui::InputText("Log Path", logPath, sizeof(logPath));
+    if(!FrameTimer::IsLogging())
+    {
+        if(ImGui::Button("Start Log") && FrameTimer::StartLog(logPath))
+            LOG_INFO("FrameTimer", "Logging frame times to {}", logPath);
+    }
+    else if(ImGui::Button("Stop Log"))
+    {
+        FrameTimer::StopLog();
+        LOG_INFO("FrameTimer", "Frame time log written to {}", logPath);
+    }
+
+    const std::deque<FrameHitch>& hitches = FrameTimer::GetHitches();
+    if(ImGui::CollapsingHeader("Hitches", ImGuiTreeNodeFlags_DefaultOpen))
+    {
+        ImGui::Text("%llu hitches (last %zu kept)", static_cast<unsigned long long>(FrameTimer::GetHitchCount()), hitches.size());
+        ImGui::SameLine();
+        if(ImGui::Button("Clear"))
+            FrameTimer::ClearHitches();
+
+        // Del más reciente al más antiguo; cada uno muestra el árbol del Profiler de su frame
+        for(auto it = hitches.rbegin(); it != hitches.rend(); ++it)
+        {
+            ImGui::PushID(static_cast<int>(it->Frame));
+            if(ImGui::TreeNode("Hitch", "Frame %llu: %.2f ms", static_cast<unsigned long long>(it->Frame), it->Milliseconds))
+            {
+#ifdef FERX_PROFILING
+                ShowProfileTree("HitchTree", it->Profile);
+#endif
+                ImGui::TreePop();
+            }
+            ImGui::PopID();
+        }
+    }
+
+    // Fases del arranque; las de hilos de trabajo se solapan con las del hilo principal
+    if(ImGui::CollapsingHeader("Presentation"))
+    {
+        const PresentMode current = FramePacer::GetMode();
+        if(ImGui::BeginCombo("Mode", FramePacer::GetModeName(current)))
+        {
+            for(int i = 0; i < static_cast<int>(PresentMode::Count); i++)
+            {
+                const auto mode = static_cast<PresentMode>(i);
+                const bool unsupported = mode == PresentMode::Adaptive && !FramePacer::IsAdaptiveSupported();
+                ImGui::BeginDisabled(unsupported);
+                if(ImGui::Selectable(FramePacer::GetModeName(mode), mode == current))
+                    FramePacer::SetMode(mode);
+                ImGui::EndDisabled();
+                if(unsupported && ImGui::IsItemHovered(ImGuiHoveredFlags_AllowWhenDisabled))
+                    ImGui::SetTooltip("EXT_swap_control_tear is not supported by this driver");
+            }
+            ImGui::EndCombo();
+        }
+
+        if(current == PresentMode::Capped)
+        {
+            double targetFPS = FramePacer::GetTargetFPS();
+            if(ImGui::InputDouble("Target FPS", &targetFPS, 10.0, 30.0, "%.1f"))
+                FramePacer::SetTargetFPS(targetFPS);
+        }
+        ImGui::Text("Pacing wait: %.2f ms", FramePacer::GetLastWaitMs());
+
+        ImGui::Checkbox("Render on Demand", &Renderer::GetData().m_OnDemand);
+        if(ImGui::IsItemHovered())
+            ImGui::SetTooltip("Skip the scene pass and wait for events while nothing changes");
+        ImGui::Text("Scene: %s | %llu frames skipped", Editor::IsIdle() ? "idle" : "drawing",
+                    static_cast<unsigned long long>(Renderer::GetData().m_SkippedFrames));
+        if(latency.Samples > 0)
+            ImGui::Text("Input to present: %.2f ms (p99 %.2f ms)", latency.MeanMs, latency.P99Ms);
+    }
+
+    if(ImGui::CollapsingHeader("Simulation"))
+    {
+        double rate = FixedTimestep::GetRate();
+        if(ImGui::InputDouble("Tick Rate (Hz)", &rate, 10.0, 30.0, "%.1f") && rate >= 1.0)
+            FixedTimestep::SetRate(rate);
+
+        int maxSteps = static_cast<int>(FixedTimestep::GetMaxSteps());
+        if(ImGui::SliderInt("Max Steps per Frame", &maxSteps, 1, 32))
+            FixedTimestep::SetMaxSteps(static_cast<unsigned int>(maxSteps));
+
+        ImGui::Text("Steps this frame: %u | alpha %.2f", FixedTimestep::GetLastSteps(), FixedTimestep::GetAlpha());
+        ImGui::Text("Simulated: %.2f s in %llu steps", FixedTimestep::GetSimulationTime(),
+                    static_cast<unsigned long long>(FixedTimestep::GetStepCount()));
+        ImGui::Text("Dropped: %.3f s", FixedTimestep::GetDroppedSeconds());
+    }
+
+    if(ImGui::CollapsingHeader("Startup"))
+    {
+        if(StartupTimer::GetTimeToFirstFrame() >= 0.0)
+            ImGui::Text("Time to first frame: %.2f ms", StartupTimer::GetTimeToFirstFrame());
+
+        if(ImGui::BeginTable("StartupPhases", 3, ImGuiTableFlags_RowBg | ImGuiTableFlags_BordersInnerV))
+        {
+            ImGui::TableSetupColumn("Phase");
+            ImGui::TableSetupColumn("Start ms");
+            ImGui::TableSetupColumn("ms");
+            ImGui::TableHeadersRow();
+
+            for(const StartupPhase& startupPhase : StartupTimer::GetPhases())
+            {
+                ImGui::TableNextRow();
+                ImGui::TableNextColumn();
+                ImGui::Text("%s%s", startupPhase.Name.c_str(), startupPhase.Worker ? " (worker)" : "");
+                ImGui::TableNextColumn();
+                ImGui::Text("%.2f", startupPhase.StartMs);
+                ImGui::TableNextColumn();
+                ImGui::Text("%.2f", startupPhase.DurationMs);
+            }
+            ImGui::EndTable();
+        }
+    }
+
+    ImGui::End();
+}
@@ -0,0 +1,40 @@
+#include "ImGuiOverlay.h"
+
+#include <imgui_impl_opengl3.h>
+
+#include "Profiler.h"
+#include "GPUProfiler.h"
+
+ImGuiOverlay::~ImGuiOverlay()
+{
+    for(ImDrawList* list : m_Lists)
+        IM_DELETE(list);
+}
+
+void ImGuiOverlay::Capture(const ImDrawData& drawData)
+{
+    PROFILE_SCOPE("ImGuiOverlay::Capture");
+
+    // Posición, tamaño y escala del viewport; CmdLists se sustituye por las copias
+    m_DrawData = drawData;
+
+    for(int i = 0; i < drawData.CmdListsCount; i++)
+    {
+        if(static_cast<size_t>(i) == m_Lists.size())
+            m_Lists.push_back(IM_NEW(ImDrawList)(ImGui::GetDrawListSharedData()));
+
+        const ImDrawList* source = drawData.CmdLists[i];
+        ImDrawList* copy = m_Lists[i];
+        copy->CmdBuffer = source->CmdBuffer;
+        copy->IdxBuffer = source->IdxBuffer;
+        copy->VtxBuffer = source->VtxBuffer;
+        copy->Flags = source->Flags;
+        m_DrawData.CmdLists[i] = copy;
+    }
+}
+
+void ImGuiOverlay::Render()
+{
+    PROFILE_GPU_SCOPE("ImGui");
+    ImGui_ImplOpenGL3_RenderDrawData(&m_DrawData);
+}
@@ -1,10 +1,134 @@
-#include <iostream>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
 #include "Editor.h"
+#include "RenderReplay.h"
+#include "FrameTimer.h"
+#include "StartupTimer.h"
+#include "Log.h"
+
+static void PrintFrameStats(const HeadlessStats& stats)
+{
+    std::printf("First frame %.3f ms | mean %.3f ms | median %.3f ms | p99 %.3f ms | min %.3f ms | max %.3f ms | %.1f FPS\n",
+                stats.FirstFrameMs, stats.MeanMs, stats.MedianMs, stats.P99Ms, stats.MinMs, stats.MaxMs,
+                stats.MeanMs > 0.0 ? 1000.0 / stats.MeanMs : 0.0);
+}
+
+// Modo headless: --headless [--frames N] [--size WxH] [--capture file [--capture-frames N]] [--frame-log file.csv]
+// Renderiza N frames en el FrameBuffer con un contexto EGL, sin ventana ni ImGui, e imprime los tiempos.
+// Con --capture graba los primeros frames para reproducirlos después con --replay.
+// Con --frame-log escribe el tiempo de cada frame en CSV (FrameTimer).
+static int RunHeadless(int argc, char** argv)
+{
+    unsigned int frames = 300;
+    unsigned int captureFrames = 1;
+    std::string capturePath;
+    std::string frameLogPath;
+    WindowData windowData("Codazzi Engine", 1280, 720);
+    windowData.Headless = true;
+
+    for (int i = 1; i < argc; i++)
+    {
+        if (std::strcmp(argv[i], "--frames") == 0 && i + 1 < argc)
+            frames = static_cast<unsigned int>(std::strtoul(argv[++i], nullptr, 10));
+        else if (std::strcmp(argv[i], "--size") == 0 && i + 1 < argc)
+            std::sscanf(argv[++i], "%dx%d", &windowData.Size.Width, &windowData.Size.Height);
+        else if (std::strcmp(argv[i], "--capture") == 0 && i + 1 < argc)
+            capturePath = argv[++i];
+        else if (std::strcmp(argv[i], "--capture-frames") == 0 && i + 1 < argc)
+            captureFrames = static_cast<unsigned int>(std::strtoul(argv[++i], nullptr, 10));
+        else if (std::strcmp(argv[i], "--frame-log") == 0 && i + 1 < argc)
+            frameLogPath = argv[++i];
+    }
+
+    Engine engine(windowData);
+    if (!engine.IsInitialized())
+    {
+        LOG_ERROR("Editor", "Headless initialization failed");
+        return 1;
+    }
+
+    if (!capturePath.empty())
+        RenderCapture::Start(capturePath, captureFrames);
+    if (!frameLogPath.empty() && !FrameTimer::StartLog(frameLogPath))
+        return 1;
+
+    const HeadlessStats stats = Engine::RunHeadless(frames);
+    FrameTimer::StopLog();
+    std::printf("Rendered %u frames at %dx%d in %.2f ms\n", stats.Frames, windowData.Size.Width, windowData.Size.Height, stats.TotalMs);
+    PrintFrameStats(stats);
+    if (FrameTimer::GetHitchCount() > 0)
+        std::printf("%llu frames over the %.1f ms hitch threshold\n",
+                    static_cast<unsigned long long>(FrameTimer::GetHitchCount()), FrameTimer::GetHitchThreshold());
+    StartupTimer::PrintReport();
+
+    if (RenderCapture::IsActive())
+    {
+        LOG_ERROR("Editor", "Render capture incomplete: fewer frames rendered than requested");
+        return 1;
+    }
+    return 0;
+}
+
+// Modo replay: --replay file [--repeat N]
+// Reproduce una captura en un contexto EGL sin escena, editor ni recursos en disco.
+static int RunReplay(int argc, char** argv)
+{
+    std::string path;
+    unsigned int repeat = 10;
+    for (int i = 1; i < argc; i++)
+    {
+        if (std::strcmp(argv[i], "--replay") == 0 && i + 1 < argc)
+            path = argv[++i];
+        else if (std::strcmp(argv[i], "--repeat") == 0 && i + 1 < argc)
+            repeat = static_cast<unsigned int>(std::strtoul(argv[++i], nullptr, 10));
+    }
+
+    RenderReplay replay;
+    if (path.empty() || !replay.Load(path))
+        return 1;
+
+    WindowData windowData("Codazzi Engine Replay", replay.GetWidth(), replay.GetHeight());
+    windowData.Headless = true;
+    Window window(windowData);
+    if (!window.IsValid() || !gladLoadGLLoader(window.GetProcLoader()))
+    {
+        LOG_ERROR("Editor", "Replay initialization failed");
+        return 1;
+    }
+
+    std::printf("Capture: %u frames at %dx%d, recorded on %s (%s)\n", replay.GetFrameCount(), replay.GetWidth(), replay.GetHeight(),
+                replay.GetRenderer().c_str(), replay.GetVendor().c_str());
+    std::printf("Replaying on %s (%s)\n", reinterpret_cast<const char*>(glGetString(GL_RENDERER)),
+                reinterpret_cast<const char*>(glGetString(GL_VENDOR)));
+
+    const HeadlessStats stats = HeadlessStats::FromFrameTimes(replay.Run(repeat));
+    replay.Shutdown();
+
+    std::printf("Replayed %u frames (%u passes) in %.2f ms\n", stats.Frames, repeat, stats.TotalMs);
+    PrintFrameStats(stats);
+    return stats.Frames > 0 ? 0 : 1;
+}
 
 int main(int argc, char** argv)
 {
+    // --log file: copia todos los mensajes del registro a un archivo, en cualquier modo
+    for (int i = 1; i + 1 < argc; i++)
+    {
+        if (std::strcmp(argv[i], "--log") == 0)
+            Log::OpenFile(argv[i + 1]);
+    }
+
+    for (int i = 1; i < argc; i++)
+    {
+        if (std::strcmp(argv[i], "--headless") == 0)
+            return RunHeadless(argc, argv);
+        if (std::strcmp(argv[i], "--replay") == 0)
+            return RunReplay(argc, argv);
+    }
+
     Editor::Init();
-    std::cout << "Argument count: " << argc << std::endl;
+    LOG_DEBUG("Editor", "Argument count: {}", argc);
     for(int i = 0; i < argc; i++)
-        std::cout << "Arguments: " << argv[i] << std::endl;
-}
\ No newline at end of file
+        LOG_DEBUG("Editor", "Arguments: {}", argv[i]);
+}
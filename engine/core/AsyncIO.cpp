@@ -0,0 +1,557 @@
+#include "AsyncIO.h"
+#include "ThreadPool.h"
+#include "MemoryTracker.h"
+#include "Profiler.h"
+#include "Log.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cerrno>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+
+#if defined(__linux__) && __has_include(<linux/io_uring.h>)
+#define FERX_IO_URING
+#include <fcntl.h>
+#include <linux/io_uring.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/syscall.h>
+#include <sys/uio.h>
+#include <unistd.h>
+#endif
+
+struct AsyncIO::Pending
+{
+    FileReadRequest Request;
+    Callback Complete;
+    FileReadResult Result;
+
+    unsigned char* Destination = nullptr;
+    size_t Length = 0;
+#ifdef FERX_IO_URING
+    int File = -1;
+    iovec Vector{};
+#endif
+};
+
+#ifdef FERX_IO_URING
+// Anillos de envío (SQ) y de compleción (CQ) compartidos con el kernel. Solo los usa el hilo de E/S.
+struct AsyncIO::Ring
+{
+    int Fd = -1;
+    unsigned int Entries = 0;
+
+    void* SqMemory = MAP_FAILED;
+    size_t SqMemorySize = 0;
+    void* CqMemory = MAP_FAILED;
+    size_t CqMemorySize = 0;
+    io_uring_sqe* Sqes = static_cast<io_uring_sqe*>(MAP_FAILED);
+    size_t SqesSize = 0;
+
+    unsigned* SqHead{};
+    unsigned* SqTail{};
+    unsigned* SqMask{};
+    unsigned* SqArray{};
+    unsigned* CqHead{};
+    unsigned* CqTail{};
+    unsigned* CqMask{};
+    io_uring_cqe* Cqes{};
+
+    // Lecturas enviadas al kernel sin compleción todavía, y preparadas sin enviar
+    unsigned int InFlight = 0;
+    unsigned int Unsubmitted = 0;
+
+    bool Init(unsigned int entries)
+    {
+        io_uring_params params{};
+        Fd = static_cast<int>(syscall(__NR_io_uring_setup, entries, &params));
+        if (Fd < 0)
+            return false;
+        Entries = params.sq_entries;
+
+        SqMemorySize = params.sq_off.array + params.sq_entries * sizeof(unsigned);
+        CqMemorySize = params.cq_off.cqes + params.cq_entries * sizeof(io_uring_cqe);
+        // Kernels >= 5.4 comparten una sola proyección para los dos anillos
+        const bool singleMap = (params.features & IORING_FEAT_SINGLE_MMAP) != 0;
+        if (singleMap)
+            SqMemorySize = CqMemorySize = std::max(SqMemorySize, CqMemorySize);
+
+        SqMemory = mmap(nullptr, SqMemorySize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, Fd, IORING_OFF_SQ_RING);
+        if (SqMemory == MAP_FAILED)
+            return false;
+        CqMemory = singleMap ? SqMemory
+                             : mmap(nullptr, CqMemorySize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, Fd, IORING_OFF_CQ_RING);
+        if (CqMemory == MAP_FAILED)
+            return false;
+        SqesSize = params.sq_entries * sizeof(io_uring_sqe);
+        Sqes = static_cast<io_uring_sqe*>(mmap(nullptr, SqesSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, Fd, IORING_OFF_SQES));
+        if (Sqes == MAP_FAILED)
+            return false;
+
+        auto* sq = static_cast<unsigned char*>(SqMemory);
+        SqHead = reinterpret_cast<unsigned*>(sq + params.sq_off.head);
+        SqTail = reinterpret_cast<unsigned*>(sq + params.sq_off.tail);
+        SqMask = reinterpret_cast<unsigned*>(sq + params.sq_off.ring_mask);
+        SqArray = reinterpret_cast<unsigned*>(sq + params.sq_off.array);
+        auto* cq = static_cast<unsigned char*>(CqMemory);
+        CqHead = reinterpret_cast<unsigned*>(cq + params.cq_off.head);
+        CqTail = reinterpret_cast<unsigned*>(cq + params.cq_off.tail);
+        CqMask = reinterpret_cast<unsigned*>(cq + params.cq_off.ring_mask);
+        Cqes = reinterpret_cast<io_uring_cqe*>(cq + params.cq_off.cqes);
+        return true;
+    }
+
+    ~Ring()
+    {
+        if (Sqes != MAP_FAILED)
+            munmap(Sqes, SqesSize);
+        if (CqMemory != MAP_FAILED && CqMemory != SqMemory)
+            munmap(CqMemory, CqMemorySize);
+        if (SqMemory != MAP_FAILED)
+            munmap(SqMemory, SqMemorySize);
+        if (Fd >= 0)
+            close(Fd);
+    }
+
+    void PushRead(Pending& pending)
+    {
+        const unsigned tail = *SqTail;
+        const unsigned index = tail & *SqMask;
+        io_uring_sqe& sqe = Sqes[index];
+        std::memset(&sqe, 0, sizeof(sqe));
+        // READV existe desde el 5.1; READ (5.6) no aporta nada para un solo búfer
+        sqe.opcode = IORING_OP_READV;
+        sqe.fd = pending.File;
+        sqe.addr = reinterpret_cast<uint64_t>(&pending.Vector);
+        sqe.len = 1;
+        sqe.off = pending.Request.Offset + pending.Result.BytesRead;
+        sqe.user_data = reinterpret_cast<uint64_t>(&pending);
+        SqArray[index] = index;
+        // El kernel no debe ver la cola nueva antes que la entrada
+        __atomic_store_n(SqTail, tail + 1, __ATOMIC_RELEASE);
+        Unsubmitted++;
+    }
+
+    // Envía lo preparado y, si hay lecturas en curso, espera al menos una compleción.
+    // Devuelve 0, o el errno de un fallo que no se arregla reintentando.
+    int Submit()
+    {
+        const unsigned int toSubmit = Unsubmitted;
+        const unsigned int waitFor = (InFlight + toSubmit) > 0 ? 1 : 0;
+        if (toSubmit == 0 && waitFor == 0)
+            return 0;
+
+        const int submitted = static_cast<int>(syscall(__NR_io_uring_enter, Fd, toSubmit, waitFor, IORING_ENTER_GETEVENTS, nullptr, 0));
+        if (submitted < 0)
+        {
+            // EINTR: señal durante la espera; lo no enviado sigue en la cola para el siguiente intento
+            if (errno == EINTR || errno == EAGAIN || errno == EBUSY)
+                return 0;
+            return errno;
+        }
+        Unsubmitted -= static_cast<unsigned int>(submitted);
+        InFlight += static_cast<unsigned int>(submitted);
+        return 0;
+    }
+
+    // Retira de la SQ las lecturas que el kernel aún no ha consumido
+    std::vector<Pending*> TakeUnsubmitted()
+    {
+        std::vector<Pending*> pending;
+        const unsigned head = __atomic_load_n(SqHead, __ATOMIC_ACQUIRE);
+        const unsigned tail = *SqTail;
+        for (unsigned i = head; i != tail; i++)
+            pending.push_back(reinterpret_cast<Pending*>(Sqes[SqArray[i & *SqMask]].user_data));
+        __atomic_store_n(SqTail, head, __ATOMIC_RELEASE);
+        Unsubmitted = 0;
+        return pending;
+    }
+
+    template<typename F>
+    void Reap(F&& onCompletion)
+    {
+        unsigned head = *CqHead;
+        const unsigned tail = __atomic_load_n(CqTail, __ATOMIC_ACQUIRE);
+        while (head != tail)
+        {
+            const io_uring_cqe& cqe = Cqes[head & *CqMask];
+            auto* pending = reinterpret_cast<Pending*>(cqe.user_data);
+            const int result = cqe.res;
+            head++;
+            InFlight--;
+            onCompletion(*pending, result);
+        }
+        __atomic_store_n(CqHead, head, __ATOMIC_RELEASE);
+    }
+};
+#else
+struct AsyncIO::Ring
+{
+};
+#endif
+
+AsyncIO::AsyncIO()
+{
+#ifdef FERX_IO_URING
+    auto ring = std::make_unique<Ring>();
+    if (ring->Init(QueueDepth))
+    {
+        m_Ring = std::move(ring);
+        m_Thread = std::thread(&AsyncIO::Run, this);
+        return;
+    }
+    // Kernels anteriores al 5.1 o io_uring deshabilitado (seccomp, kernel.io_uring_disabled)
+    LOG_WARNING("AsyncIO", "io_uring unavailable ({}), falling back to worker threads", std::strerror(errno));
+#endif
+    m_Fallback = std::make_unique<ThreadPool>(2);
+}
+
+AsyncIO::~AsyncIO()
+{
+    Shutdown();
+}
+
+void AsyncIO::Shutdown()
+{
+    {
+        std::lock_guard<std::mutex> lock(m_Mutex);
+        m_Stopping = true;
+    }
+    m_Condition.notify_all();
+    if (m_Thread.joinable())
+        m_Thread.join();
+    if (m_Fallback)
+        m_Fallback->Shutdown();
+}
+
+bool AsyncIO::IsUsingIoUring() const
+{
+    std::lock_guard<std::mutex> lock(m_Mutex);
+    return m_Ring != nullptr && !m_Fallback;
+}
+
+AsyncIO& AsyncIO::Get()
+{
+    static AsyncIO io;
+    return io;
+}
+
+size_t AsyncIO::GetFileSize(const std::string& path)
+{
+    std::error_code error;
+    const auto size = std::filesystem::file_size(path, error);
+    return error ? 0 : static_cast<size_t>(size);
+}
+
+std::future<FileReadResult> AsyncIO::Read(FileReadRequest request)
+{
+    std::vector<FileReadRequest> requests;
+    requests.push_back(std::move(request));
+    return std::move(ReadBatch(std::move(requests)).front());
+}
+
+std::future<FileReadResult> AsyncIO::Read(const std::string& path)
+{
+    FileReadRequest request;
+    request.Path = path;
+    return Read(std::move(request));
+}
+
+void AsyncIO::Read(FileReadRequest request, Callback callback)
+{
+    std::vector<Pending*> pending{ new Pending{ std::move(request), std::move(callback), {} } };
+    Enqueue(pending);
+}
+
+std::vector<std::future<FileReadResult>> AsyncIO::ReadBatch(std::vector<FileReadRequest> requests)
+{
+    std::vector<std::future<FileReadResult>> results;
+    std::vector<Pending*> pending;
+    results.reserve(requests.size());
+    pending.reserve(requests.size());
+
+    for (FileReadRequest& request : requests)
+    {
+        // std::function exige callbacks copiables; la promesa no lo es
+        auto promise = std::make_shared<std::promise<FileReadResult>>();
+        results.push_back(promise->get_future());
+        pending.push_back(new Pending{ std::move(request), [promise](FileReadResult&& result) {
+            promise->set_value(std::move(result));
+        }, {} });
+    }
+    Enqueue(pending);
+    return results;
+}
+
+void AsyncIO::Enqueue(std::vector<Pending*>& pending)
+{
+    // El pool no se destruye hasta Shutdown: basta con leer el puntero bajo el mutex
+    ThreadPool* fallback = nullptr;
+    {
+        std::lock_guard<std::mutex> lock(m_Mutex);
+        fallback = m_Fallback.get();
+        if (!fallback)
+            m_Queue.insert(m_Queue.end(), pending.begin(), pending.end());
+    }
+    if (!fallback)
+    {
+        m_Condition.notify_one();
+        return;
+    }
+
+    for (Pending* request : pending)
+        fallback->Submit([request]() {
+            ReadBlocking(*request);
+            Finish(request);
+        });
+}
+
+// Destino y longitud de la lectura; reserva el búfer si la petición no trae uno
+static bool PrepareDestination(FileReadRequest& request, FileReadResult& result, size_t fileSize,
+                               unsigned char*& destination, size_t& length)
+{
+    if (request.Offset > fileSize)
+    {
+        result.Error = EINVAL;
+        return false;
+    }
+
+    length = fileSize - static_cast<size_t>(request.Offset);
+    if (request.Buffer)
+    {
+        length = std::min(length, request.Size);
+        destination = static_cast<unsigned char*>(request.Buffer);
+        return true;
+    }
+
+    result.Data.resize(length);
+    destination = result.Data.data();
+    return true;
+}
+
+#ifdef FERX_IO_URING
+bool AsyncIO::Open(Pending& pending)
+{
+    FileReadResult& result = pending.Result;
+    result.Path = pending.Request.Path;
+
+    pending.File = open(pending.Request.Path.c_str(), O_RDONLY | O_CLOEXEC);
+    struct stat info{};
+    if (pending.File < 0 || fstat(pending.File, &info) != 0)
+    {
+        result.Error = errno;
+        return false;
+    }
+    if (!PrepareDestination(pending.Request, result, static_cast<size_t>(info.st_size), pending.Destination, pending.Length))
+        return false;
+
+    if (pending.Length == 0)
+    {
+        result.Success = true;
+        return false;
+    }
+    Prepare(pending);
+    return true;
+}
+
+void AsyncIO::Prepare(Pending& pending)
+{
+    pending.Vector.iov_base = pending.Destination + pending.Result.BytesRead;
+    pending.Vector.iov_len = pending.Length - pending.Result.BytesRead;
+    m_Ring->PushRead(pending);
+}
+
+void AsyncIO::Run()
+{
+    PROFILE_THREAD("AsyncIO");
+    MEMORY_TAG(Core);
+
+    Ring& ring = *m_Ring;
+    std::vector<Pending*> incoming;
+
+    for (;;)
+    {
+        {
+            std::unique_lock<std::mutex> lock(m_Mutex);
+            // Con lecturas en curso no se duerme aquí sino en io_uring_enter
+            if (ring.InFlight == 0 && ring.Unsubmitted == 0)
+                m_Condition.wait(lock, [this]() { return m_Stopping || !m_Queue.empty(); });
+            // Al parar se terminan las lecturas encoladas: nadie debe quedarse esperando un future
+            if (m_Stopping && m_Queue.empty() && ring.InFlight == 0 && ring.Unsubmitted == 0)
+                break;
+
+            while (!m_Queue.empty() && ring.InFlight + ring.Unsubmitted + incoming.size() < ring.Entries)
+            {
+                incoming.push_back(m_Queue.front());
+                m_Queue.pop_front();
+            }
+        }
+
+        // Abrir es bloqueante pero corto; la lectura, que es lo caro, va al kernel
+        for (Pending* pending : incoming)
+        {
+            if (!Open(*pending))
+                Finish(pending);
+        }
+        incoming.clear();
+
+        PROFILE_SCOPE("AsyncIO::Submit");
+        if (const int error = ring.Submit())
+        {
+            FallBack(error);
+            return;
+        }
+        ring.Reap([this](Pending& pending, int bytes) {
+            if (bytes < 0)
+            {
+                pending.Result.Error = -bytes;
+                Finish(&pending);
+                return;
+            }
+
+            pending.Result.BytesRead += static_cast<size_t>(bytes);
+            if (pending.Result.BytesRead < pending.Length)
+            {
+                // Lectura corta (señal, archivo que encoge o más de 2 GB): se pide el resto
+                if (bytes > 0)
+                {
+                    Prepare(pending);
+                    return;
+                }
+                // Fin de archivo antes de lo esperado: error, igual que en ReadBlocking
+                pending.Result.Error = EIO;
+                Finish(&pending);
+                return;
+            }
+            pending.Result.Success = true;
+            Finish(&pending);
+        });
+    }
+}
+
+void AsyncIO::FallBack(int error)
+{
+    LOG_ERROR("AsyncIO", "io_uring_enter failed ({}), falling back to worker threads", std::strerror(error));
+
+    Ring& ring = *m_Ring;
+    std::vector<Pending*> retry = ring.TakeUnsubmitted();
+
+    // Lo ya enviado escribe en los búferes de las peticiones: no se sueltan hasta su compleción,
+    // que llega al CQ sin más llamadas a io_uring_enter
+    while (ring.InFlight > 0)
+    {
+        ring.Reap([&retry](Pending& pending, int bytes) {
+            if (bytes < 0)
+                pending.Result.Error = -bytes;
+            else
+                pending.Result.BytesRead += static_cast<size_t>(bytes);
+
+            if (bytes > 0 && pending.Result.BytesRead < pending.Length)
+                retry.push_back(&pending);
+            else
+            {
+                pending.Result.Success = bytes >= 0 && pending.Result.BytesRead == pending.Length;
+                if (bytes == 0 && !pending.Result.Success)
+                    pending.Result.Error = EIO;
+                Finish(&pending);
+            }
+        });
+        if (ring.InFlight > 0)
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+
+    ThreadPool* fallback = nullptr;
+    {
+        std::lock_guard<std::mutex> lock(m_Mutex);
+        m_Fallback = std::make_unique<ThreadPool>(2);
+        fallback = m_Fallback.get();
+        retry.insert(retry.end(), m_Queue.begin(), m_Queue.end());
+        m_Queue.clear();
+    }
+
+    for (Pending* request : retry)
+    {
+        // ReadBlocking empieza de cero con su propio archivo
+        if (request->File >= 0)
+            close(request->File);
+        request->File = -1;
+        request->Result = FileReadResult{};
+        fallback->Submit([request]() {
+            ReadBlocking(*request);
+            Finish(request);
+        });
+    }
+}
+#else
+bool AsyncIO::Open(Pending& pending)
+{
+    return false;
+}
+
+void AsyncIO::Prepare(Pending& pending)
+{
+}
+
+void AsyncIO::Run()
+{
+}
+
+void AsyncIO::FallBack(int error)
+{
+}
+#endif
+
+void AsyncIO::ReadBlocking(Pending& pending)
+{
+    FileReadResult& result = pending.Result;
+    result.Path = pending.Request.Path;
+
+    // ifstream abre directorios y su tellg da un tamaño absurdo: se rechazan como en io_uring
+    std::error_code error;
+    if (std::filesystem::is_directory(pending.Request.Path, error))
+    {
+        result.Error = EISDIR;
+        return;
+    }
+    std::ifstream file(pending.Request.Path, std::ios::binary | std::ios::ate);
+    if (!file.is_open())
+    {
+        result.Error = ENOENT;
+        return;
+    }
+    // tellg devuelve -1 si falla: convertido a size_t sería un tamaño enorme
+    const std::streamoff end = file.tellg();
+    if (end < 0)
+    {
+        result.Error = EIO;
+        return;
+    }
+    const auto fileSize = static_cast<size_t>(end);
+    if (!PrepareDestination(pending.Request, result, fileSize, pending.Destination, pending.Length))
+        return;
+
+    file.seekg(static_cast<std::streamoff>(pending.Request.Offset));
+    file.read(reinterpret_cast<char*>(pending.Destination), static_cast<std::streamsize>(pending.Length));
+    result.BytesRead = static_cast<size_t>(file.gcount());
+    result.Success = result.BytesRead == pending.Length;
+    if (!result.Success)
+        result.Error = EIO;
+}
+
+void AsyncIO::Finish(Pending* pending)
+{
+#ifdef FERX_IO_URING
+    if (pending->File >= 0)
+        close(pending->File);
+#endif
+    FileReadResult& result = pending->Result;
+    if (pending->Request.Buffer)
+        result.m_External = pending->Destination;
+    else
+        result.Data.resize(result.BytesRead);
+
+    pending->Complete(std::move(result));
+    delete pending;
+}
@@ -0,0 +1,106 @@
+#pragma once
+
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+class ThreadPool;
+
+struct FileReadRequest
+{
+    std::string Path;
+    // Búfer del llamador donde se leen los bytes directamente (p. ej. la memoria que luego
+    // adopta el decodificador). Si es nullptr se reserva uno del tamaño del archivo.
+    void* Buffer = nullptr;
+    // Capacidad de 'Buffer'; se leen como mucho estos bytes
+    size_t Size = 0;
+    uint64_t Offset = 0;
+};
+
+struct FileReadResult
+{
+    std::string Path;
+    bool Success = false;
+    // errno del fallo (0 si se leyó)
+    int Error = 0;
+    size_t BytesRead = 0;
+    // Bytes leídos cuando la petición no traía búfer
+    std::vector<unsigned char> Data;
+
+    // Dónde quedaron los bytes: Data o el búfer de la petición
+    const unsigned char* GetBytes() const { return m_External ? m_External : Data.data(); }
+
+private:
+    friend class AsyncIO;
+    unsigned char* m_External = nullptr;
+};
+
+// Lecturas de archivos asíncronas. En Linux un hilo propio las envía por lotes a io_uring (con las
+// llamadas al sistema directamente, sin liburing); si el kernel no lo permite, o en otras
+// plataformas, las lee un ThreadPool propio con lecturas bloqueantes.
+// Los callbacks se ejecutan en el hilo de E/S o en un hilo de trabajo: no deben tocar OpenGL
+// y deben ser cortos, porque retrasan las demás lecturas.
+class AsyncIO
+{
+public:
+    using Callback = std::function<void(FileReadResult&& result)>;
+
+    // Lecturas en curso a la vez en el anillo de io_uring
+    static constexpr unsigned int QueueDepth = 64;
+
+    AsyncIO();
+    ~AsyncIO();
+
+    AsyncIO(const AsyncIO&) = delete;
+    AsyncIO& operator=(const AsyncIO&) = delete;
+
+    std::future<FileReadResult> Read(FileReadRequest request);
+    std::future<FileReadResult> Read(const std::string& path);
+    void Read(FileReadRequest request, Callback callback);
+    // Todas las peticiones entran en el mismo envío al kernel
+    std::vector<std::future<FileReadResult>> ReadBatch(std::vector<FileReadRequest> requests);
+
+    // Termina las lecturas pendientes y espera al hilo de E/S
+    void Shutdown();
+
+    // Falso también si io_uring falló en marcha y las lecturas pasaron al ThreadPool
+    bool IsUsingIoUring() const;
+
+    // Tamaño para reservar el búfer de una petición; 0 si no existe
+    static size_t GetFileSize(const std::string& path);
+
+    // Servicio compartido del motor; se crea con el primer uso
+    static AsyncIO& Get();
+
+private:
+    struct Ring;
+    struct Pending;
+
+    void Enqueue(std::vector<Pending*>& pending);
+    void Run();
+    // Error permanente de io_uring: lo pendiente y lo que llegue después se lee con el ThreadPool
+    void FallBack(int error);
+    // Abre el archivo y prepara la primera lectura; falso si ya terminó (error o archivo vacío)
+    bool Open(Pending& pending);
+    void Prepare(Pending& pending);
+    static void Finish(Pending* pending);
+    static void ReadBlocking(Pending& pending);
+
+    std::unique_ptr<Ring> m_Ring;
+    // Protegido por m_Mutex: el hilo de E/S lo crea si io_uring deja de funcionar
+    std::unique_ptr<ThreadPool> m_Fallback;
+
+    std::thread m_Thread;
+    mutable std::mutex m_Mutex;
+    std::condition_variable m_Condition;
+    std::deque<Pending*> m_Queue;
+    bool m_Stopping = false;
+};
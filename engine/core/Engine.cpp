@@ -5,26 +5,69 @@
 #include "Renderer.h"
 // Incluye la cabecera de Window para la creación de la instancia de Window.
 #include "Window.h"
-// Incluye iostream para mensajes de depuración si se desea, aunque no se usará LOG_INFO/ERROR aquí.
-#include <iostream>
+// Registro del motor (LOG_INFO/LOG_ERROR).
+#include "Log.h"
+// Profiler de CPU; en builds de shipping sus macros quedan vacías.
+#include "Profiler.h"
+// Tiempos de GPU por frame en el modo headless.
+#include "GPUProfiler.h"
+// Etiquetas de memoria y cierre de frame del MemoryTracker.
+#include "MemoryTracker.h"
+// Historial de tiempos por frame (log CSV y tirones).
+#include "FrameTimer.h"
+// Fases del arranque y tiempo hasta el primer frame.
+#include "StartupTimer.h"
+// Reloj de simulación a paso fijo.
+#include "FixedTimestep.h"
+// Entrada por eventos: cola de GLFW y estado por frame.
+#include "Input.h"
+// Memoria temporal por frame (paquete de escena, listas de la GUI).
+#include "FrameAllocator.h"
+
+// Estadísticas de tiempos del modo headless.
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <utility>
+#include <vector>
 
 // Inicialización del puntero estático a la instancia del motor.
 // Esto es parte del patrón Singleton.
 Engine* Engine::s_Instance = nullptr;
 
 // --- CONSTRUCTOR ---
-Engine::Engine()
+// Sin argumentos se usa la ventana por defecto del editor.
+Engine::Engine() : Engine(WindowData{})
+{
+}
+
+// Crea el motor con una ventana configurada por el llamador (título, tamaño, visibilidad).
+Engine::Engine(const WindowData& windowData)
 {
+    // Fase del arranque que incluye la ventana y el renderizador
+    StartupScope phase("Engine");
+
     // Asigna la instancia actual al puntero estático, haciendo de esta la única instancia del motor.
     s_Instance = this;
 
+#ifdef FERX_PROFILING
+    // Registra el hilo principal y calibra el reloj antes de cualquier PROFILE_SCOPE.
+    Profiler::Init();
+#endif
+
     // Crea una nueva instancia de la ventana dinámicamente.
     // Esta ventana será gestionada por el motor.
-    m_Window = new Window();
+    m_Window = new Window(windowData);
+
+    // Sin contexto de OpenGL (p. ej. sin servidor gráfico ni EGL) no se puede seguir.
+    if (!m_Window->IsValid()) {
+        LOG_ERROR("Engine", "Failed to create an OpenGL context");
+        return;
+    }
 
     // Inicializa el subsistema de renderizado.
     // Se asume que Renderer::Init() configura OpenGL y otros aspectos de renderizado.
-    Renderer::Init();
+    m_Initialized = Renderer::Init();
 }
 
 // --- DESTRUCTOR ---
@@ -37,14 +80,98 @@ Engine::~Engine()
 
 // --- MÉTODO RUN (ESTÁTICO) ---
 // Este método es el bucle principal del motor, según la declaración en Engine.h.
-// Actualmente, solo llama a Renderer::Render().
-// Si el motor tiene una lógica de actualización interna (física, IA, etc.),
-// debería ir aquí o en un método Update() llamado desde aquí.
+// Prepara el frame con Update (simulación a paso fijo) y lo dibuja en este mismo hilo.
+// Es el camino del modo headless; el editor reparte las dos mitades entre dos hilos (RenderThread).
 void Engine::Run()
 {
-    // Llama a la función de renderizado del subsistema Renderer.
+    PROFILE_SCOPE("Engine::Run");
+    MEMORY_TAG(Core);
+
+    ScenePacket& packet = Renderer::GetData().m_Packet;
+    // En un solo hilo no hay nada en curso entre frames: las cargas terminadas se aplican aquí
+    Renderer::ApplyPendingResources();
+    Update(packet);
+
+    // Llama a la función de dibujo del subsistema Renderer.
     // Esto es lo que dibuja la escena 3D.
-    Renderer::Render();
+    Renderer::Submit(packet);
+}
+
+// --- MÉTODO UPDATE (ESTÁTICO) ---
+// Parte del frame del hilo principal: simulación, entrada, cámara y selección de lo visible.
+// La simulación avanza en pasos fijos (FixedTimestep) independientes de la frecuencia de frames;
+// el dibujo interpola entre los dos últimos pasos. El resultado queda en 'packet' y no se llama a OpenGL.
+void Engine::Update(ScenePacket& packet)
+{
+    PROFILE_SCOPE("Engine::Update");
+    MEMORY_TAG(Core);
+
+    // Recicla la memoria temporal del frame más antiguo; el paquete que aún dibuja el hilo de render no se toca
+    FrameAllocator::BeginFrame();
+
+    // Aplica los eventos de teclado y ratón que llegaron desde el frame anterior
+    Input::BeginFrame();
+
+    const unsigned int steps = FixedTimestep::Advance();
+    const auto step = static_cast<float>(FixedTimestep::GetStep());
+    for (unsigned int i = 0; i < steps; i++)
+        Renderer::Simulate(step);
+
+    Renderer::Update(packet, FixedTimestep::GetAlpha());
+}
+
+// --- MÉTODO RUNHEADLESS (ESTÁTICO) ---
+// Bucle fijo para CI y renderizado por lotes: sin GUI, sin eventos y sin intercambio de búferes.
+// Cada frame termina con glFinish para que su tiempo incluya el trabajo de la GPU.
+HeadlessStats Engine::RunHeadless(unsigned int frameCount)
+{
+    if (!Engine::Get() || !Engine::Get()->m_Initialized || frameCount == 0)
+        return {};
+
+    std::vector<double> frameTimes;
+    frameTimes.reserve(frameCount);
+
+    for (unsigned int i = 0; i < frameCount; i++) {
+        const auto start = std::chrono::steady_clock::now();
+
+        // Mismo orden que Editor::Run para que los profilers cierren cada frame
+        PROFILE_FRAME_BEGIN();
+        PROFILE_GPU_FRAME_BEGIN();
+        Run();
+        PROFILE_GPU_FRAME_END();
+        glFinish();
+        PROFILE_FRAME_END();
+        MEMORY_FRAME_END();
+        FrameTimer::EndFrame();
+        StartupTimer::MarkFirstFrame();
+
+        frameTimes.push_back(std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count());
+    }
+
+    return HeadlessStats::FromFrameTimes(std::move(frameTimes));
+}
+
+// --- RESUMEN DE TIEMPOS ---
+// Compartido por el modo headless y la reproducción de capturas (--replay).
+HeadlessStats HeadlessStats::FromFrameTimes(std::vector<double> frameTimes)
+{
+    HeadlessStats stats;
+    if (frameTimes.empty())
+        return stats;
+
+    const size_t frameCount = frameTimes.size();
+    stats.Frames = static_cast<unsigned int>(frameCount);
+    stats.FirstFrameMs = frameTimes.front();
+    for (double time : frameTimes)
+        stats.TotalMs += time;
+
+    std::sort(frameTimes.begin(), frameTimes.end());
+    stats.MeanMs = stats.TotalMs / static_cast<double>(frameCount);
+    stats.MedianMs = frameTimes[frameCount / 2];
+    stats.P99Ms = frameTimes[std::min<size_t>(frameCount - 1, static_cast<size_t>(std::ceil(0.99 * static_cast<double>(frameCount))) - 1)];
+    stats.MinMs = frameTimes.front();
+    stats.MaxMs = frameTimes.back();
+    return stats;
 }
 
 // --- MÉTODO RENDER (NO ESTÁTICO) ---
@@ -66,7 +193,11 @@ void Engine::Render()
 void Engine::Shutdown()
 {
     // Apaga el subsistema de renderizado, liberando sus recursos (ej. VBOs, Shaders, Texturas).
-    Renderer::Shutdown();
+    // Si nunca llegó a inicializarse no hay nada que liberar.
+    if (Engine::Get() && Engine::Get()->m_Initialized) {
+        Renderer::Shutdown();
+        Engine::Get()->m_Initialized = false;
+    }
 
     // Libera la memoria asignada dinámicamente para la ventana.
     // Accede a m_Window a través de la instancia Singleton.
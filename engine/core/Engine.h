@@ -3,21 +3,50 @@
 #define GLFW_INCLUDE_NONE
 #include "Window.h"
 
+#include <vector>
+
+struct ScenePacket;
+
+// Resultado de Engine::RunHeadless: tiempos por frame (CPU + GPU, con glFinish) en milisegundos
+struct HeadlessStats
+{
+    unsigned int Frames{};
+    double TotalMs{};
+    double FirstFrameMs{};
+    double MeanMs{};
+    double MedianMs{};
+    double P99Ms{};
+    double MinMs{};
+    double MaxMs{};
+
+    // Resume los tiempos por frame en el orden en que se midieron
+    static HeadlessStats FromFrameTimes(std::vector<double> frameTimes);
+};
+
 class Engine
 {
 public:
     Engine();
+    explicit Engine(const WindowData& windowData);
     ~Engine();
 
     Window* GetWindow() const { return m_Window; }
+    // Falso si no se pudo crear el contexto de OpenGL o inicializar el renderizador
+    bool IsInitialized() const { return m_Initialized; }
 
     static Engine* Get() { return s_Instance; }
 
     static void Run();
+    // Avanza la simulación a paso fijo (FixedTimestep) y prepara la escena interpolada del frame;
+    // en el editor la dibuja el hilo de render (RenderThread)
+    static void Update(ScenePacket& packet);
+    // Renderiza 'frameCount' frames en el FrameBuffer sin GUI ni presentación
+    static HeadlessStats RunHeadless(unsigned int frameCount);
     void Render();
     static void Shutdown();
 
 private:
     Window* m_Window;
+    bool m_Initialized = false;
     static Engine* s_Instance;
 };
\ No newline at end of file
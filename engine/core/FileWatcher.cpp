@@ -0,0 +1,152 @@
+#include "FileWatcher.h"
+#include "MemoryTracker.h"
+#include "Profiler.h"
+#include "Log.h"
+
+
+#ifdef __linux__
+#include <poll.h>
+#include <sys/inotify.h>
+#include <unistd.h>
+#endif
+
+FileWatcher::FileWatcher(const std::string& directory, Callback callback)
+    : m_Directory(directory), m_Callback(std::move(callback))
+{
+    std::error_code error;
+    if (!std::filesystem::is_directory(m_Directory, error))
+    {
+        LOG_ERROR("FileWatcher", "Not a directory: {}", directory);
+        return;
+    }
+
+    m_Running = true;
+    m_Thread = std::thread(&FileWatcher::Run, this);
+}
+
+FileWatcher::~FileWatcher()
+{
+    Shutdown();
+}
+
+void FileWatcher::Shutdown()
+{
+    m_Running = false;
+    if (m_Thread.joinable())
+        m_Thread.join();
+}
+
+void FileWatcher::Run()
+{
+    PROFILE_THREAD("FileWatcher");
+    MEMORY_TAG(Core);
+
+    if (!RunInotify())
+        RunPolling();
+}
+
+#ifdef __linux__
+bool FileWatcher::RunInotify()
+{
+    const int fd = inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+    if (fd < 0)
+    {
+        LOG_WARNING("FileWatcher", "inotify unavailable, falling back to polling");
+        return false;
+    }
+
+    // inotify no es recursivo: un watch por directorio, incluidos los que se creen después
+    constexpr uint32_t mask = IN_CLOSE_WRITE | IN_MOVED_TO | IN_CREATE;
+    std::unordered_map<int, std::filesystem::path> directories;
+    auto addWatch = [&](const std::filesystem::path& path)
+    {
+        const int wd = inotify_add_watch(fd, path.c_str(), mask);
+        if (wd >= 0)
+            directories[wd] = path;
+    };
+
+    addWatch(m_Directory);
+    std::error_code error;
+    for (const auto& entry : std::filesystem::recursive_directory_iterator(m_Directory, error))
+        if (entry.is_directory())
+            addWatch(entry.path());
+
+    m_UsingInotify = true;
+
+    alignas(inotify_event) char buffer[4096];
+    pollfd descriptor{ fd, POLLIN, 0 };
+
+    while (m_Running)
+    {
+        // Espera con timeout para poder comprobar m_Running y salir sin señales
+        if (poll(&descriptor, 1, static_cast<int>(PollInterval.count())) <= 0)
+            continue;
+
+        ssize_t length;
+        while ((length = read(fd, buffer, sizeof(buffer))) > 0)
+        {
+            for (char* cursor = buffer; cursor < buffer + length;)
+            {
+                const auto* event = reinterpret_cast<const inotify_event*>(cursor);
+                cursor += sizeof(inotify_event) + event->len;
+
+                const auto directory = directories.find(event->wd);
+                if (directory == directories.end() || event->len == 0)
+                    continue;
+
+                const std::filesystem::path path = directory->second / event->name;
+                if (event->mask & IN_ISDIR)
+                {
+                    if (event->mask & IN_CREATE)
+                        addWatch(path);
+                    continue;
+                }
+
+                // IN_CREATE llega antes de escribir el contenido; se espera al cierre o al rename
+                if (event->mask & (IN_CLOSE_WRITE | IN_MOVED_TO))
+                    m_Callback(path.string());
+            }
+        }
+    }
+
+    close(fd);
+    return true;
+}
+#else
+bool FileWatcher::RunInotify()
+{
+    return false;
+}
+#endif
+
+void FileWatcher::RunPolling()
+{
+    auto scan = [this](bool notify)
+    {
+        std::error_code error;
+        for (const auto& entry : std::filesystem::recursive_directory_iterator(m_Directory, error))
+        {
+            if (!entry.is_regular_file(error))
+                continue;
+
+            const auto writeTime = entry.last_write_time(error);
+            if (error)
+                continue;
+
+            auto [it, inserted] = m_WriteTimes.try_emplace(entry.path().string(), writeTime);
+            const bool changed = inserted || it->second != writeTime;
+            it->second = writeTime;
+            if (changed && notify)
+                m_Callback(it->first);
+        }
+    };
+
+    scan(false);
+    while (m_Running)
+    {
+        // Se duerme en tramos cortos para que Shutdown() no espere un intervalo completo
+        for (auto slept = std::chrono::milliseconds(0); slept < PollInterval && m_Running; slept += std::chrono::milliseconds(50))
+            std::this_thread::sleep_for(std::chrono::milliseconds(50));
+        scan(true);
+    }
+}
@@ -0,0 +1,45 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <filesystem>
+#include <functional>
+#include <string>
+#include <thread>
+#include <unordered_map>
+
+// Vigila recursivamente un directorio en un hilo propio y notifica cada archivo modificado.
+// En Linux usa inotify; si no está disponible (u otra plataforma) recorre el árbol periódicamente.
+// El callback se ejecuta en el hilo del watcher: no debe tocar estado de OpenGL.
+class FileWatcher
+{
+public:
+    using Callback = std::function<void(const std::string& path)>;
+
+    FileWatcher(const std::string& directory, Callback callback);
+    ~FileWatcher();
+
+    FileWatcher(const FileWatcher&) = delete;
+    FileWatcher& operator=(const FileWatcher&) = delete;
+
+    void Shutdown();
+
+    bool IsUsingInotify() const { return m_UsingInotify; }
+
+private:
+    void Run();
+    bool RunInotify();
+    void RunPolling();
+
+    static constexpr std::chrono::milliseconds PollInterval{500};
+
+    std::filesystem::path m_Directory;
+    Callback m_Callback;
+
+    std::thread m_Thread;
+    std::atomic<bool> m_Running{false};
+    std::atomic<bool> m_UsingInotify{false};
+
+    // Fallback por sondeo: última fecha de escritura conocida de cada archivo
+    std::unordered_map<std::string, std::filesystem::file_time_type> m_WriteTimes;
+};
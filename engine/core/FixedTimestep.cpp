@@ -0,0 +1,75 @@
+#include "FixedTimestep.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+
+double FixedTimestep::s_Rate = FixedTimestep::DefaultRate;
+unsigned int FixedTimestep::s_MaxSteps = FixedTimestep::DefaultMaxSteps;
+double FixedTimestep::s_Accumulator = 0.0;
+int64_t FixedTimestep::s_LastTime = 0;
+unsigned int FixedTimestep::s_LastSteps = 0;
+uint64_t FixedTimestep::s_StepCount = 0;
+double FixedTimestep::s_SimulationTime = 0.0;
+double FixedTimestep::s_DroppedSeconds = 0.0;
+
+unsigned int FixedTimestep::Advance()
+{
+    const int64_t now = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+
+    // La primera llamada solo fija la referencia
+    const double frameSeconds = s_LastTime == 0 ? 0.0 : static_cast<double>(now - s_LastTime) / 1e9;
+    s_LastTime = now;
+    return Advance(frameSeconds);
+}
+
+unsigned int FixedTimestep::Advance(double frameSeconds)
+{
+    const double step = GetStep();
+    s_Accumulator += std::max(frameSeconds, 0.0);
+
+    const unsigned int steps = static_cast<unsigned int>(std::min(std::floor(s_Accumulator / step), static_cast<double>(s_MaxSteps)));
+    s_Accumulator -= steps * step;
+
+    // Por encima del límite se descartan los pasos enteros y se conserva la fracción para interpolar
+    if (s_Accumulator >= step)
+    {
+        const double dropped = std::floor(s_Accumulator / step) * step;
+        s_Accumulator -= dropped;
+        s_DroppedSeconds += dropped;
+    }
+    // Error de redondeo: nunca fuera de [0, step)
+    s_Accumulator = std::clamp(s_Accumulator, 0.0, step * (1.0 - 1e-9));
+
+    s_LastSteps = steps;
+    s_StepCount += steps;
+    s_SimulationTime += steps * step;
+    return steps;
+}
+
+void FixedTimestep::SkipIdle()
+{
+    if (s_LastTime != 0)
+        s_LastTime = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+void FixedTimestep::Reset()
+{
+    s_Accumulator = 0.0;
+    s_LastTime = 0;
+    s_LastSteps = 0;
+    s_StepCount = 0;
+    s_SimulationTime = 0.0;
+    s_DroppedSeconds = 0.0;
+}
+
+void FixedTimestep::SetRate(double hz)
+{
+    if (hz <= 0.0)
+        return;
+
+    // Conserva la fracción de paso acumulada al cambiar la frecuencia
+    const double alpha = s_Accumulator * s_Rate;
+    s_Rate = hz;
+    s_Accumulator = alpha / s_Rate;
+}
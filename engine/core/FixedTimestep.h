@@ -0,0 +1,50 @@
+#pragma once
+
+// Reloj de simulación a paso fijo. Cada frame suma el tiempo real transcurrido a un acumulador
+// y la simulación avanza en pasos de 1/Rate segundos mientras quede tiempo acumulado; lo que
+// sobra (menos de un paso) da el factor de interpolación entre los dos últimos estados simulados.
+// Si un frame largo pide más de MaxSteps pasos, el resto se descarta en lugar de arrastrarlo,
+// para que un frame lento no provoque otro todavía más lento (espiral de la muerte).
+
+#include <cstdint>
+
+class FixedTimestep
+{
+public:
+    static constexpr double DefaultRate = 60.0;
+    static constexpr unsigned int DefaultMaxSteps = 8;
+
+    // Mide el tiempo real desde la llamada anterior y devuelve los pasos a simular en este frame
+    static unsigned int Advance();
+    // Igual, con un tiempo de frame dado (segundos)
+    static unsigned int Advance(double frameSeconds);
+    // El tiempo desde la última medida no se simula (el editor esperando eventos en reposo)
+    static void SkipIdle();
+    static void Reset();
+
+    // Pasos por segundo
+    static void SetRate(double hz);
+    static double GetRate() { return s_Rate; }
+    static double GetStep() { return 1.0 / s_Rate; }
+
+    static void SetMaxSteps(unsigned int steps) { s_MaxSteps = steps > 0 ? steps : 1; }
+    static unsigned int GetMaxSteps() { return s_MaxSteps; }
+
+    // Fracción de paso acumulada tras el último Advance, en [0, 1): peso del estado actual frente al anterior
+    static float GetAlpha() { return static_cast<float>(s_Accumulator * s_Rate); }
+    static unsigned int GetLastSteps() { return s_LastSteps; }
+    static uint64_t GetStepCount() { return s_StepCount; }
+    static double GetSimulationTime() { return s_SimulationTime; }
+    // Tiempo real descartado por el límite de pasos
+    static double GetDroppedSeconds() { return s_DroppedSeconds; }
+
+private:
+    static double s_Rate;
+    static unsigned int s_MaxSteps;
+    static double s_Accumulator;
+    static int64_t s_LastTime;
+    static unsigned int s_LastSteps;
+    static uint64_t s_StepCount;
+    static double s_SimulationTime;
+    static double s_DroppedSeconds;
+};
@@ -0,0 +1,145 @@
+#include "FrameAllocator.h"
+#include "MemoryTracker.h"
+
+#include <algorithm>
+#include <mutex>
+#include <new>
+
+struct FrameAllocator::Registry
+{
+    std::mutex Mutex;
+    std::vector<ThreadArenas*> Threads;
+    FrameAllocatorStats LastFrame;
+};
+
+std::atomic<uint64_t> FrameAllocator::s_FrameIndex{0};
+thread_local FrameAllocator::ThreadArenas* FrameAllocator::t_Arenas = nullptr;
+
+// --- FrameArena ---
+
+FrameArena::~FrameArena()
+{
+    Release();
+}
+
+void FrameArena::Reset()
+{
+    // Lo que no cupo en el primer bloque se pide ya en uno solo del tamaño total
+    if (m_Blocks.size() > 1)
+    {
+        const size_t total = GetCapacity();
+        Release();
+        AddBlock(total);
+    }
+
+    if (!m_Blocks.empty())
+    {
+        m_Cursor = m_Blocks.front().Data;
+        m_End = m_Cursor + m_Blocks.front().Size;
+    }
+    m_Used.store(0, std::memory_order_relaxed);
+    m_Overflows.store(0, std::memory_order_relaxed);
+}
+
+void* FrameArena::do_allocate(size_t bytes, size_t alignment)
+{
+    void* pointer = m_Cursor;
+    size_t space = static_cast<size_t>(m_End - m_Cursor);
+    if (!m_Cursor || !std::align(alignment, bytes, pointer, space))
+    {
+        // Con margen para alinear dentro del bloque nuevo
+        AddBlock(bytes + alignment);
+        pointer = m_Cursor;
+        space = static_cast<size_t>(m_End - m_Cursor);
+        std::align(alignment, bytes, pointer, space);
+    }
+
+    std::byte* start = static_cast<std::byte*>(pointer);
+    const size_t consumed = static_cast<size_t>(start + bytes - m_Cursor);
+    m_Cursor = start + bytes;
+    m_Used.store(GetUsedBytes() + consumed, std::memory_order_relaxed);
+    return start;
+}
+
+void FrameArena::AddBlock(size_t minimumSize)
+{
+    MEMORY_TAG(Frame);
+
+    // Cada bloque extra duplica la capacidad, así que un frame grande necesita pocos
+    const size_t size = std::max({ minimumSize, InitialBlockSize, GetCapacity() });
+    Block block{ static_cast<std::byte*>(::operator new(size)), size };
+
+    if (!m_Blocks.empty())
+        m_Overflows.fetch_add(1, std::memory_order_relaxed);
+    m_Blocks.push_back(block);
+    m_Cursor = block.Data;
+    m_End = block.Data + block.Size;
+    m_Capacity.fetch_add(size, std::memory_order_relaxed);
+}
+
+void FrameArena::Release()
+{
+    for (const Block& block : m_Blocks)
+        ::operator delete(block.Data);
+    m_Blocks.clear();
+    m_Cursor = nullptr;
+    m_End = nullptr;
+    m_Capacity.store(0, std::memory_order_relaxed);
+}
+
+// --- FrameAllocator ---
+
+FrameAllocator::Registry& FrameAllocator::GetRegistry()
+{
+    static Registry* registry = new Registry();
+    return *registry;
+}
+
+FrameAllocator::ThreadArenas& FrameAllocator::GetThreadArenas()
+{
+    if (!t_Arenas)
+    {
+        Registry& registry = GetRegistry();
+        std::lock_guard<std::mutex> lock(registry.Mutex);
+        // Sobrevive al hilo: sus arenas pueden seguir en uso por un paquete ya entregado
+        registry.Threads.push_back(new ThreadArenas());
+        t_Arenas = registry.Threads.back();
+    }
+    return *t_Arenas;
+}
+
+std::pmr::memory_resource* FrameAllocator::GetResource()
+{
+    return &GetThreadArenas().Frames[GetFrameIndex() % FrameCount];
+}
+
+void FrameAllocator::BeginFrame()
+{
+    Registry& registry = GetRegistry();
+    std::lock_guard<std::mutex> lock(registry.Mutex);
+
+    const uint64_t frame = s_FrameIndex.load(std::memory_order_relaxed);
+
+    FrameAllocatorStats stats;
+    stats.Threads = static_cast<uint32_t>(registry.Threads.size());
+    for (ThreadArenas* arenas : registry.Threads)
+    {
+        const FrameArena& arena = arenas->Frames[frame % FrameCount];
+        stats.UsedBytes += arena.GetUsedBytes();
+        stats.CapacityBytes += arena.GetCapacity();
+        stats.OverflowBlocks += arena.GetOverflowBlocks();
+    }
+    registry.LastFrame = stats;
+
+    // El frame que se reutiliza es el más antiguo: su paquete ya se dibujó hace tiempo
+    for (ThreadArenas* arenas : registry.Threads)
+        arenas->Frames[(frame + 1) % FrameCount].Reset();
+    s_FrameIndex.store(frame + 1, std::memory_order_release);
+}
+
+FrameAllocatorStats FrameAllocator::GetStats()
+{
+    Registry& registry = GetRegistry();
+    std::lock_guard<std::mutex> lock(registry.Mutex);
+    return registry.LastFrame;
+}
@@ -0,0 +1,115 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <memory_resource>
+#include <vector>
+
+// Memoria de un solo frame: reservar es avanzar un puntero y liberar no hace nada; todo se
+// descarta de golpe al reutilizar el frame. Si un frame no cabe se pide otro bloque y, al
+// reiniciar, los bloques se funden en uno del tamaño total, así que en régimen estable no hay
+// ninguna llamada a malloc. Cada arena la usa un único hilo.
+class FrameArena : public std::pmr::memory_resource
+{
+public:
+    // Tamaño del primer bloque
+    static constexpr size_t InitialBlockSize = 64 * 1024;
+
+    FrameArena() = default;
+    ~FrameArena() override;
+
+    FrameArena(const FrameArena&) = delete;
+    FrameArena& operator=(const FrameArena&) = delete;
+
+    // Vuelve al principio del primer bloque; lo reservado antes deja de ser válido
+    void Reset();
+
+    // Se pueden leer desde otro hilo (estadísticas)
+    size_t GetUsedBytes() const { return m_Used.load(std::memory_order_relaxed); }
+    size_t GetCapacity() const { return m_Capacity.load(std::memory_order_relaxed); }
+    // Bloques pedidos desde el último Reset porque el frame no cabía
+    uint32_t GetOverflowBlocks() const { return m_Overflows.load(std::memory_order_relaxed); }
+
+protected:
+    void* do_allocate(size_t bytes, size_t alignment) override;
+    void do_deallocate(void* pointer, size_t bytes, size_t alignment) override {}
+    bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override { return this == &other; }
+
+private:
+    struct Block
+    {
+        std::byte* Data;
+        size_t Size;
+    };
+
+    void AddBlock(size_t minimumSize);
+    void Release();
+
+    std::vector<Block> m_Blocks;
+    std::byte* m_Cursor = nullptr;
+    std::byte* m_End = nullptr;
+
+    std::atomic<size_t> m_Used{0};
+    std::atomic<size_t> m_Capacity{0};
+    std::atomic<uint32_t> m_Overflows{0};
+};
+
+struct FrameAllocatorStats
+{
+    size_t UsedBytes{};
+    size_t CapacityBytes{};
+    uint32_t OverflowBlocks{};
+    // Hilos que han pedido memoria de frame alguna vez
+    uint32_t Threads{};
+};
+
+// Memoria para los datos temporales del frame (el ScenePacket, listas de la GUI) con adaptadores
+// std::pmr: un std::pmr::vector construido con GetResource() reserva sin pasar por malloc.
+//
+// Hay FrameCount frames en uso a la vez y cada hilo tiene su propia arena en cada uno. BeginFrame
+// reinicia las arenas del frame más antiguo: lo que se reserva en un frame sigue siendo válido
+// durante los FrameCount - 1 siguientes, lo que cubre el paquete que el hilo de render dibuja
+// mientras el principal prepara el siguiente (RenderThread).
+class FrameAllocator
+{
+public:
+    static constexpr unsigned int FrameCount = 3;
+
+    // Empieza un frame. Solo en el hilo principal (Engine::Update).
+    static void BeginFrame();
+
+    // Arena del hilo que llama para el frame actual; la primera llamada de cada hilo la registra
+    static std::pmr::memory_resource* GetResource();
+
+    static uint64_t GetFrameIndex() { return s_FrameIndex.load(std::memory_order_acquire); }
+
+    // Uso del último frame terminado, sumando todos los hilos
+    static FrameAllocatorStats GetStats();
+
+    // Un contenedor pmr conserva siempre el recurso con el que se construyó (ni asignar ni
+    // intercambiar lo cambian): para pasarlo a la memoria de otro frame hay que reconstruirlo vacío
+    template<typename Container>
+    static void Rebind(Container& container, std::pmr::memory_resource* resource)
+    {
+        std::destroy_at(&container);
+        std::construct_at(&container, resource);
+    }
+
+private:
+    struct ThreadArenas
+    {
+        FrameArena Frames[FrameCount];
+    };
+
+    struct Registry;
+
+    // No se destruye nunca: los contenedores estáticos que aún apuntan a una arena (los paquetes de
+    // RenderThread) se destruyen al salir, en cualquier orden respecto a este archivo
+    static Registry& GetRegistry();
+    static ThreadArenas& GetThreadArenas();
+
+    static std::atomic<uint64_t> s_FrameIndex;
+    static thread_local ThreadArenas* t_Arenas;
+};
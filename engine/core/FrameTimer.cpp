@@ -0,0 +1,245 @@
+#include "FrameTimer.h"
+#include "GPUProfiler.h"
+#include "Log.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <iomanip>
+
+FrameTiming FrameTimer::s_History[FrameTimer::HistorySize];
+uint64_t FrameTimer::s_FrameCount = 0;
+int64_t FrameTimer::s_StartTime = 0;
+int64_t FrameTimer::s_LastFrameEnd = 0;
+
+double FrameTimer::s_HitchThresholdMs = 33.3;
+std::deque<FrameHitch> FrameTimer::s_Hitches;
+uint64_t FrameTimer::s_HitchCount = 0;
+
+#ifdef FERX_PROFILING
+uint64_t FrameTimer::s_GPUIndex[FrameTimer::HistorySize];
+uint64_t FrameTimer::s_NextGPUFrame = 0;
+#endif
+
+std::ofstream FrameTimer::s_Log;
+uint64_t FrameTimer::s_LogNext = 0;
+
+namespace
+{
+    int64_t SteadyNanoseconds()
+    {
+        return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+    }
+}
+
+void FrameTimer::EndFrame()
+{
+    const int64_t now = SteadyNanoseconds();
+
+    // El primer frame solo fija la referencia: no hay un frame anterior con el que medir
+    if (s_LastFrameEnd == 0)
+    {
+        s_StartTime = now;
+        s_LastFrameEnd = now;
+        return;
+    }
+
+    FrameTiming& timing = s_History[s_FrameCount % HistorySize];
+    timing = FrameTiming();
+    timing.Index = s_FrameCount;
+    timing.EndSeconds = static_cast<double>(now - s_StartTime) / 1e9;
+    timing.CPUMs = static_cast<double>(now - s_LastFrameEnd) / 1e6;
+    timing.Hitch = s_HitchThresholdMs > 0.0 && timing.CPUMs > s_HitchThresholdMs;
+    s_LastFrameEnd = now;
+
+#ifdef FERX_PROFILING
+    // El frame de GPU que se acaba de cerrar, y el último que ya tiene resultado
+    s_GPUIndex[s_FrameCount % HistorySize] = GPUProfiler::IsAvailable() && GPUProfiler::GetFrameIndex() > 0
+        ? GPUProfiler::GetFrameIndex() - 1 : UINT64_MAX;
+
+    const GPUFrameTiming& gpu = GPUProfiler::GetLastFrame();
+    if (!gpu.Passes.empty() && gpu.Index >= s_NextGPUFrame)
+    {
+        s_NextGPUFrame = gpu.Index + 1;
+        const uint64_t oldest = s_FrameCount >= HistorySize ? s_FrameCount - HistorySize + 1 : 0;
+        for (uint64_t frame = s_FrameCount + 1; frame-- > oldest;)
+        {
+            if (s_GPUIndex[frame % HistorySize] == gpu.Index)
+            {
+                s_History[frame % HistorySize].GPUMs = gpu.Milliseconds;
+                s_History[frame % HistorySize].LatencyMs = gpu.InputLatencyMs;
+                break;
+            }
+        }
+    }
+
+    if (timing.Hitch)
+    {
+        FrameHitch hitch{ timing.Index, timing.CPUMs, Profiler::GetLastFrame() };
+        hitch.Profile.Events.clear();
+        hitch.Profile.Events.shrink_to_fit();
+        s_Hitches.push_back(std::move(hitch));
+    }
+#else
+    if (timing.Hitch)
+        s_Hitches.push_back({ timing.Index, timing.CPUMs });
+#endif
+
+    if (timing.Hitch)
+    {
+        s_HitchCount++;
+        if (s_Hitches.size() > MaxHitches)
+            s_Hitches.pop_front();
+    }
+
+    s_FrameCount++;
+
+    if (s_Log.is_open())
+    {
+        while (s_LogNext + LogDelay <= s_FrameCount)
+        {
+            if (FrameTiming* logged = Find(s_LogNext))
+                WriteLogRow(*logged);
+            s_LogNext++;
+        }
+    }
+}
+
+void FrameTimer::SkipIdle()
+{
+    if (s_LastFrameEnd != 0)
+        s_LastFrameEnd = SteadyNanoseconds();
+}
+
+void FrameTimer::Reset()
+{
+    StopLog();
+    s_FrameCount = 0;
+    s_StartTime = 0;
+    s_LastFrameEnd = 0;
+    s_Hitches.clear();
+    s_HitchCount = 0;
+#ifdef FERX_PROFILING
+    s_NextGPUFrame = 0;
+#endif
+}
+
+FrameTiming* FrameTimer::Find(uint64_t index)
+{
+    if (index >= s_FrameCount || index + HistorySize < s_FrameCount)
+        return nullptr;
+    return &s_History[index % HistorySize];
+}
+
+std::vector<FrameTiming> FrameTimer::GetHistory()
+{
+    const uint64_t oldest = s_FrameCount > HistorySize ? s_FrameCount - HistorySize : 0;
+
+    std::vector<FrameTiming> history;
+    history.reserve(static_cast<size_t>(s_FrameCount - oldest));
+    for (uint64_t frame = oldest; frame < s_FrameCount; frame++)
+        history.push_back(s_History[frame % HistorySize]);
+    return history;
+}
+
+FrameTimeStats FrameTimer::ComputeStats(std::vector<double>& samples)
+{
+    FrameTimeStats stats;
+    stats.Samples = samples.size();
+    if (samples.empty())
+        return stats;
+
+    // Percentil por rango más cercano: el valor que deja por debajo al menos ese porcentaje de frames
+    auto percentile = [&samples](double fraction)
+    {
+        const size_t rank = static_cast<size_t>(std::ceil(fraction * static_cast<double>(samples.size())));
+        const size_t index = std::min(samples.size() - 1, rank > 0 ? rank - 1 : 0);
+        std::nth_element(samples.begin(), samples.begin() + static_cast<std::ptrdiff_t>(index), samples.end());
+        return samples[index];
+    };
+
+    double total = 0.0;
+    for (double sample : samples)
+    {
+        total += sample;
+        stats.MaxMs = std::max(stats.MaxMs, sample);
+    }
+    stats.MeanMs = total / static_cast<double>(samples.size());
+    stats.P50Ms = percentile(0.50);
+    stats.P95Ms = percentile(0.95);
+    stats.P99Ms = percentile(0.99);
+    return stats;
+}
+
+FrameTimeStats FrameTimer::GetCPUStats()
+{
+    std::vector<double> samples;
+    for (const FrameTiming& timing : GetHistory())
+        samples.push_back(timing.CPUMs);
+    return ComputeStats(samples);
+}
+
+FrameTimeStats FrameTimer::GetGPUStats()
+{
+    std::vector<double> samples;
+    for (const FrameTiming& timing : GetHistory())
+    {
+        if (timing.GPUMs >= 0.0)
+            samples.push_back(timing.GPUMs);
+    }
+    return ComputeStats(samples);
+}
+
+FrameTimeStats FrameTimer::GetLatencyStats()
+{
+    std::vector<double> samples;
+    for (const FrameTiming& timing : GetHistory())
+    {
+        if (timing.LatencyMs >= 0.0)
+            samples.push_back(timing.LatencyMs);
+    }
+    return ComputeStats(samples);
+}
+
+bool FrameTimer::StartLog(const std::string& path)
+{
+    StopLog();
+
+    s_Log.open(path, std::ios::trunc);
+    if (!s_Log)
+    {
+        LOG_ERROR("FrameTimer", "Failed to open frame time log: {}", path);
+        return false;
+    }
+
+    s_Log << "frame,time_s,cpu_ms,gpu_ms,hitch,latency_ms\n" << std::fixed;
+    s_LogNext = s_FrameCount;
+    return true;
+}
+
+void FrameTimer::StopLog()
+{
+    if (!s_Log.is_open())
+        return;
+
+    // Los últimos frames se escriben aunque su tiempo de GPU no haya llegado
+    for (; s_LogNext < s_FrameCount; s_LogNext++)
+    {
+        if (FrameTiming* logged = Find(s_LogNext))
+            WriteLogRow(*logged);
+    }
+    s_Log.close();
+}
+
+void FrameTimer::WriteLogRow(const FrameTiming& timing)
+{
+    s_Log << timing.Index << ','
+          << std::setprecision(6) << timing.EndSeconds << ','
+          << std::setprecision(3) << timing.CPUMs << ',';
+    if (timing.GPUMs >= 0.0)
+        s_Log << timing.GPUMs;
+    s_Log << ',' << (timing.Hitch ? 1 : 0) << ',';
+    if (timing.LatencyMs >= 0.0)
+        s_Log << timing.LatencyMs;
+    s_Log << '\n';
+}
@@ -0,0 +1,106 @@
+#pragma once
+
+// Registro de tiempos por frame para detectar tirones que la media de FPS esconde.
+// Guarda en un anillo el tiempo de pared entre frames (lo que percibe el usuario, swap incluido)
+// y, con el profiler activo, el tiempo de GPU, que llega FrameLatency frames más tarde.
+// Un frame por encima del umbral es un tirón: se guarda junto al árbol del Profiler de ese frame.
+// Opcionalmente escribe un CSV con una fila por frame para analizar sesiones completas.
+
+#include "Profiler.h"
+
+#include <cstdint>
+#include <deque>
+#include <fstream>
+#include <string>
+#include <vector>
+
+struct FrameTiming
+{
+    uint64_t Index{};
+    // Fin del frame en segundos desde el primero
+    double EndSeconds{};
+    double CPUMs{};
+    // Negativo mientras la GPU no ha resuelto el frame (o sin profiler)
+    double GPUMs = -1.0;
+    // Latencia de entrada a pantalla (GPUProfiler::MarkPresent); negativa si no se midió
+    double LatencyMs = -1.0;
+    bool Hitch{};
+};
+
+struct FrameTimeStats
+{
+    size_t Samples{};
+    double MeanMs{};
+    double P50Ms{};
+    double P95Ms{};
+    double P99Ms{};
+    double MaxMs{};
+};
+
+struct FrameHitch
+{
+    uint64_t Frame{};
+    double Milliseconds{};
+#ifdef FERX_PROFILING
+    // Árbol agregado del frame (sin los eventos sueltos, para no acumular memoria)
+    ProfileFrame Profile;
+#endif
+};
+
+class FrameTimer
+{
+public:
+    static constexpr size_t HistorySize = 1024;
+    static constexpr size_t MaxHitches = 32;
+
+    // Cierra el frame; va después de PROFILE_FRAME_END para poder guardar su árbol si es un tirón
+    static void EndFrame();
+    // Descarta el tiempo transcurrido desde el último EndFrame (el editor esperando eventos en reposo)
+    static void SkipIdle();
+    static void Reset();
+
+    // Frames del anillo, del más antiguo al más reciente
+    static std::vector<FrameTiming> GetHistory();
+    static FrameTimeStats GetCPUStats();
+    // Solo frames con tiempo de GPU resuelto
+    static FrameTimeStats GetGPUStats();
+    // Solo frames con latencia de entrada medida
+    static FrameTimeStats GetLatencyStats();
+
+    static void SetHitchThreshold(double milliseconds) { s_HitchThresholdMs = milliseconds; }
+    static double GetHitchThreshold() { return s_HitchThresholdMs; }
+    static const std::deque<FrameHitch>& GetHitches() { return s_Hitches; }
+    static uint64_t GetHitchCount() { return s_HitchCount; }
+    static void ClearHitches() { s_Hitches.clear(); }
+
+    // CSV: frame,time_s,cpu_ms,gpu_ms,hitch,latency_ms. Las filas se escriben con LogDelay frames de retraso
+    // para que incluyan el tiempo de GPU
+    static bool StartLog(const std::string& path);
+    static void StopLog();
+    static bool IsLogging() { return s_Log.is_open(); }
+
+private:
+    static constexpr uint64_t LogDelay = 8;
+
+    static FrameTimeStats ComputeStats(std::vector<double>& samples);
+    static FrameTiming* Find(uint64_t index);
+    static void WriteLogRow(const FrameTiming& timing);
+
+    static FrameTiming s_History[HistorySize];
+    static uint64_t s_FrameCount;
+    static int64_t s_StartTime;
+    static int64_t s_LastFrameEnd;
+
+    static double s_HitchThresholdMs;
+    static std::deque<FrameHitch> s_Hitches;
+    static uint64_t s_HitchCount;
+
+#ifdef FERX_PROFILING
+    // Índice de GPUProfiler de cada frame del anillo, para casar los resultados que llegan tarde
+    static uint64_t s_GPUIndex[HistorySize];
+    static uint64_t s_NextGPUFrame;
+#endif
+
+    static std::ofstream s_Log;
+    static uint64_t s_LogNext;
+};
@@ -0,0 +1,170 @@
+#include "HeadlessContext.h"
+#include "Log.h"
+
+#include <cstring>
+
+#ifdef FERX_HEADLESS_EGL
+
+#include <EGL/egl.h>
+#include <EGL/eglext.h>
+
+namespace
+{
+    bool HasExtension(const char* extensions, const char* name)
+    {
+        if (!extensions)
+            return false;
+
+        const size_t length = std::strlen(name);
+        for (const char* start = extensions; (start = std::strstr(start, name)); start += length)
+        {
+            if ((start == extensions || start[-1] == ' ') && (start[length] == ' ' || start[length] == '\0'))
+                return true;
+        }
+        return false;
+    }
+
+    EGLDisplay OpenDisplay()
+    {
+        // Con EGL_MESA_platform_surfaceless no hace falta X11, Wayland ni un dispositivo DRM
+        const char* clientExtensions = eglQueryString(EGL_NO_DISPLAY, EGL_EXTENSIONS);
+        if (HasExtension(clientExtensions, "EGL_MESA_platform_surfaceless"))
+        {
+            auto getPlatformDisplay = reinterpret_cast<PFNEGLGETPLATFORMDISPLAYEXTPROC>(eglGetProcAddress("eglGetPlatformDisplayEXT"));
+            if (getPlatformDisplay)
+            {
+                EGLDisplay display = getPlatformDisplay(EGL_PLATFORM_SURFACELESS_MESA, EGL_DEFAULT_DISPLAY, nullptr);
+                if (display != EGL_NO_DISPLAY)
+                    return display;
+            }
+        }
+        return eglGetDisplay(EGL_DEFAULT_DISPLAY);
+    }
+}
+
+HeadlessContext::~HeadlessContext()
+{
+    Shutdown();
+}
+
+bool HeadlessContext::Init(int width, int height)
+{
+    EGLDisplay display = OpenDisplay();
+    EGLint major = 0, minor = 0;
+    if (display == EGL_NO_DISPLAY || !eglInitialize(display, &major, &minor))
+    {
+        LOG_ERROR("Headless", "Failed to initialize EGL display");
+        return false;
+    }
+    m_Display = display;
+
+    if (!eglBindAPI(EGL_OPENGL_API))
+    {
+        LOG_ERROR("Headless", "EGL does not support desktop OpenGL");
+        Shutdown();
+        return false;
+    }
+
+    const EGLint configAttributes[] = {
+        EGL_SURFACE_TYPE, EGL_PBUFFER_BIT,
+        EGL_RENDERABLE_TYPE, EGL_OPENGL_BIT,
+        EGL_RED_SIZE, 8, EGL_GREEN_SIZE, 8, EGL_BLUE_SIZE, 8, EGL_ALPHA_SIZE, 8,
+        EGL_DEPTH_SIZE, 24,
+        EGL_NONE
+    };
+    EGLConfig config = nullptr;
+    EGLint configCount = 0;
+    if (!eglChooseConfig(display, configAttributes, &config, 1, &configCount) || configCount == 0)
+    {
+        LOG_ERROR("Headless", "Failed to find an EGL config for OpenGL");
+        Shutdown();
+        return false;
+    }
+
+    // Mismo perfil que la ventana de GLFW: OpenGL 3.3 core
+    const EGLint contextAttributes[] = {
+        EGL_CONTEXT_MAJOR_VERSION, 3,
+        EGL_CONTEXT_MINOR_VERSION, 3,
+        EGL_CONTEXT_OPENGL_PROFILE_MASK, EGL_CONTEXT_OPENGL_CORE_PROFILE_BIT,
+        EGL_NONE
+    };
+    EGLContext context = eglCreateContext(display, config, EGL_NO_CONTEXT, contextAttributes);
+    if (context == EGL_NO_CONTEXT)
+    {
+        LOG_ERROR("Headless", "Failed to create EGL context");
+        Shutdown();
+        return false;
+    }
+    m_Context = context;
+
+    // Todo se dibuja en FrameBuffers propios; el pbuffer solo existe para poder hacer current el contexto
+    EGLSurface surface = EGL_NO_SURFACE;
+    if (!HasExtension(eglQueryString(display, EGL_EXTENSIONS), "EGL_KHR_surfaceless_context"))
+    {
+        const EGLint surfaceAttributes[] = { EGL_WIDTH, width, EGL_HEIGHT, height, EGL_NONE };
+        surface = eglCreatePbufferSurface(display, config, surfaceAttributes);
+        if (surface == EGL_NO_SURFACE)
+        {
+            LOG_ERROR("Headless", "Failed to create EGL pbuffer surface");
+            Shutdown();
+            return false;
+        }
+        m_Surface = surface;
+    }
+
+    if (!eglMakeCurrent(display, surface, surface, context))
+    {
+        LOG_ERROR("Headless", "Failed to make EGL context current");
+        Shutdown();
+        return false;
+    }
+
+    LOG_INFO("Headless", "EGL {}.{} headless context created ({})", major, minor, surface == EGL_NO_SURFACE ? "surfaceless" : "pbuffer");
+    return true;
+}
+
+void HeadlessContext::Shutdown()
+{
+    if (!m_Display)
+        return;
+
+    eglMakeCurrent(m_Display, EGL_NO_SURFACE, EGL_NO_SURFACE, EGL_NO_CONTEXT);
+    if (m_Surface)
+        eglDestroySurface(m_Display, m_Surface);
+    if (m_Context)
+        eglDestroyContext(m_Display, m_Context);
+    eglTerminate(m_Display);
+
+    m_Display = nullptr;
+    m_Context = nullptr;
+    m_Surface = nullptr;
+}
+
+void* HeadlessContext::GetProcAddress(const char* name)
+{
+    return reinterpret_cast<void*>(eglGetProcAddress(name));
+}
+
+#else
+
+HeadlessContext::~HeadlessContext()
+{
+    Shutdown();
+}
+
+bool HeadlessContext::Init(int width, int height)
+{
+    LOG_ERROR("Headless", "Headless mode requires EGL, which was not found at build time");
+    return false;
+}
+
+void HeadlessContext::Shutdown()
+{
+}
+
+void* HeadlessContext::GetProcAddress(const char* name)
+{
+    return nullptr;
+}
+
+#endif
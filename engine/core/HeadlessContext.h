@@ -0,0 +1,31 @@
+#pragma once
+
+#include <string>
+
+// Contexto de OpenGL 3.3 core sin ventana, creado con EGL.
+// Se prefiere la plataforma surfaceless de Mesa (funciona con llvmpipe sin servidor gráfico);
+// si el driver no admite contextos sin superficie se hace current con un pbuffer.
+// Sin soporte de EGL en la compilación (FERX_HEADLESS_EGL), Init siempre falla.
+class HeadlessContext
+{
+public:
+    HeadlessContext() = default;
+    ~HeadlessContext();
+
+    HeadlessContext(const HeadlessContext&) = delete;
+    HeadlessContext& operator=(const HeadlessContext&) = delete;
+
+    // Crea el contexto y lo deja como actual en el hilo que llama
+    bool Init(int width, int height);
+    void Shutdown();
+
+    bool IsValid() const { return m_Context != nullptr; }
+
+    // Cargador para gladLoadGLLoader
+    static void* GetProcAddress(const char* name);
+
+private:
+    void* m_Display{};
+    void* m_Context{};
+    void* m_Surface{};
+};
@@ -0,0 +1,312 @@
+#include "Log.h"
+#include "Profiler.h"
+
+#include <algorithm>
+#include <chrono>
+#include <condition_variable>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <mutex>
+#include <thread>
+#include <utility>
+#include <vector>
+
+struct Log::State
+{
+    std::mutex Mutex;
+    std::condition_variable Wake;
+    std::thread Thread;
+    bool Stopping = false;
+
+    // Una cola por hilo que ha registrado algo; viven tanto como el programa
+    std::vector<std::unique_ptr<LogQueue>> Queues;
+
+    std::vector<std::pair<size_t, Sink>> Sinks;
+    size_t NextSinkId = 1;
+    std::ofstream File;
+    bool Console = true;
+
+    uint64_t StartTicks = Now();
+    uint64_t ReportedDropped = 0;
+    uint64_t ReportedTruncated = 0;
+    // Texto del registro que se está formateando; conserva su capacidad
+    std::string Text;
+};
+
+std::atomic<LogSeverity> Log::s_MinimumSeverity{LogSeverity::Debug};
+std::atomic<uint64_t> Log::s_Dropped{0};
+std::atomic<uint64_t> Log::s_Truncated{0};
+std::atomic<bool> Log::s_Stopped{false};
+thread_local LogQueue* Log::t_Queue = nullptr;
+
+Log::State& Log::GetState()
+{
+    static State* state = new State();
+    return *state;
+}
+
+uint64_t Log::Now()
+{
+    return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count());
+}
+
+LogQueue& Log::GetThreadQueue()
+{
+    if (!t_Queue)
+    {
+        State& state = GetState();
+        std::lock_guard<std::mutex> lock(state.Mutex);
+        state.Queues.push_back(std::make_unique<LogQueue>());
+        t_Queue = state.Queues.back().get();
+
+        // El primer mensaje arranca el hilo de fondo; al salir se vacían las colas
+        if (!state.Thread.joinable() && !s_Stopped.load(std::memory_order_relaxed))
+        {
+            state.Thread = std::thread(Run);
+            std::atexit(Shutdown);
+        }
+    }
+    return *t_Queue;
+}
+
+bool Log::OpenFile(const std::string& path)
+{
+    State& state = GetState();
+    {
+        std::lock_guard<std::mutex> lock(state.Mutex);
+        DrainAll(state);
+        state.File.close();
+        if (path.empty())
+            return true;
+        state.File.open(path, std::ios::trunc);
+        if (state.File)
+            return true;
+    }
+    LOG_ERROR("Log", "Failed to open log file: {}", path);
+    return false;
+}
+
+void Log::SetConsoleOutput(bool enabled)
+{
+    State& state = GetState();
+    std::lock_guard<std::mutex> lock(state.Mutex);
+    state.Console = enabled;
+}
+
+size_t Log::AddSink(Sink sink)
+{
+    State& state = GetState();
+    std::lock_guard<std::mutex> lock(state.Mutex);
+    const size_t id = state.NextSinkId++;
+    state.Sinks.emplace_back(id, std::move(sink));
+    return id;
+}
+
+void Log::RemoveSink(size_t id)
+{
+    State& state = GetState();
+    std::lock_guard<std::mutex> lock(state.Mutex);
+    // Lo pendiente aún llega a este destino antes de quitarlo
+    DrainAll(state);
+    std::erase_if(state.Sinks, [id](const std::pair<size_t, Sink>& sink) { return sink.first == id; });
+}
+
+void Log::Flush()
+{
+    State& state = GetState();
+    std::lock_guard<std::mutex> lock(state.Mutex);
+    DrainAll(state);
+}
+
+void Log::Shutdown()
+{
+    State& state = GetState();
+    {
+        std::lock_guard<std::mutex> lock(state.Mutex);
+        if (s_Stopped.load(std::memory_order_relaxed))
+            return;
+        s_Stopped.store(true, std::memory_order_relaxed);
+        state.Stopping = true;
+    }
+    state.Wake.notify_one();
+    if (state.Thread.joinable())
+        state.Thread.join();
+    Flush();
+}
+
+const char* Log::GetSeverityName(LogSeverity severity)
+{
+    static const char* names[static_cast<size_t>(LogSeverity::Count)] = { "Debug", "Info", "Warning", "Error" };
+    return names[static_cast<size_t>(severity)];
+}
+
+void Log::Run()
+{
+    PROFILE_THREAD("Log");
+
+    State& state = GetState();
+    std::unique_lock<std::mutex> lock(state.Mutex);
+    while (!state.Stopping)
+    {
+        state.Wake.wait_for(lock, std::chrono::milliseconds(DrainIntervalMs), [&state]() { return state.Stopping; });
+        DrainAll(state);
+    }
+}
+
+void Log::DrainAll(State& state)
+{
+    size_t delivered = 0;
+    for (size_t i = 0; i < state.Queues.size(); i++)
+    {
+        const uint32_t thread = static_cast<uint32_t>(i);
+        delivered += state.Queues[i]->Drain([&state, thread](const std::byte* record) { Format(state, record, thread); });
+    }
+
+    // Los descartes se avisan en orden con lo demás, en cuanto hay sitio para contarlo
+    const uint64_t dropped = s_Dropped.load(std::memory_order_relaxed);
+    if (dropped != state.ReportedDropped)
+    {
+        state.Text = std::to_string(dropped - state.ReportedDropped) + " log messages dropped: queue full";
+        state.ReportedDropped = dropped;
+        Deliver(state, { LogSeverity::Warning, "Log", state.Text, (Now() - state.StartTicks) * 1e-9, 0 });
+        delivered++;
+    }
+    const uint64_t truncated = s_Truncated.load(std::memory_order_relaxed);
+    if (truncated != state.ReportedTruncated)
+    {
+        state.Text = std::to_string(truncated - state.ReportedTruncated) + " log messages truncated: larger than " +
+                     std::to_string(LogQueue::MaxRecordSize / 1024) + " KB";
+        state.ReportedTruncated = truncated;
+        Deliver(state, { LogSeverity::Warning, "Log", state.Text, (Now() - state.StartTicks) * 1e-9, 0 });
+        delivered++;
+    }
+
+    if (delivered == 0)
+        return;
+    // Una escritura al sistema por vaciado, no por mensaje
+    if (state.Console)
+        std::cout.flush();
+    if (state.File.is_open())
+        state.File.flush();
+}
+
+bool Log::AppendArgument(std::string& text, const std::byte*& cursor)
+{
+    const auto type = static_cast<ArgumentType>(*cursor);
+    if (type == ArgumentType::End)
+        return false;
+    cursor++;
+
+    char buffer[32];
+    switch (type)
+    {
+    case ArgumentType::Signed:
+    {
+        int64_t value;
+        std::memcpy(&value, cursor, sizeof(value));
+        cursor += sizeof(value);
+        text.append(buffer, std::snprintf(buffer, sizeof(buffer), "%lld", static_cast<long long>(value)));
+        break;
+    }
+    case ArgumentType::Unsigned:
+    {
+        uint64_t value;
+        std::memcpy(&value, cursor, sizeof(value));
+        cursor += sizeof(value);
+        text.append(buffer, std::snprintf(buffer, sizeof(buffer), "%llu", static_cast<unsigned long long>(value)));
+        break;
+    }
+    case ArgumentType::Float:
+    {
+        double value;
+        std::memcpy(&value, cursor, sizeof(value));
+        cursor += sizeof(value);
+        text.append(buffer, std::snprintf(buffer, sizeof(buffer), "%g", value));
+        break;
+    }
+    case ArgumentType::Pointer:
+    {
+        uint64_t value;
+        std::memcpy(&value, cursor, sizeof(value));
+        cursor += sizeof(value);
+        text.append(buffer, std::snprintf(buffer, sizeof(buffer), "0x%llx", static_cast<unsigned long long>(value)));
+        break;
+    }
+    case ArgumentType::Bool:
+        text += *cursor != std::byte{0} ? "true" : "false";
+        cursor++;
+        break;
+    case ArgumentType::Char:
+        text += static_cast<char>(*cursor);
+        cursor++;
+        break;
+    case ArgumentType::String:
+    {
+        uint32_t length;
+        std::memcpy(&length, cursor, sizeof(length));
+        cursor += sizeof(length);
+        text.append(reinterpret_cast<const char*>(cursor), length);
+        cursor += length;
+        break;
+    }
+    case ArgumentType::End:
+        break;
+    }
+    return true;
+}
+
+void Log::Format(State& state, const std::byte* record, uint32_t thread)
+{
+    RecordHeader header;
+    std::memcpy(&header, record, sizeof(header));
+    const std::byte* cursor = record + sizeof(header);
+    const LogSite& site = *header.Site;
+
+    // Cada {} toma el siguiente argumento; {{ y }} son llaves literales. Los {} sin argumento se dejan tal cual.
+    std::string& text = state.Text;
+    text.clear();
+    for (const char* c = site.Format; *c; c++)
+    {
+        if (c[0] == '{' && c[1] == '}')
+        {
+            if (!AppendArgument(text, cursor))
+                text += "{}";
+            c++;
+        }
+        else if ((c[0] == '{' && c[1] == '{') || (c[0] == '}' && c[1] == '}'))
+        {
+            text += *c;
+            c++;
+        }
+        else
+        {
+            text += *c;
+        }
+    }
+
+    const double time = header.Ticks > state.StartTicks ? (header.Ticks - state.StartTicks) * 1e-9 : 0.0;
+    Deliver(state, { site.Severity, site.Category, text, time, thread });
+}
+
+void Log::Deliver(State& state, const LogMessage& message)
+{
+    if (state.Console || state.File.is_open())
+    {
+        char prefix[96];
+        const int length = std::snprintf(prefix, sizeof(prefix), "[%9.3f] [%s] [%s] ", message.Time, GetSeverityName(message.Severity),
+                                         message.Category);
+        const std::string_view line(prefix, static_cast<size_t>(std::max(0, std::min(length, static_cast<int>(sizeof(prefix)) - 1))));
+
+        // Avisos y errores por stderr, como antes
+        if (state.Console)
+            (message.Severity >= LogSeverity::Warning ? std::cerr : std::cout) << line << message.Text << '\n';
+        if (state.File.is_open())
+            state.File << line << message.Text << '\n';
+    }
+
+    for (const auto& sink : state.Sinks)
+        sink.second(message);
+}
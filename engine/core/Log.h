@@ -0,0 +1,324 @@
+#pragma once
+
+// Registro del motor. Una llamada a LOG_* no formatea ni escribe: copia en la cola de su hilo un
+// registro binario con el sitio de la llamada (formato, categoría y severidad, estáticos) y los
+// argumentos en crudo. Un hilo de fondo vacía las colas, sustituye cada {} del formato por su
+// argumento y lo entrega a los destinos: consola, archivo (OpenFile) y los que se añadan con
+// AddSink (el panel Console del editor). En el hilo que registra cuesta unas decenas de
+// nanosegundos y nunca espera a E/S.
+//
+//     LOG_ERROR("Texture", "Failed to load texture: {}", path);
+//
+// El hilo de fondo arranca con el primer mensaje. Si una cola está llena el registro se descarta
+// y se cuenta; si no cabe en un registro (MaxRecordSize), sus textos se recortan y se marcan.
+// Después de Shutdown cada registro se entrega en el propio hilo que lo escribe.
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <type_traits>
+
+enum class LogSeverity : uint8_t
+{
+    Debug,
+    Info,
+    Warning,
+    Error,
+    Count
+};
+
+// Datos fijos de una llamada a LOG_*; su dirección identifica el formato en los registros
+struct LogSite
+{
+    LogSeverity Severity;
+    const char* Category;
+    const char* Format;
+    const char* File;
+    int Line;
+};
+
+// Un registro ya formateado, tal como lo recibe cada destino
+struct LogMessage
+{
+    LogSeverity Severity;
+    const char* Category;
+    std::string_view Text;
+    // Segundos desde el arranque, en el momento de la llamada
+    double Time;
+    // Orden en que cada hilo registró su primer mensaje
+    uint32_t Thread;
+};
+
+// Cola de bytes de un productor y un consumidor para los registros de un hilo
+class LogQueue
+{
+public:
+    static constexpr size_t Capacity = 64 * 1024;
+
+    LogQueue() : m_Buffer(std::make_unique<std::byte[]>(Capacity)) {}
+
+    // Hilo productor: escribe 'size' bytes con 'fill' si caben seguidos; falso si la cola está llena
+    template<typename Fill>
+    bool Push(size_t size, Fill&& fill)
+    {
+        size = (size + Alignment - 1) & ~(Alignment - 1);
+        const size_t head = m_Head.load(std::memory_order_relaxed);
+        const size_t tail = m_Tail.load(std::memory_order_acquire);
+        const size_t offset = head % Capacity;
+        // Un registro nunca da la vuelta: si no cabe al final, se salta el hueco
+        const size_t skip = Capacity - offset < size ? Capacity - offset : 0;
+        if (size > MaxRecordSize || Capacity - (head - tail) < skip + size)
+            return false;
+
+        if (skip > 0)
+        {
+            const uint32_t marker = static_cast<uint32_t>(skip) | SkipFlag;
+            std::memcpy(&m_Buffer[offset], &marker, sizeof(marker));
+        }
+        const uint32_t header = static_cast<uint32_t>(size);
+        std::byte* record = &m_Buffer[(head + skip) % Capacity];
+        std::memcpy(record, &header, sizeof(header));
+        fill(record + HeaderSize);
+        m_Head.store(head + skip + size, std::memory_order_release);
+        return true;
+    }
+
+    // Hilo consumidor: entrega a 'read' cada registro pendiente (sin la cabecera)
+    template<typename Read>
+    size_t Drain(Read&& read)
+    {
+        size_t count = 0;
+        size_t tail = m_Tail.load(std::memory_order_relaxed);
+        const size_t head = m_Head.load(std::memory_order_acquire);
+        while (tail != head)
+        {
+            uint32_t header;
+            std::memcpy(&header, &m_Buffer[tail % Capacity], sizeof(header));
+            if (!(header & SkipFlag))
+            {
+                read(&m_Buffer[tail % Capacity + HeaderSize]);
+                count++;
+            }
+            tail += header & ~SkipFlag;
+        }
+        m_Tail.store(tail, std::memory_order_release);
+        return count;
+    }
+
+    static constexpr size_t HeaderSize = 8;
+    static constexpr size_t MaxRecordSize = Capacity / 4;
+
+private:
+    static constexpr size_t Alignment = 8;
+    static constexpr uint32_t SkipFlag = 0x80000000u;
+
+    std::unique_ptr<std::byte[]> m_Buffer;
+    alignas(64) std::atomic<size_t> m_Head{0};
+    alignas(64) std::atomic<size_t> m_Tail{0};
+};
+
+class Log
+{
+public:
+    using Sink = std::function<void(const LogMessage& message)>;
+
+    // Cada cuánto el hilo de fondo vacía las colas
+    static constexpr int DrainIntervalMs = 5;
+
+    template<typename... Args>
+    static void Write(const LogSite& site, const Args&... args)
+    {
+        if (site.Severity < s_MinimumSeverity.load(std::memory_order_relaxed))
+            return;
+
+        // Sin los textos el registro siempre cabe: recortarlos basta para que entre
+        constexpr size_t FixedSize = LogQueue::HeaderSize + sizeof(RecordHeader) + 1;
+        static_assert(FixedSize + sizeof...(Args) * (1 + sizeof(uint32_t) + TruncatedMark.size() + 8) <= LogQueue::MaxRecordSize,
+                      "Too many log arguments");
+
+        LogQueue& queue = GetThreadQueue();
+        // Cabeceras, argumentos y el byte de fin
+        size_t textLimit = SIZE_MAX;
+        size_t size = FixedSize + (size_t{0} + ... + ArgumentSize(args, textLimit));
+        if (size > LogQueue::MaxRecordSize)
+        {
+            // Cada texto recibe la misma parte de lo que dejan libre los demás argumentos
+            const size_t texts = (size_t{0} + ... + static_cast<size_t>(IsText<Args>));
+            const size_t others = FixedSize + (size_t{0} + ... + ArgumentSize(args, 0));
+            textLimit = (LogQueue::MaxRecordSize - others) / texts;
+            size = FixedSize + (size_t{0} + ... + ArgumentSize(args, textLimit));
+            s_Truncated.fetch_add(1, std::memory_order_relaxed);
+        }
+
+        const RecordHeader header{ &site, Now() };
+        const bool pushed = queue.Push(size, [&](std::byte* out) {
+            std::memcpy(out, &header, sizeof(header));
+            out += sizeof(header);
+            ((out = WriteArgument(out, args, textLimit)), ...);
+            *out = static_cast<std::byte>(ArgumentType::End);
+        });
+        if (!pushed)
+            s_Dropped.fetch_add(1, std::memory_order_relaxed);
+        else if (s_Stopped.load(std::memory_order_relaxed))
+            Flush();
+    }
+
+    // Archivo donde se copian todos los mensajes; vacío lo cierra
+    static bool OpenFile(const std::string& path);
+    static void SetMinimumSeverity(LogSeverity severity) { s_MinimumSeverity.store(severity, std::memory_order_relaxed); }
+    // Copia también los mensajes a stdout/stderr (activado por defecto)
+    static void SetConsoleOutput(bool enabled);
+
+    // Los destinos se llaman en el hilo de fondo; devuelve el identificador para RemoveSink
+    static size_t AddSink(Sink sink);
+    static void RemoveSink(size_t id);
+
+    // Entrega ya, en este hilo, los mensajes registrados hasta ahora
+    static void Flush();
+    // Vacía las colas y detiene el hilo; lo que llegue después se entrega directamente.
+    // También se llama al salir del programa.
+    static void Shutdown();
+
+    // Mensajes descartados con la cola llena, y mensajes recortados por no caber en un registro
+    static uint64_t GetDropped() { return s_Dropped.load(std::memory_order_relaxed); }
+    static uint64_t GetTruncated() { return s_Truncated.load(std::memory_order_relaxed); }
+    static const char* GetSeverityName(LogSeverity severity);
+
+private:
+    enum class ArgumentType : uint8_t
+    {
+        End,
+        Signed,
+        Unsigned,
+        Float,
+        Bool,
+        Char,
+        String,
+        Pointer
+    };
+
+    struct RecordHeader
+    {
+        const LogSite* Site;
+        uint64_t Ticks;
+    };
+
+    template<typename T>
+    static constexpr bool IsText = std::is_convertible_v<const T&, std::string_view> || std::is_same_v<std::decay_t<T>, char*> ||
+                                   std::is_same_v<std::decay_t<T>, const char*>;
+
+    // Se añade al final de un texto recortado
+    static constexpr std::string_view TruncatedMark = "... [truncated]";
+
+    static std::string_view ToText(const char* text) { return text ? std::string_view(text) : std::string_view("(null)"); }
+    static std::string_view ToText(std::string_view text) { return text; }
+
+    // Con 'textLimit' los textos más largos ocupan ese límite más la marca de recorte
+    template<typename T>
+    static size_t ArgumentSize(const T& value, size_t textLimit)
+    {
+        using U = std::decay_t<T>;
+        if constexpr (std::is_same_v<U, bool> || std::is_same_v<U, char>)
+            return 2;
+        else if constexpr (IsText<T>)
+        {
+            const size_t length = ToText(value).size();
+            return 1 + sizeof(uint32_t) + (length > textLimit ? textLimit + TruncatedMark.size() : length);
+        }
+        else if constexpr (std::is_arithmetic_v<U> || std::is_enum_v<U> || std::is_pointer_v<U>)
+            return 1 + 8;
+        else
+            static_assert(sizeof(U) == 0, "Unsupported log argument type");
+    }
+
+    template<typename T>
+    static std::byte* WriteArgument(std::byte* out, const T& value, size_t textLimit)
+    {
+        using U = std::decay_t<T>;
+        auto put = [&out](ArgumentType type, const void* data, size_t size) {
+            *out++ = static_cast<std::byte>(type);
+            std::memcpy(out, data, size);
+            out += size;
+        };
+
+        if constexpr (std::is_same_v<U, bool> || std::is_same_v<U, char>)
+        {
+            put(std::is_same_v<U, bool> ? ArgumentType::Bool : ArgumentType::Char, &value, 1);
+        }
+        else if constexpr (IsText<T>)
+        {
+            std::string_view text = ToText(value);
+            const bool truncated = text.size() > textLimit;
+            if (truncated)
+                text = text.substr(0, textLimit);
+            const uint32_t length = static_cast<uint32_t>(text.size() + (truncated ? TruncatedMark.size() : 0));
+            put(ArgumentType::String, &length, sizeof(length));
+            std::memcpy(out, text.data(), text.size());
+            out += text.size();
+            if (truncated)
+            {
+                std::memcpy(out, TruncatedMark.data(), TruncatedMark.size());
+                out += TruncatedMark.size();
+            }
+        }
+        else if constexpr (std::is_floating_point_v<U>)
+        {
+            const double number = value;
+            put(ArgumentType::Float, &number, 8);
+        }
+        else if constexpr (std::is_pointer_v<U>)
+        {
+            const uint64_t address = reinterpret_cast<uintptr_t>(value);
+            put(ArgumentType::Pointer, &address, 8);
+        }
+        else if constexpr (std::is_enum_v<U> || std::is_signed_v<U>)
+        {
+            const int64_t number = static_cast<int64_t>(value);
+            put(ArgumentType::Signed, &number, 8);
+        }
+        else
+        {
+            const uint64_t number = value;
+            put(ArgumentType::Unsigned, &number, 8);
+        }
+        return out;
+    }
+
+    struct State;
+
+    // No se destruye nunca: se puede registrar durante la destrucción de otros estáticos
+    static State& GetState();
+    static LogQueue& GetThreadQueue();
+    static uint64_t Now();
+
+    static void Run();
+    // Lo que sigue, con el mutex del estado tomado: solo un hilo lee las colas a la vez
+    static void DrainAll(State& state);
+    static void Format(State& state, const std::byte* record, uint32_t thread);
+    // Añade el argumento de 'cursor' y lo avanza; falso si no quedan
+    static bool AppendArgument(std::string& text, const std::byte*& cursor);
+    static void Deliver(State& state, const LogMessage& message);
+
+    static std::atomic<LogSeverity> s_MinimumSeverity;
+    static std::atomic<uint64_t> s_Dropped;
+    static std::atomic<uint64_t> s_Truncated;
+    static std::atomic<bool> s_Stopped;
+    static thread_local LogQueue* t_Queue;
+};
+
+#define FERX_LOG(severity, category, format, ...)                                                                    \
+    do                                                                                                               \
+    {                                                                                                                \
+        static constexpr LogSite logSite{ LogSeverity::severity, category, format, __FILE__, __LINE__ };             \
+        Log::Write(logSite __VA_OPT__(, ) __VA_ARGS__);                                                              \
+    } while (false)
+
+#define LOG_DEBUG(category, format, ...) FERX_LOG(Debug, category, format __VA_OPT__(, ) __VA_ARGS__)
+#define LOG_INFO(category, format, ...) FERX_LOG(Info, category, format __VA_OPT__(, ) __VA_ARGS__)
+#define LOG_WARNING(category, format, ...) FERX_LOG(Warning, category, format __VA_OPT__(, ) __VA_ARGS__)
+#define LOG_ERROR(category, format, ...) FERX_LOG(Error, category, format __VA_OPT__(, ) __VA_ARGS__)
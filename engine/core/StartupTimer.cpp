@@ -0,0 +1,55 @@
+#include "StartupTimer.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <thread>
+
+std::mutex StartupTimer::s_Mutex;
+std::vector<StartupPhase> StartupTimer::s_Phases;
+double StartupTimer::s_FirstFrameMs = -1.0;
+
+namespace
+{
+    // Referencia tomada durante la inicialización estática, antes de main
+    const std::chrono::steady_clock::time_point s_ProgramStart = std::chrono::steady_clock::now();
+    const std::thread::id s_MainThread = std::this_thread::get_id();
+}
+
+double StartupTimer::Now()
+{
+    return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - s_ProgramStart).count();
+}
+
+void StartupTimer::Record(const std::string& name, double startMs, double endMs)
+{
+    std::lock_guard<std::mutex> lock(s_Mutex);
+    s_Phases.push_back({ name, startMs, endMs - startMs, std::this_thread::get_id() != s_MainThread });
+}
+
+void StartupTimer::MarkFirstFrame()
+{
+    if (s_FirstFrameMs < 0.0)
+        s_FirstFrameMs = Now();
+}
+
+std::vector<StartupPhase> StartupTimer::GetPhases()
+{
+    std::vector<StartupPhase> phases;
+    {
+        std::lock_guard<std::mutex> lock(s_Mutex);
+        phases = s_Phases;
+    }
+    std::sort(phases.begin(), phases.end(), [](const StartupPhase& a, const StartupPhase& b) { return a.StartMs < b.StartMs; });
+    return phases;
+}
+
+void StartupTimer::PrintReport()
+{
+    std::printf("Startup phases:\n");
+    for (const StartupPhase& phase : GetPhases())
+        std::printf("  %-28s %9.2f ms (at %8.2f ms)%s\n", phase.Name.c_str(), phase.DurationMs, phase.StartMs, phase.Worker ? " [worker]" : "");
+
+    if (s_FirstFrameMs >= 0.0)
+        std::printf("Time to first frame: %.2f ms\n", s_FirstFrameMs);
+}
@@ -0,0 +1,55 @@
+#pragma once
+
+// Tiempos del arranque: fases con nombre (en el hilo principal o en hilos de trabajo) y el tiempo
+// hasta el primer frame, medidos desde la inicialización estática del programa. No depende del
+// Profiler, así que también funciona en builds de shipping y antes de Profiler::Init.
+
+#include <mutex>
+#include <string>
+#include <vector>
+
+struct StartupPhase
+{
+    std::string Name;
+    double StartMs{};
+    double DurationMs{};
+    // Fuera del hilo principal: se solapa con el resto del arranque
+    bool Worker{};
+};
+
+class StartupTimer
+{
+public:
+    // Milisegundos desde el arranque del programa
+    static double Now();
+
+    // Se puede llamar desde cualquier hilo
+    static void Record(const std::string& name, double startMs, double endMs);
+
+    // Solo cuenta la primera llamada
+    static void MarkFirstFrame();
+    // Negativo hasta que se presenta el primer frame
+    static double GetTimeToFirstFrame() { return s_FirstFrameMs; }
+
+    static std::vector<StartupPhase> GetPhases();
+    static void PrintReport();
+
+private:
+    static std::mutex s_Mutex;
+    static std::vector<StartupPhase> s_Phases;
+    static double s_FirstFrameMs;
+};
+
+class StartupScope
+{
+public:
+    explicit StartupScope(const char* name) : m_Name(name), m_Start(StartupTimer::Now()) {}
+    ~StartupScope() { StartupTimer::Record(m_Name, m_Start, StartupTimer::Now()); }
+
+    StartupScope(const StartupScope&) = delete;
+    StartupScope& operator=(const StartupScope&) = delete;
+
+private:
+    const char* m_Name;
+    double m_Start;
+};
@@ -0,0 +1,140 @@
+#pragma once
+
+#include <coroutine>
+#include <exception>
+#include <optional>
+#include <utility>
+
+// Corrutina perezosa: no empieza hasta que se espera con co_await (o se entrega a
+// TaskScheduler::Detach/Run). Al terminar reanuda directamente a quien la esperaba, en el hilo
+// en el que haya acabado. Las excepciones se guardan y se relanzan en el co_await.
+template<typename T = void>
+class Task;
+
+struct TaskPromiseBase
+{
+    // Corrutina que espera a esta; se reanuda al terminar
+    std::coroutine_handle<> Continuation;
+    std::exception_ptr Exception;
+
+    std::suspend_always initial_suspend() noexcept { return {}; }
+
+    struct FinalAwaiter
+    {
+        bool await_ready() noexcept { return false; }
+
+        template<typename Promise>
+        std::coroutine_handle<> await_suspend(std::coroutine_handle<Promise> handle) noexcept
+        {
+            // Transferencia simétrica: sin recursión de pila al encadenar muchas tareas
+            if (std::coroutine_handle<> continuation = handle.promise().Continuation)
+                return continuation;
+            return std::noop_coroutine();
+        }
+
+        void await_resume() noexcept {}
+    };
+
+    FinalAwaiter final_suspend() noexcept { return {}; }
+    void unhandled_exception() { Exception = std::current_exception(); }
+};
+
+template<typename T>
+struct TaskPromise : TaskPromiseBase
+{
+    std::optional<T> Value;
+
+    Task<T> get_return_object();
+
+    template<typename U>
+    void return_value(U&& value) { Value.emplace(std::forward<U>(value)); }
+
+    T TakeResult()
+    {
+        if (Exception)
+            std::rethrow_exception(Exception);
+        return std::move(*Value);
+    }
+};
+
+template<>
+struct TaskPromise<void> : TaskPromiseBase
+{
+    Task<void> get_return_object();
+
+    void return_void() {}
+
+    void TakeResult()
+    {
+        if (Exception)
+            std::rethrow_exception(Exception);
+    }
+};
+
+template<typename T>
+class Task
+{
+public:
+    using promise_type = TaskPromise<T>;
+    using Handle = std::coroutine_handle<promise_type>;
+
+    Task() = default;
+    explicit Task(Handle handle) : m_Handle(handle) {}
+    ~Task()
+    {
+        if (m_Handle)
+            m_Handle.destroy();
+    }
+
+    Task(Task&& other) noexcept : m_Handle(std::exchange(other.m_Handle, {})) {}
+    Task& operator=(Task&& other) noexcept
+    {
+        if (this != &other)
+        {
+            if (m_Handle)
+                m_Handle.destroy();
+            m_Handle = std::exchange(other.m_Handle, {});
+        }
+        return *this;
+    }
+
+    Task(const Task&) = delete;
+    Task& operator=(const Task&) = delete;
+
+    bool IsValid() const { return static_cast<bool>(m_Handle); }
+    bool IsDone() const { return m_Handle && m_Handle.done(); }
+
+    struct Awaiter
+    {
+        Handle Coroutine;
+
+        bool await_ready() const noexcept { return !Coroutine || Coroutine.done(); }
+
+        std::coroutine_handle<> await_suspend(std::coroutine_handle<> awaiting) noexcept
+        {
+            // Arranca la tarea en este hilo; al terminar vuelve a 'awaiting'
+            Coroutine.promise().Continuation = awaiting;
+            return Coroutine;
+        }
+
+        T await_resume() { return Coroutine.promise().TakeResult(); }
+    };
+
+    // La tarea sigue perteneciendo a este objeto: se destruye con él, ya terminada
+    Awaiter operator co_await() const& noexcept { return Awaiter{ m_Handle }; }
+    Awaiter operator co_await() const&& noexcept { return Awaiter{ m_Handle }; }
+
+private:
+    Handle m_Handle;
+};
+
+template<typename T>
+Task<T> TaskPromise<T>::get_return_object()
+{
+    return Task<T>{ std::coroutine_handle<TaskPromise<T>>::from_promise(*this) };
+}
+
+inline Task<void> TaskPromise<void>::get_return_object()
+{
+    return Task<void>{ std::coroutine_handle<TaskPromise<void>>::from_promise(*this) };
+}
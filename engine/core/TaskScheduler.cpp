@@ -0,0 +1,158 @@
+#include "TaskScheduler.h"
+#include "ThreadPool.h"
+#include "Renderer.h"
+#include "Profiler.h"
+#include "Log.h"
+
+
+std::mutex TaskScheduler::s_RenderMutex;
+std::vector<TaskScheduler::RenderThreadAwaiter*> TaskScheduler::s_RenderQueue;
+bool TaskScheduler::s_RenderClosed = false;
+
+void TaskScheduler::WorkerAwaiter::await_suspend(std::coroutine_handle<> handle) const
+{
+    ThreadPool::Get().Submit([handle]() { handle.resume(); });
+}
+
+bool TaskScheduler::RenderThreadAwaiter::await_suspend(std::coroutine_handle<> handle)
+{
+    {
+        std::lock_guard<std::mutex> lock(s_RenderMutex);
+        // Sin hilo de render no se suspende: await_resume lanza en este mismo hilo
+        if (s_RenderClosed)
+        {
+            Cancelled = true;
+            return false;
+        }
+        Handle = handle;
+        s_RenderQueue.push_back(this);
+    }
+    // Con el editor en reposo no habría próximo frame hasta el siguiente evento
+    Renderer::Invalidate();
+    return true;
+}
+
+void TaskScheduler::ReadAwaiter::await_suspend(std::coroutine_handle<> handle)
+{
+    // El callback corre en el hilo de E/S: la tarea sigue en un trabajador para no frenar otras lecturas
+    AsyncIO::Get().Read(std::move(Request), [this, handle](FileReadResult&& result) {
+        Result = std::move(result);
+        ThreadPool::Get().Submit([handle]() { handle.resume(); });
+    });
+}
+
+TaskScheduler::ReadAwaiter TaskScheduler::ReadFile(const std::string& path)
+{
+    FileReadRequest request;
+    request.Path = path;
+    return ReadFile(std::move(request));
+}
+
+Task<void> TaskScheduler::WhenAll(std::vector<Task<void>> tasks)
+{
+    auto state = std::make_shared<JoinState>(tasks.size());
+    for (Task<void>& task : tasks)
+        RunJoined(std::move(task), state);
+
+    // Descuenta la parte de esta corrutina; si ya terminaron todas no llega a suspenderse
+    struct JoinAwaiter
+    {
+        JoinState& State;
+
+        bool await_ready() const noexcept { return false; }
+        bool await_suspend(std::coroutine_handle<> handle) const noexcept
+        {
+            State.Waiting = handle;
+            return State.Remaining.fetch_sub(1, std::memory_order_acq_rel) != 1;
+        }
+        void await_resume() const noexcept {}
+    };
+    co_await JoinAwaiter{ *state };
+
+    if (state->Exception)
+        std::rethrow_exception(state->Exception);
+}
+
+TaskScheduler::DetachedTask TaskScheduler::RunJoined(Task<void> task, std::shared_ptr<JoinState> state)
+{
+    try
+    {
+        co_await task;
+    }
+    catch (...)
+    {
+        std::lock_guard<std::mutex> lock(state->ExceptionMutex);
+        if (!state->Exception)
+            state->Exception = std::current_exception();
+    }
+
+    // La última en terminar reanuda a quien espera, en este mismo hilo
+    if (state->Remaining.fetch_sub(1, std::memory_order_acq_rel) == 1)
+        state->Waiting.resume();
+}
+
+void TaskScheduler::Detach(Task<void> task)
+{
+    RunDetached(std::move(task));
+}
+
+TaskScheduler::DetachedTask TaskScheduler::RunDetached(Task<void> task)
+{
+    try
+    {
+        co_await task;
+    }
+    catch (const TaskCancelled&)
+    {
+        // Apagado con la tarea a medias: no es un error de la tarea
+        LOG_DEBUG("TaskScheduler", "Detached task cancelled at shutdown");
+    }
+    catch (const std::exception& exception)
+    {
+        LOG_ERROR("TaskScheduler", "Unhandled exception in detached task: {}", exception.what());
+    }
+    catch (...)
+    {
+        LOG_ERROR("TaskScheduler", "Unhandled exception in detached task");
+    }
+}
+
+void TaskScheduler::ResumeRenderThreadTasks()
+{
+    std::vector<RenderThreadAwaiter*> tasks;
+    {
+        std::lock_guard<std::mutex> lock(s_RenderMutex);
+        if (s_RenderQueue.empty())
+            return;
+        tasks.swap(s_RenderQueue);
+    }
+
+    PROFILE_SCOPE("TaskScheduler::ResumeRenderThreadTasks");
+    // Las que vuelvan a pedir el hilo de render se encolan para el frame siguiente
+    for (RenderThreadAwaiter* task : tasks)
+        task->Handle.resume();
+}
+
+void TaskScheduler::CancelRenderThreadTasks()
+{
+    std::vector<RenderThreadAwaiter*> tasks;
+    {
+        std::lock_guard<std::mutex> lock(s_RenderMutex);
+        s_RenderClosed = true;
+        tasks.swap(s_RenderQueue);
+    }
+
+    for (RenderThreadAwaiter* task : tasks)
+    {
+        // El awaiter vive en el marco de la tarea: puede no existir después de reanudarla
+        const std::coroutine_handle<> handle = task->Handle;
+        task->Cancelled = true;
+        handle.resume();
+    }
+}
+
+size_t TaskScheduler::GetPendingRenderThreadTasks()
+{
+    std::lock_guard<std::mutex> lock(s_RenderMutex);
+    return s_RenderQueue.size();
+}
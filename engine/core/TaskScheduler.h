@@ -0,0 +1,178 @@
+#pragma once
+
+#include "Task.h"
+#include "AsyncIO.h"
+
+#include <atomic>
+#include <coroutine>
+#include <exception>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+// Planificación de corrutinas (Task<T>) sobre los hilos del motor. Una carga de varios pasos se
+// escribe en orden y cada co_await decide dónde sigue:
+//
+//     FileReadResult file = co_await TaskScheduler::ReadFile(path);   // hilo de E/S -> trabajador
+//     Decode(file, image);                                            // hilo de trabajo
+//     co_await TaskScheduler::SwitchToRenderThread();                 // próximo frame, con OpenGL
+//     texture->Upload(image);
+//
+// Los hilos de trabajo son los de ThreadPool::Get(). El hilo de render reanuda sus tareas al empezar
+// Renderer::Submit, así que el salto siempre cae en el frame siguiente. Al apagar el renderizador
+// las que sigan esperando (o lleguen después) se reanudan con TaskCancelled.
+
+// Lo lanza el co_await de una tarea que ya no puede seguir porque su hilo se cerró
+class TaskCancelled : public std::exception
+{
+public:
+    const char* what() const noexcept override { return "Task cancelled: the render thread has shut down"; }
+};
+
+class TaskScheduler
+{
+public:
+    // Sigue en un hilo de trabajo
+    struct WorkerAwaiter
+    {
+        bool await_ready() const noexcept { return false; }
+        void await_suspend(std::coroutine_handle<> handle) const;
+        void await_resume() const noexcept {}
+    };
+
+    // Sigue en el hilo con el contexto de OpenGL al empezar su próximo frame
+    struct RenderThreadAwaiter
+    {
+        std::coroutine_handle<> Handle;
+        bool Cancelled = false;
+
+        bool await_ready() const noexcept { return false; }
+        bool await_suspend(std::coroutine_handle<> handle);
+        void await_resume() const
+        {
+            if (Cancelled)
+                throw TaskCancelled();
+        }
+    };
+
+    // Lee con AsyncIO y sigue en un hilo de trabajo (no en el de E/S) con el resultado
+    struct ReadAwaiter
+    {
+        FileReadRequest Request;
+        FileReadResult Result;
+
+        bool await_ready() const noexcept { return false; }
+        void await_suspend(std::coroutine_handle<> handle);
+        FileReadResult await_resume() { return std::move(Result); }
+    };
+
+    static WorkerAwaiter SwitchToWorker() { return {}; }
+    static RenderThreadAwaiter SwitchToRenderThread() { return {}; }
+    static ReadAwaiter ReadFile(FileReadRequest request) { return ReadAwaiter{ std::move(request), {} }; }
+    static ReadAwaiter ReadFile(const std::string& path);
+
+    // Espera a todas las tareas, que avanzan a la vez; el resultado conserva el orden.
+    // Si alguna falla se relanza la primera excepción cuando han terminado todas.
+    static Task<void> WhenAll(std::vector<Task<void>> tasks);
+
+    template<typename T>
+    static Task<std::vector<T>> WhenAll(std::vector<Task<T>> tasks)
+    {
+        std::vector<std::optional<T>> slots(tasks.size());
+        std::vector<Task<void>> stores;
+        stores.reserve(tasks.size());
+        for (size_t i = 0; i < tasks.size(); i++)
+            stores.push_back(Store(std::move(tasks[i]), &slots[i]));
+        co_await WhenAll(std::move(stores));
+
+        std::vector<T> results;
+        results.reserve(slots.size());
+        for (std::optional<T>& slot : slots)
+            results.push_back(std::move(*slot));
+        co_return results;
+    }
+
+    // Arranca la tarea en este hilo y la suelta: se destruye sola al terminar.
+    // Una excepción sin capturar se informa en el registro.
+    static void Detach(Task<void> task);
+
+    // Arranca la tarea en este hilo y entrega su resultado por un future, para quien no es corrutina
+    template<typename T>
+    static std::future<T> Run(Task<T> task)
+    {
+        auto promise = std::make_shared<std::promise<T>>();
+        std::future<T> future = promise->get_future();
+        Detach(Complete(std::move(task), std::move(promise)));
+        return future;
+    }
+
+    // Reanuda las tareas que esperan al hilo de render. Lo llama Renderer::Submit (y Shutdown).
+    static void ResumeRenderThreadTasks();
+    // Cierra el hilo de render para las tareas: las que esperan y las que lo pidan después siguen
+    // en el hilo que llega con TaskCancelled, así que sus futures y sus marcos no quedan colgados
+    static void CancelRenderThreadTasks();
+    static size_t GetPendingRenderThreadTasks();
+
+private:
+    // Tarea sin dueño que arranca al crearse y libera su estado al terminar
+    struct DetachedTask
+    {
+        struct promise_type
+        {
+            DetachedTask get_return_object() noexcept { return {}; }
+            std::suspend_never initial_suspend() noexcept { return {}; }
+            std::suspend_never final_suspend() noexcept { return {}; }
+            void return_void() noexcept {}
+            void unhandled_exception() noexcept { std::terminate(); }
+        };
+    };
+
+    struct JoinState
+    {
+        // Tareas sin terminar más uno por la corrutina que espera
+        std::atomic<size_t> Remaining;
+        std::coroutine_handle<> Waiting;
+        std::mutex ExceptionMutex;
+        std::exception_ptr Exception;
+
+        explicit JoinState(size_t count) : Remaining(count + 1) {}
+    };
+
+    static DetachedTask RunDetached(Task<void> task);
+    static DetachedTask RunJoined(Task<void> task, std::shared_ptr<JoinState> state);
+
+    template<typename T>
+    static Task<void> Store(Task<T> task, std::optional<T>* slot)
+    {
+        slot->emplace(co_await task);
+    }
+
+    template<typename T>
+    static Task<void> Complete(Task<T> task, std::shared_ptr<std::promise<T>> promise)
+    {
+        try
+        {
+            if constexpr (std::is_void_v<T>)
+            {
+                co_await task;
+                promise->set_value();
+            }
+            else
+            {
+                promise->set_value(co_await task);
+            }
+        }
+        catch (...)
+        {
+            promise->set_exception(std::current_exception());
+        }
+    }
+
+    static std::mutex s_RenderMutex;
+    static std::vector<RenderThreadAwaiter*> s_RenderQueue;
+    static bool s_RenderClosed;
+};
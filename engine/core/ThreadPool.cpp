@@ -0,0 +1,62 @@
+#include "ThreadPool.h"
+#include "Profiler.h"
+
+#include <algorithm>
+#include <string>
+
+ThreadPool::ThreadPool(unsigned int threadCount)
+{
+    if (threadCount == 0)
+        threadCount = std::max(2u, std::thread::hardware_concurrency()) - 1; // hardware_concurrency puede dar 0
+
+    m_Threads.reserve(threadCount);
+    for (unsigned int i = 0; i < threadCount; i++)
+        m_Threads.emplace_back(&ThreadPool::Run, this, i);
+}
+
+ThreadPool::~ThreadPool()
+{
+    Shutdown();
+}
+
+void ThreadPool::Shutdown()
+{
+    {
+        std::lock_guard<std::mutex> lock(m_Mutex);
+        m_Stopping = true;
+    }
+    m_Condition.notify_all();
+
+    for (std::thread& thread : m_Threads)
+    {
+        if (thread.joinable())
+            thread.join();
+    }
+    m_Threads.clear();
+}
+
+ThreadPool& ThreadPool::Get()
+{
+    static ThreadPool pool;
+    return pool;
+}
+
+void ThreadPool::Run(unsigned int index)
+{
+    PROFILE_THREAD("Worker " + std::to_string(index));
+
+    for (;;)
+    {
+        std::function<void()> task;
+        {
+            std::unique_lock<std::mutex> lock(m_Mutex);
+            m_Condition.wait(lock, [this]() { return m_Stopping || !m_Tasks.empty(); });
+            // Al parar se vacía la cola: nadie debe quedarse esperando un future que no llega
+            if (m_Tasks.empty())
+                return;
+            task = std::move(m_Tasks.front());
+            m_Tasks.pop_front();
+        }
+        task();
+    }
+}
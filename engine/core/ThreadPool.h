@@ -0,0 +1,66 @@
+#pragma once
+
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+// Hilos de trabajo para tareas sin OpenGL (lectura de archivos, decodificación de imágenes,
+// rasterizado de fuentes). Las tareas se ejecutan en orden de llegada y devuelven un std::future;
+// el resultado (o la excepción) se recoge con get() desde el hilo que la necesite.
+class ThreadPool
+{
+public:
+    // 0 hilos = uno menos que los núcleos disponibles (al menos uno)
+    explicit ThreadPool(unsigned int threadCount = 0);
+    ~ThreadPool();
+
+    ThreadPool(const ThreadPool&) = delete;
+    ThreadPool& operator=(const ThreadPool&) = delete;
+
+    // Después de Shutdown ningún hilo recogería la tarea: se ejecuta en el hilo que llama
+    template<typename F>
+    auto Submit(F&& task) -> std::future<std::invoke_result_t<std::decay_t<F>>>
+    {
+        using Result = std::invoke_result_t<std::decay_t<F>>;
+        // std::function exige tareas copiables; packaged_task no lo es
+        auto packaged = std::make_shared<std::packaged_task<Result()>>(std::forward<F>(task));
+        std::future<Result> result = packaged->get_future();
+        bool queued = false;
+        {
+            std::lock_guard<std::mutex> lock(m_Mutex);
+            if (!m_Stopping)
+            {
+                m_Tasks.emplace_back([packaged]() { (*packaged)(); });
+                queued = true;
+            }
+        }
+        if (queued)
+            m_Condition.notify_one();
+        else
+            (*packaged)();
+        return result;
+    }
+
+    // Termina las tareas pendientes y espera a los hilos
+    void Shutdown();
+
+    unsigned int GetThreadCount() const { return static_cast<unsigned int>(m_Threads.size()); }
+
+    // Pool compartido del motor; se crea con el primer uso
+    static ThreadPool& Get();
+
+private:
+    void Run(unsigned int index);
+
+    std::vector<std::thread> m_Threads;
+    std::deque<std::function<void()>> m_Tasks;
+    std::mutex m_Mutex;
+    std::condition_variable m_Condition;
+    bool m_Stopping = false;
+};
@@ -6,14 +6,22 @@
 #include <GLFW/glfw3.h>
 // Incluye string para el manejo de cadenas de texto (título de la ventana)
 #include <string>
-// Incluye iostream para mensajes de error y depuración
-#include <iostream>
+// Incluye Log.h para mensajes de error y depuración (LOG_*)
+#include "Log.h"
 // Incluye Renderer.h si Window necesita alguna información del renderizador
 // (aunque en este archivo no parece ser directamente usada, se mantiene por si acaso)
 #include <Renderer.h>
 // Incluye stb_image para cargar iconos de ventana
 #define STB_IMAGE_IMPLEMENTATION // ¡IMPORTANTE! Definir esto solo una vez en todo el proyecto
 #include <stb_image.h>
+// Hilos de trabajo para decodificar el icono mientras se crea la ventana
+#include "ThreadPool.h"
+// Fases del arranque (creación de la ventana, icono)
+#include "StartupTimer.h"
+// Modos de presentación (intervalo de swap)
+#include "FramePacer.h"
+// Lectura asíncrona del archivo del icono
+#include "AsyncIO.h"
 
 // Constructor por defecto, llama a Init()
 Window::Window()
@@ -28,6 +36,13 @@ Window::Window(const std::string& title, const int width, const int height)
     Init();
 }
 
+// Constructor con la configuración completa (p. ej. una ventana oculta)
+Window::Window(const WindowData& data)
+{
+    m_Data = data;
+    Init();
+}
+
 // Destructor, llama a Shutdown() para liberar recursos
 Window::~Window()
 {
@@ -37,19 +52,37 @@ Window::~Window()
 // Inicializa la ventana de GLFW y el contexto de OpenGL
 void Window::Init()
 {
+    // En modo headless no se toca GLFW: el contexto se crea con EGL y el tamaño es el pedido
+    if (m_Data.Headless) {
+        m_Headless = std::make_unique<HeadlessContext>();
+        if (!m_Headless->Init(m_Data.Size.Width, m_Data.Size.Height))
+            m_Headless.reset();
+        return;
+    }
+
+    StartupScope phase("Window");
+
+    // El icono se decodifica en un hilo de trabajo mientras GLFW se inicializa y crea la ventana.
+    std::future<GLFWimage> icon = ThreadPool::Get().Submit([]() {
+        StartupScope iconPhase("Window icon decode");
+        return LoadIcon();
+    });
+
     // Intenta inicializar GLFW
     if (!glfwInit()) {
-        std::cerr << "Failed to initialize GLFW" << std::endl;
+        LOG_ERROR("Window", "Failed to initialize GLFW");
+        stbi_image_free(icon.get().pixels);
         return; // Sale si falla la inicialización de GLFW
     }
 
-    std::cout << "GLFW Initialized" << std::endl;
+    LOG_INFO("Window", "GLFW Initialized");
 
     // Configura hints para la creación de la ventana de OpenGL
     glfwWindowHint(GLFW_CONTEXT_VERSION_MAJOR, 3); // Versión mayor de OpenGL
     glfwWindowHint(GLFW_CONTEXT_VERSION_MINOR, 3); // Versión menor de OpenGL
     glfwWindowHint(GLFW_OPENGL_PROFILE, GLFW_OPENGL_CORE_PROFILE); // Perfil Core de OpenGL
     glfwWindowHint(GLFW_SCALE_TO_MONITOR, GLFW_TRUE); // Habilita el escalado a monitores de alta DPI
+    glfwWindowHint(GLFW_VISIBLE, m_Data.Visible ? GLFW_TRUE : GLFW_FALSE); // Ventana oculta si no se va a mostrar
 
     // Configuraciones específicas para Linux (X11)
 #if defined(_WIN32)
@@ -62,24 +95,25 @@ void Window::Init()
     // Crea la ventana de GLFW
     m_Window = glfwCreateWindow(m_Data.Size.Width, m_Data.Size.Height, m_Data.Title.c_str(), nullptr, nullptr);
     if (!m_Window) {
-        std::cerr << "Failed to create GLFW window" << std::endl;
+        LOG_ERROR("Window", "Failed to create GLFW window");
         glfwTerminate(); // Termina GLFW si la ventana no se crea
+        stbi_image_free(icon.get().pixels);
         return;
     }
 
     // Obtiene y guarda la escala de contenido de la ventana
     GetScale();
 
-    // Establece el icono de la ventana
-    SetWindowIcon();
+    // Establece el icono de la ventana (espera a que termine de decodificarse)
+    SetWindowIcon(icon.get());
 
     // Establece el contexto de OpenGL como el actual para esta ventana
     glfwMakeContextCurrent(m_Window);
 
-    // Habilita VSync (sincronización vertical).
-    // Esto limita la tasa de fotogramas a la tasa de refresco del monitor (ej. 60 FPS)
-    // y elimina el "tearing" (desgarro de pantalla).
-    glfwSwapInterval(1); // 1 para VSync activado, 0 para desactivado
+    // Aplica el modo de presentación (VSync por defecto).
+    // VSync limita la tasa de fotogramas a la tasa de refresco del monitor (ej. 60 FPS)
+    // y elimina el "tearing" (desgarro de pantalla); el resto de modos se eligen en el editor.
+    FramePacer::Init();
 }
 
 // Métodos estáticos Create() que devuelven un objeto Window por valor.
@@ -101,6 +135,20 @@ GLFWwindow* Window::GetNativeWindow() const
     return m_Window;
 }
 
+// Indica si hay un contexto de OpenGL utilizable
+bool Window::IsValid() const
+{
+    return m_Window != nullptr || (m_Headless && m_Headless->IsValid());
+}
+
+// Devuelve el cargador de funciones de OpenGL adecuado para el contexto actual
+GLADloadproc Window::GetProcLoader() const
+{
+    if (m_Data.Headless)
+        return reinterpret_cast<GLADloadproc>(HeadlessContext::GetProcAddress);
+    return reinterpret_cast<GLADloadproc>(glfwGetProcAddress);
+}
+
 // Devuelve el título de la ventana
 const std::string& Window::GetTitle() const
 {
@@ -110,6 +158,10 @@ const std::string& Window::GetTitle() const
 // Obtiene y devuelve el tamaño actual de la ventana
 WindowSize Window::GetSize()
 {
+    // Sin ventana el tamaño es fijo
+    if (!m_Window)
+        return m_Data.Size;
+
     glfwGetWindowSize(m_Window, &m_Data.Size.Width, &m_Data.Size.Height);
     return m_Data.Size;
 }
@@ -117,6 +169,9 @@ WindowSize Window::GetSize()
 // Obtiene y devuelve la escala de contenido de la ventana
 WindowScale Window::GetScale()
 {
+    if (!m_Window)
+        return m_Data.Scale;
+
     glfwGetWindowContentScale(m_Window, &m_Data.Scale.X, &m_Data.Scale.Y);
     return m_Data.Scale;
 }
@@ -126,28 +181,50 @@ WindowScale Window::GetScale()
 // o el recurso externo de la ventana de GLFW.
 void Window::SetWindowIcon() const
 {
-    int width, height, channels;
-    // Ruta al archivo del icono (ENGINE_RESOURCES_PATH debe estar definido)
-    const char* iconPath = ENGINE_RESOURCES_PATH"icons/icon.png";
-
-    // Carga los píxeles de la imagen del icono, forzando 4 canales (RGBA)
-    unsigned char* pixels = stbi_load(iconPath, &width, &height, &channels, 4);
-    if (!pixels) {
-        std::cerr << "Failed to load icon: " << iconPath << std::endl;
-        return; // Sale si falla la carga del icono
-    }
+    SetWindowIcon(LoadIcon());
+}
 
-    // Crea una estructura GLFWimage y asigna los datos del icono
-    GLFWimage images[1];
-    images[0].width = width;
-    images[0].height = height;
-    images[0].pixels = pixels;
+// Establece un icono ya decodificado por LoadIcon() y libera sus píxeles
+void Window::SetWindowIcon(GLFWimage icon) const
+{
+    if (!icon.pixels)
+        return; // LoadIcon ya informó del error
 
     // Establece el icono de la ventana de GLFW
-    glfwSetWindowIcon(m_Window, 1, images);
+    glfwSetWindowIcon(m_Window, 1, &icon);
 
     // Libera la memoria de los píxeles cargados por stb_image
-    stbi_image_free(pixels);
+    stbi_image_free(icon.pixels);
+}
+
+// Carga el archivo del icono con stb_image; 'pixels' es nullptr si falla
+GLFWimage Window::LoadIcon()
+{
+    GLFWimage icon{};
+    int channels;
+    // Ruta al archivo del icono (ENGINE_RESOURCES_PATH debe estar definido)
+    const char* iconPath = ENGINE_RESOURCES_PATH"icons/icon.png";
+
+    // Lee el archivo con AsyncIO y decodifica los píxeles desde memoria, forzando 4 canales (RGBA)
+    const FileReadResult file = AsyncIO::Get().Read(iconPath).get();
+    if (file.Success)
+        icon.pixels = stbi_load_from_memory(file.GetBytes(), static_cast<int>(file.BytesRead), &icon.width, &icon.height, &channels, 4);
+    if (!icon.pixels)
+        LOG_ERROR("Window", "Failed to load icon: {}", iconPath);
+    return icon;
+}
+
+// Devuelve la escala de contenido del monitor principal, antes de que exista la ventana
+WindowScale Window::GetMonitorScale()
+{
+    WindowScale scale;
+    // glfwInit no hace nada si GLFW ya está inicializado
+    if (!glfwInit())
+        return scale;
+
+    if (GLFWmonitor* monitor = glfwGetPrimaryMonitor())
+        glfwGetMonitorContentScale(monitor, &scale.X, &scale.Y);
+    return scale;
 }
 
 // Apaga la ventana de GLFW
@@ -159,4 +236,7 @@ void Window::Shutdown() const
         glfwDestroyWindow(m_Window);
         // m_Window = nullptr; // No se puede asignar a nullptr si el método es const
     }
+    // Destruye el contexto EGL del modo headless
+    if (m_Headless)
+        m_Headless->Shutdown();
 }
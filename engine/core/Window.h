@@ -4,7 +4,9 @@
 #include <GLFW/glfw3.h>
 #include <string>
 #include <iostream>
+#include <memory>
 #include <Renderer.h>
+#include "HeadlessContext.h"
 
 struct WindowSize
 {
@@ -26,6 +28,10 @@ struct WindowData
     std::string Title;
     WindowSize Size;
     WindowScale Scale;
+    // Una ventana oculta sigue teniendo contexto de OpenGL (benchmarks, renderizado fuera de pantalla)
+    bool Visible = true;
+    // Sin ventana ni GLFW: contexto EGL surfaceless/pbuffer para CI y renderizado por lotes
+    bool Headless = false;
 
     WindowData(): Title("Codazzi Engine"), Size(1280, 720){}
     WindowData(const std::string& title, const int width, const int height): Title(title), Size(width, height){};
@@ -36,6 +42,7 @@ class Window
 public:
     Window();
     Window(const std::string& title, int width, int height);
+    explicit Window(const WindowData& data);
     ~Window();
 
     static Window Create();
@@ -43,15 +50,30 @@ public:
 
     void Init();
 
+    // nullptr en modo headless
     GLFWwindow* GetNativeWindow() const;
+    bool IsHeadless() const { return m_Data.Headless; }
+    // Hay un contexto de OpenGL actual (ventana o headless)
+    bool IsValid() const;
+    // Cargador de funciones de OpenGL del contexto activo, para glad
+    GLADloadproc GetProcLoader() const;
     const std::string& GetTitle() const;
     WindowSize GetSize();
     WindowScale GetScale();
 
 	void SetWindowIcon() const;
+    // Aplica un icono ya decodificado y libera sus píxeles
+    void SetWindowIcon(GLFWimage icon) const;
     void Shutdown() const;
 
+    // Escala del monitor principal; sirve antes de crear la ventana (inicializa GLFW si hace falta)
+    static WindowScale GetMonitorScale();
+
 private:
+    // Decodifica el icono de la ventana; no toca GLFW, así que puede ir en un hilo de trabajo
+    static GLFWimage LoadIcon();
+
     GLFWwindow* m_Window{};
+    std::unique_ptr<HeadlessContext> m_Headless;
     WindowData m_Data;
 };
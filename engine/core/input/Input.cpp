@@ -1,30 +1,263 @@
 #include "Engine.h"
 #include "Input.h"
 
+InputEventQueue Input::s_Events;
+InputState Input::s_State;
+Input::Binding Input::s_Bindings[InputState::ActionCount][Input::MaxBindings];
+bool Input::s_HasMousePosition = false;
+
+void Input::Init(GLFWwindow* window)
+{
+    BindDefaults();
+
+    if (!window)
+        return;
+
+    glfwSetKeyCallback(window, KeyCallback);
+    glfwSetMouseButtonCallback(window, MouseButtonCallback);
+    glfwSetCursorPosCallback(window, CursorPositionCallback);
+    glfwSetScrollCallback(window, ScrollCallback);
+
+    // Posición inicial del cursor: el primer evento ya no produce un salto
+    double x, y;
+    glfwGetCursorPos(window, &x, &y);
+    s_State.MousePosition = { static_cast<float>(x), static_cast<float>(y) };
+    s_HasMousePosition = true;
+}
+
+void Input::BindDefaults()
+{
+    for (int action = 0; action < InputState::ActionCount; action++)
+        ClearBindings(static_cast<InputAction>(action));
+
+    BindAction(InputAction::MoveForward, W);
+    BindAction(InputAction::MoveBackward, S);
+    BindAction(InputAction::MoveLeft, A);
+    BindAction(InputAction::MoveRight, D);
+    BindAction(InputAction::MoveDown, Q);
+    BindAction(InputAction::MoveUp, E);
+    BindAction(InputAction::Look, ButtonRight);
+}
+
+void Input::BeginFrame()
+{
+    s_State.KeysPressed.reset();
+    s_State.KeysReleased.reset();
+    s_State.ButtonsPressed.reset();
+    s_State.ButtonsReleased.reset();
+    s_State.MouseDelta = glm::vec2(0.0f);
+    s_State.Scroll = glm::vec2(0.0f);
+
+    // Se aplican en orden: una tecla pulsada y soltada dentro del frame deja los dos flancos
+    InputEvent event;
+    while (s_Events.Pop(event))
+        ApplyEvent(event);
+
+    UpdateActions();
+}
+
+void Input::ApplyEvent(const InputEvent& event)
+{
+    switch (event.EventType)
+    {
+    case InputEvent::Type::Key:
+        // GLFW_KEY_UNKNOWN (-1) y las repeticiones no cambian el estado
+        if (event.Code < 0 || event.Code >= InputState::KeyCount || event.Action == GLFW_REPEAT)
+            break;
+        if (event.Action == GLFW_PRESS) {
+            s_State.KeysDown.set(event.Code);
+            s_State.KeysPressed.set(event.Code);
+        } else {
+            s_State.KeysDown.reset(event.Code);
+            s_State.KeysReleased.set(event.Code);
+        }
+        break;
+    case InputEvent::Type::MouseButton:
+        if (event.Code < 0 || event.Code >= InputState::ButtonCount)
+            break;
+        if (event.Action == GLFW_PRESS) {
+            s_State.ButtonsDown.set(event.Code);
+            s_State.ButtonsPressed.set(event.Code);
+        } else {
+            s_State.ButtonsDown.reset(event.Code);
+            s_State.ButtonsReleased.set(event.Code);
+        }
+        break;
+    case InputEvent::Type::CursorPosition:
+    {
+        const glm::vec2 position{ static_cast<float>(event.X), static_cast<float>(event.Y) };
+        if (s_HasMousePosition)
+            s_State.MouseDelta += position - s_State.MousePosition;
+        s_State.MousePosition = position;
+        s_HasMousePosition = true;
+        break;
+    }
+    case InputEvent::Type::Scroll:
+        s_State.Scroll += glm::vec2(static_cast<float>(event.X), static_cast<float>(event.Y));
+        break;
+    }
+}
+
+void Input::UpdateActions()
+{
+    for (int action = 0; action < InputState::ActionCount; action++)
+    {
+        bool down = false, pressed = false, released = false;
+        for (const Binding& binding : s_Bindings[action])
+        {
+            // Un código asociado fuera de rango no cuenta (bitset::test lanzaría)
+            if (binding.Source == Binding::Device::Key && binding.Code >= 0 && binding.Code < InputState::KeyCount) {
+                down |= s_State.KeysDown.test(binding.Code);
+                pressed |= s_State.KeysPressed.test(binding.Code);
+                released |= s_State.KeysReleased.test(binding.Code);
+            } else if (binding.Source == Binding::Device::MouseButton && binding.Code >= 0 && binding.Code < InputState::ButtonCount) {
+                down |= s_State.ButtonsDown.test(binding.Code);
+                pressed |= s_State.ButtonsPressed.test(binding.Code);
+                released |= s_State.ButtonsReleased.test(binding.Code);
+            }
+        }
+
+        // Con dos teclas asociadas, soltar una mientras se mantiene la otra no suelta la acción
+        const bool wasDown = s_State.ActionsDown.test(action);
+        s_State.ActionsDown.set(action, down);
+        s_State.ActionsPressed.set(action, pressed && (!wasDown || !down || released));
+        s_State.ActionsReleased.set(action, released && !down);
+    }
+}
+
+void Input::AddBinding(InputAction action, Binding binding)
+{
+    for (Binding& slot : s_Bindings[static_cast<int>(action)])
+    {
+        if (slot.Source == Binding::Device::None) {
+            slot = binding;
+            return;
+        }
+    }
+    // Sin hueco libre se sustituye la última
+    s_Bindings[static_cast<int>(action)][MaxBindings - 1] = binding;
+}
+
+void Input::BindAction(InputAction action, KeyCode key)
+{
+    AddBinding(action, { Binding::Device::Key, key });
+}
+
+void Input::BindAction(InputAction action, MouseCode button)
+{
+    AddBinding(action, { Binding::Device::MouseButton, button });
+}
+
+void Input::ClearBindings(InputAction action)
+{
+    for (Binding& slot : s_Bindings[static_cast<int>(action)])
+        slot = Binding();
+}
+
 bool Input::IsKeyPressed(const KeyCode key)
 {
-    return glfwGetKey(Engine::Get()->GetWindow()->GetNativeWindow(), key) == GLFW_PRESS;
+    return key >= 0 && key < InputState::KeyCount && s_State.KeysDown.test(key);
+}
+
+bool Input::WasKeyPressed(const KeyCode key)
+{
+    return key >= 0 && key < InputState::KeyCount && s_State.KeysPressed.test(key);
+}
+
+bool Input::WasKeyReleased(const KeyCode key)
+{
+    return key >= 0 && key < InputState::KeyCount && s_State.KeysReleased.test(key);
 }
 
 bool Input::IsMouseButtonPressed(const MouseCode button)
 {
-    return glfwGetMouseButton(Engine::Get()->GetWindow()->GetNativeWindow(), button) == GLFW_PRESS;
+    return button >= 0 && button < InputState::ButtonCount && s_State.ButtonsDown.test(button);
 }
 
-glm::vec2 Input::GetMousePosition()
+bool Input::WasMouseButtonPressed(const MouseCode button)
+{
+    return button >= 0 && button < InputState::ButtonCount && s_State.ButtonsPressed.test(button);
+}
+
+bool Input::WasMouseButtonReleased(const MouseCode button)
 {
-    double xPos, yPos;
-    glfwGetCursorPos(Engine::Get()->GetWindow()->GetNativeWindow(), &xPos, &yPos);
+    return button >= 0 && button < InputState::ButtonCount && s_State.ButtonsReleased.test(button);
+}
 
-    return { static_cast<float>(xPos), static_cast<float>(yPos) };
+glm::vec2 Input::GetMousePosition()
+{
+    return s_State.MousePosition;
 }
 
 float Input::GetMouseX()
 {
-    return GetMousePosition().x;
+    return s_State.MousePosition.x;
 }
 
 float Input::GetMouseY()
 {
-    return GetMousePosition().y;
-}
\ No newline at end of file
+    return s_State.MousePosition.y;
+}
+
+glm::vec2 Input::GetMouseDelta()
+{
+    return s_State.MouseDelta;
+}
+
+glm::vec2 Input::GetScroll()
+{
+    return s_State.Scroll;
+}
+
+bool Input::IsActionDown(InputAction action)
+{
+    return s_State.ActionsDown.test(static_cast<int>(action));
+}
+
+bool Input::WasActionPressed(InputAction action)
+{
+    return s_State.ActionsPressed.test(static_cast<int>(action));
+}
+
+bool Input::WasActionReleased(InputAction action)
+{
+    return s_State.ActionsReleased.test(static_cast<int>(action));
+}
+
+// Los callbacks solo encolan: llegan dentro de glfwPollEvents, antes de que empiece el frame
+
+void Input::KeyCallback(GLFWwindow* window, int key, int scancode, int action, int mods)
+{
+    InputEvent event;
+    event.EventType = InputEvent::Type::Key;
+    event.Action = static_cast<uint8_t>(action);
+    event.Code = static_cast<int16_t>(key);
+    s_Events.Push(event);
+}
+
+void Input::MouseButtonCallback(GLFWwindow* window, int button, int action, int mods)
+{
+    InputEvent event;
+    event.EventType = InputEvent::Type::MouseButton;
+    event.Action = static_cast<uint8_t>(action);
+    event.Code = static_cast<int16_t>(button);
+    s_Events.Push(event);
+}
+
+void Input::CursorPositionCallback(GLFWwindow* window, double x, double y)
+{
+    InputEvent event;
+    event.EventType = InputEvent::Type::CursorPosition;
+    event.X = x;
+    event.Y = y;
+    s_Events.Push(event);
+}
+
+void Input::ScrollCallback(GLFWwindow* window, double xOffset, double yOffset)
+{
+    InputEvent event;
+    event.EventType = InputEvent::Type::Scroll;
+    event.X = xOffset;
+    event.Y = yOffset;
+    s_Events.Push(event);
+}
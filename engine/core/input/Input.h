@@ -2,16 +2,109 @@
 
 #include <glm/glm.hpp>
 
+#include <bitset>
+#include <cstdint>
+
 #include "KeyCodes.h"
 #include "MouseCodes.h"
+#include "InputEvents.h"
+
+struct GLFWwindow;
+
+// Acciones del motor; cada una se asocia a teclas o botones con Input::BindAction
+enum class InputAction : uint8_t
+{
+    MoveForward,
+    MoveBackward,
+    MoveLeft,
+    MoveRight,
+    MoveDown,
+    MoveUp,
+    // Mirar con el ratón (girar la cámara)
+    Look,
+    Count
+};
+
+// Estado de teclado y ratón de un frame. Los flancos (Pressed/Released) guardan lo que ocurrió
+// desde el frame anterior, así que una pulsación más corta que un frame no se pierde.
+struct InputState
+{
+    static constexpr int KeyCount = Menu + 1;
+    static constexpr int ButtonCount = ButtonLast + 1;
+    static constexpr int ActionCount = static_cast<int>(InputAction::Count);
+
+    std::bitset<KeyCount> KeysDown, KeysPressed, KeysReleased;
+    std::bitset<ButtonCount> ButtonsDown, ButtonsPressed, ButtonsReleased;
+    std::bitset<ActionCount> ActionsDown, ActionsPressed, ActionsReleased;
+
+    glm::vec2 MousePosition{0.0f};
+    // Movimiento del cursor y del scroll acumulados en el frame
+    glm::vec2 MouseDelta{0.0f};
+    glm::vec2 Scroll{0.0f};
+};
 
+// Entrada por eventos: los callbacks de GLFW encolan eventos (InputEventQueue) y BeginFrame los
+// aplica una vez por frame al InputState. Las consultas son pruebas de bits sobre ese estado, sin
+// llamadas a GLFW.
 class Input
 {
 public:
+    // Instala los callbacks de teclado y ratón. Debe ir antes de ImGui_ImplGlfw_InitForOpenGL,
+    // que encadena los callbacks ya instalados con los suyos.
+    static void Init(GLFWwindow* window);
+    // Vacía la cola y calcula los flancos y las acciones del frame (hilo principal)
+    static void BeginFrame();
+
+    // Mantenida en este frame
     static bool IsKeyPressed(KeyCode key);
+    // Pulsada / soltada desde el frame anterior
+    static bool WasKeyPressed(KeyCode key);
+    static bool WasKeyReleased(KeyCode key);
 
     static bool IsMouseButtonPressed(MouseCode button);
+    static bool WasMouseButtonPressed(MouseCode button);
+    static bool WasMouseButtonReleased(MouseCode button);
     static glm::vec2 GetMousePosition();
     static float GetMouseX();
     static float GetMouseY();
-};
\ No newline at end of file
+    static glm::vec2 GetMouseDelta();
+    static glm::vec2 GetScroll();
+
+    // Cada acción admite hasta MaxBindings teclas o botones; se activa con cualquiera de ellos
+    static constexpr int MaxBindings = 2;
+    static void BindAction(InputAction action, KeyCode key);
+    static void BindAction(InputAction action, MouseCode button);
+    static void ClearBindings(InputAction action);
+
+    static bool IsActionDown(InputAction action);
+    static bool WasActionPressed(InputAction action);
+    static bool WasActionReleased(InputAction action);
+
+    static const InputState& GetState() { return s_State; }
+    // Eventos descartados por tener la cola llena
+    static uint64_t GetDroppedEvents() { return s_Events.GetDropped(); }
+
+private:
+    struct Binding
+    {
+        enum class Device : uint8_t { None, Key, MouseButton };
+        Device Source = Device::None;
+        int Code = 0;
+    };
+
+    static void BindDefaults();
+    static void AddBinding(InputAction action, Binding binding);
+    static void ApplyEvent(const InputEvent& event);
+    static void UpdateActions();
+
+    static void KeyCallback(GLFWwindow* window, int key, int scancode, int action, int mods);
+    static void MouseButtonCallback(GLFWwindow* window, int button, int action, int mods);
+    static void CursorPositionCallback(GLFWwindow* window, double x, double y);
+    static void ScrollCallback(GLFWwindow* window, double xOffset, double yOffset);
+
+    static InputEventQueue s_Events;
+    static InputState s_State;
+    static Binding s_Bindings[InputState::ActionCount][MaxBindings];
+    // Hay posición anterior del cursor con la que calcular el delta
+    static bool s_HasMousePosition;
+};
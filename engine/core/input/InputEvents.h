@@ -0,0 +1,70 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+// Evento de entrada tal como llega de un callback de GLFW
+struct InputEvent
+{
+    enum class Type : uint8_t
+    {
+        Key,
+        MouseButton,
+        CursorPosition,
+        Scroll
+    };
+
+    Type EventType{};
+    // GLFW_PRESS / GLFW_RELEASE / GLFW_REPEAT (teclas y botones)
+    uint8_t Action{};
+    // Código de tecla o de botón
+    int16_t Code{};
+    // Posición del cursor o desplazamiento del scroll
+    double X{};
+    double Y{};
+};
+
+// Cola de un productor (callbacks de GLFW) y un consumidor (Input::BeginFrame) sin bloqueos: un
+// anillo de tamaño fijo con dos índices atómicos. Si se llena, el evento se descarta y se cuenta.
+class InputEventQueue
+{
+public:
+    // Potencia de dos: el índice se envuelve con una máscara
+    static constexpr size_t Capacity = 1024;
+
+    bool Push(const InputEvent& event)
+    {
+        const size_t tail = m_Tail.load(std::memory_order_relaxed);
+        if (tail - m_Head.load(std::memory_order_acquire) == Capacity)
+        {
+            m_Dropped.fetch_add(1, std::memory_order_relaxed);
+            return false;
+        }
+        m_Events[tail & (Capacity - 1)] = event;
+        m_Tail.store(tail + 1, std::memory_order_release);
+        return true;
+    }
+
+    bool Pop(InputEvent& event)
+    {
+        const size_t head = m_Head.load(std::memory_order_relaxed);
+        if (head == m_Tail.load(std::memory_order_acquire))
+            return false;
+        event = m_Events[head & (Capacity - 1)];
+        m_Head.store(head + 1, std::memory_order_release);
+        return true;
+    }
+
+    uint64_t GetDropped() const { return m_Dropped.load(std::memory_order_relaxed); }
+
+private:
+    static_assert((Capacity & (Capacity - 1)) == 0, "InputEventQueue::Capacity must be a power of two");
+
+    std::array<InputEvent, Capacity> m_Events{};
+    // En líneas de caché distintas para que productor y consumidor no se pisen
+    alignas(64) std::atomic<size_t> m_Head{0};
+    alignas(64) std::atomic<size_t> m_Tail{0};
+    std::atomic<uint64_t> m_Dropped{0};
+};
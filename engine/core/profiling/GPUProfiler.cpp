@@ -0,0 +1,185 @@
+#include "GPUProfiler.h"
+
+#ifdef FERX_PROFILING
+
+bool GPUProfiler::s_Initialized = false;
+GPUProfiler::FrameSlot GPUProfiler::s_Slots[GPUProfiler::FrameLatency];
+uint64_t GPUProfiler::s_FrameIndex = 0;
+GPUFrameTiming GPUProfiler::s_LastFrame;
+uint32_t GPUProfiler::s_ThreadID = 0;
+uint32_t GPUProfiler::s_LatencyThreadID = 0;
+
+GLint64 GPUProfiler::s_CalibrationGPU = 0;
+uint64_t GPUProfiler::s_CalibrationCPU = 0;
+
+void GPUProfiler::Init()
+{
+    s_ThreadID = Profiler::RegisterVirtualThread("GPU");
+    s_LatencyThreadID = Profiler::RegisterVirtualThread("Input Latency");
+    Calibrate();
+    s_Initialized = true;
+}
+
+void GPUProfiler::Shutdown()
+{
+    if (!s_Initialized)
+        return;
+
+    for (FrameSlot& slot : s_Slots)
+    {
+        if (!slot.QueryPool.empty())
+            glDeleteQueries(static_cast<GLsizei>(slot.QueryPool.size()), slot.QueryPool.data());
+        slot = FrameSlot();
+    }
+    s_Initialized = false;
+}
+
+void GPUProfiler::Calibrate()
+{
+    // glGetInteger64v(GL_TIMESTAMP) devuelve la hora actual de la GPU sin esperar a que termine el trabajo
+    glGetInteger64v(GL_TIMESTAMP, &s_CalibrationGPU);
+    s_CalibrationCPU = Profiler::Now();
+}
+
+uint64_t GPUProfiler::GPUToCPUTicks(GLuint64 gpuNanoseconds)
+{
+    const double milliseconds = (static_cast<double>(gpuNanoseconds) - static_cast<double>(s_CalibrationGPU)) / 1e6;
+    const double ticksPerMillisecond = 1.0 / Profiler::TicksToMilliseconds(1);
+    return static_cast<uint64_t>(static_cast<double>(s_CalibrationCPU) + milliseconds * ticksPerMillisecond);
+}
+
+GLuint GPUProfiler::AcquireQuery(FrameSlot& slot)
+{
+    if (slot.QueriesUsed == slot.QueryPool.size())
+    {
+        GLuint query;
+        glGenQueries(1, &query);
+        slot.QueryPool.push_back(query);
+    }
+    return slot.QueryPool[slot.QueriesUsed++];
+}
+
+void GPUProfiler::Resolve(FrameSlot& slot)
+{
+    if (!slot.Pending || slot.Passes.empty())
+        return;
+
+    // La última consulta emitida es la más tardía; si está lista, todas lo están
+    GLint available = 0;
+    glGetQueryObjectiv(slot.PresentQuery ? slot.PresentQuery : slot.Passes.front().EndQuery, GL_QUERY_RESULT_AVAILABLE, &available);
+    if (!available)
+        return;
+
+    GPUFrameTiming timing;
+    timing.Index = slot.Index;
+
+    for (const Pass& pass : slot.Passes)
+    {
+        GLuint64 begin = 0, end = 0;
+        glGetQueryObjectui64v(pass.BeginQuery, GL_QUERY_RESULT, &begin);
+        glGetQueryObjectui64v(pass.EndQuery, GL_QUERY_RESULT, &end);
+
+        const double milliseconds = static_cast<double>(end - begin) / 1e6;
+        if (pass.Depth == 0 && timing.Passes.empty())
+            timing.Milliseconds = milliseconds;
+        timing.Passes.push_back({ pass.Name, pass.Depth, milliseconds });
+
+        Profiler::RecordTo(s_ThreadID, pass.Name, GPUToCPUTicks(begin), GPUToCPUTicks(end), pass.Depth);
+    }
+
+    if (slot.PresentQuery)
+    {
+        GLuint64 present = 0;
+        glGetQueryObjectui64v(slot.PresentQuery, GL_QUERY_RESULT, &present);
+        const uint64_t presentTicks = GPUToCPUTicks(present);
+        if (presentTicks > slot.InputTicks)
+        {
+            timing.InputLatencyMs = Profiler::TicksToMilliseconds(presentTicks - slot.InputTicks);
+            Profiler::RecordTo(s_LatencyThreadID, "Input to Present", slot.InputTicks, presentTicks, 0);
+        }
+    }
+
+    s_LastFrame = std::move(timing);
+    slot.Pending = false;
+}
+
+void GPUProfiler::BeginFrame()
+{
+    if (!s_Initialized)
+        return;
+
+    // Se recalibra de vez en cuando para absorber la deriva entre relojes
+    if (s_FrameIndex % 120 == 0)
+        Calibrate();
+
+    FrameSlot& slot = s_Slots[s_FrameIndex % FrameLatency];
+
+    // Resultados de hace FrameLatency frames; si la GPU va aún más atrasada se descartan
+    Resolve(slot);
+
+    slot.Index = s_FrameIndex;
+    slot.Pending = false;
+    slot.QueriesUsed = 0;
+    slot.Passes.clear();
+    slot.Open.clear();
+    slot.PresentQuery = 0;
+    slot.InputTicks = 0;
+
+    BeginPass("GPU Frame");
+}
+
+void GPUProfiler::EndFrame()
+{
+    if (!s_Initialized)
+        return;
+
+    FrameSlot& slot = s_Slots[s_FrameIndex % FrameLatency];
+    while (!slot.Open.empty())
+        EndPass();
+
+    slot.Pending = true;
+    s_FrameIndex++;
+}
+
+void GPUProfiler::BeginPass(const char* name)
+{
+    if (!s_Initialized)
+        return;
+
+    FrameSlot& slot = s_Slots[s_FrameIndex % FrameLatency];
+    Pass pass{ name, static_cast<uint32_t>(slot.Open.size()), AcquireQuery(slot), 0 };
+    glQueryCounter(pass.BeginQuery, GL_TIMESTAMP);
+
+    slot.Open.push_back(slot.Passes.size());
+    slot.Passes.push_back(pass);
+}
+
+void GPUProfiler::EndPass()
+{
+    if (!s_Initialized)
+        return;
+
+    FrameSlot& slot = s_Slots[s_FrameIndex % FrameLatency];
+    if (slot.Open.empty())
+        return;
+
+    Pass& pass = slot.Passes[slot.Open.back()];
+    slot.Open.pop_back();
+
+    pass.EndQuery = AcquireQuery(slot);
+    glQueryCounter(pass.EndQuery, GL_TIMESTAMP);
+}
+
+void GPUProfiler::MarkPresent(uint64_t inputTicks)
+{
+    if (!s_Initialized || s_FrameIndex == 0 || inputTicks == 0)
+        return;
+
+    // El frame ya está cerrado (EndFrame va antes del swap): la consulta va a su hueco
+    FrameSlot& slot = s_Slots[(s_FrameIndex - 1) % FrameLatency];
+    slot.PresentQuery = AcquireQuery(slot);
+    slot.InputTicks = inputTicks;
+    glQueryCounter(slot.PresentQuery, GL_TIMESTAMP);
+}
+
+#endif
@@ -0,0 +1,121 @@
+#pragma once
+
+// Tiempos de GPU por pase con consultas GL_TIMESTAMP (glQueryCounter).
+// Cada frame usa su propio juego de consultas de un anillo de FrameLatency frames; los resultados
+// se leen cuando vuelve a tocar ese hueco, así que nunca se espera a la GPU. Los pases resueltos
+// se envían al Profiler como eventos del hilo virtual "GPU", alineados con el reloj de CPU, para
+// que aparezcan junto a los tiempos de CPU en el panel y en la exportación a Chrome trace.
+// Una consulta más tras el swap (MarkPresent) da la latencia de entrada a pantalla: desde que el
+// hilo principal leyó la entrada del frame hasta que la GPU terminó de presentarlo. No incluye la
+// espera al barrido del monitor, así que es una cota inferior de lo que ve el usuario.
+
+#include "Profiler.h"
+
+#ifdef FERX_PROFILING
+
+#include <glad/glad.h>
+#include <cstdint>
+#include <vector>
+
+struct GPUPassTiming
+{
+    const char* Name{};
+    uint32_t Depth{};
+    double Milliseconds{};
+};
+
+struct GPUFrameTiming
+{
+    uint64_t Index{};
+    double Milliseconds{};
+    // Negativo si el frame no marcó la entrada (MarkPresent)
+    double InputLatencyMs = -1.0;
+    std::vector<GPUPassTiming> Passes;
+};
+
+class GPUProfiler
+{
+public:
+    static constexpr unsigned int FrameLatency = 4;
+
+    // Requiere un contexto de OpenGL activo
+    static void Init();
+    static void Shutdown();
+
+    static void BeginFrame();
+    static void EndFrame();
+
+    static void BeginPass(const char* name);
+    static void EndPass();
+
+    // Tras el swap del frame recién cerrado; 'inputTicks' es Profiler::Now() al leer su entrada
+    static void MarkPresent(uint64_t inputTicks);
+
+    static const GPUFrameTiming& GetLastFrame() { return s_LastFrame; }
+    // Índice que tendrá el próximo frame (el último cerrado es este menos uno)
+    static uint64_t GetFrameIndex() { return s_FrameIndex; }
+    static bool IsAvailable() { return s_Initialized; }
+
+private:
+    struct Pass
+    {
+        const char* Name;
+        uint32_t Depth;
+        GLuint BeginQuery;
+        GLuint EndQuery;
+    };
+
+    struct FrameSlot
+    {
+        uint64_t Index{};
+        bool Pending{};
+        std::vector<GLuint> QueryPool;
+        size_t QueriesUsed{};
+        std::vector<Pass> Passes;
+        // Pases abiertos en este frame (índices en 'Passes')
+        std::vector<size_t> Open;
+        // Consulta tras el swap (0 si no se marcó) y momento en que se leyó la entrada
+        GLuint PresentQuery{};
+        uint64_t InputTicks{};
+    };
+
+    static GLuint AcquireQuery(FrameSlot& slot);
+    static void Resolve(FrameSlot& slot);
+    static void Calibrate();
+    static uint64_t GPUToCPUTicks(GLuint64 gpuNanoseconds);
+
+    static bool s_Initialized;
+    static FrameSlot s_Slots[FrameLatency];
+    static uint64_t s_FrameIndex;
+    static GPUFrameTiming s_LastFrame;
+    static uint32_t s_ThreadID;
+    static uint32_t s_LatencyThreadID;
+
+    // Par de referencia (reloj de GPU, ticks de CPU) tomado a la vez
+    static GLint64 s_CalibrationGPU;
+    static uint64_t s_CalibrationCPU;
+};
+
+class GPUProfileScope
+{
+public:
+    explicit GPUProfileScope(const char* name) { GPUProfiler::BeginPass(name); }
+    ~GPUProfileScope() { GPUProfiler::EndPass(); }
+
+    GPUProfileScope(const GPUProfileScope&) = delete;
+    GPUProfileScope& operator=(const GPUProfileScope&) = delete;
+};
+
+#define PROFILE_GPU_SCOPE(name) GPUProfileScope FERX_PROFILE_CONCAT(gpuProfileScope, __LINE__)(name)
+#define PROFILE_GPU_FRAME_BEGIN() GPUProfiler::BeginFrame()
+#define PROFILE_GPU_FRAME_END() GPUProfiler::EndFrame()
+#define PROFILE_GPU_PRESENT(inputTicks) GPUProfiler::MarkPresent(inputTicks)
+
+#else
+
+#define PROFILE_GPU_SCOPE(name)
+#define PROFILE_GPU_FRAME_BEGIN()
+#define PROFILE_GPU_FRAME_END()
+#define PROFILE_GPU_PRESENT(inputTicks)
+
+#endif
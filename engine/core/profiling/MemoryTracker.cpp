@@ -0,0 +1,193 @@
+#include "MemoryTracker.h"
+
+#ifdef FERX_PROFILING
+
+#include <algorithm>
+#include <cstdlib>
+#include <new>
+
+thread_local MemoryTag MemoryTracker::t_Tag = MemoryTag::Untagged;
+
+MemoryTracker::TagCounters MemoryTracker::s_Tags[MemoryTracker::TagCount];
+MemoryTracker::GPUCounters MemoryTracker::s_GPU[MemoryTracker::GPUKindCount];
+std::array<float, MemoryTracker::HistorySize> MemoryTracker::s_AllocationHistory{};
+
+void MemoryTracker::UpdatePeak(std::atomic<int64_t>& peak, int64_t value)
+{
+    int64_t previous = peak.load(std::memory_order_relaxed);
+    while (value > previous && !peak.compare_exchange_weak(previous, value, std::memory_order_relaxed)) {}
+}
+
+void MemoryTracker::OnAllocate(MemoryTag tag, size_t bytes)
+{
+    TagCounters& counters = s_Tags[static_cast<size_t>(tag)];
+    const int64_t current = counters.CurrentBytes.fetch_add(static_cast<int64_t>(bytes), std::memory_order_relaxed) + static_cast<int64_t>(bytes);
+    UpdatePeak(counters.PeakBytes, current);
+    counters.Allocations.fetch_add(1, std::memory_order_relaxed);
+    counters.AllocatedBytes.fetch_add(bytes, std::memory_order_relaxed);
+}
+
+void MemoryTracker::OnFree(MemoryTag tag, size_t bytes)
+{
+    TagCounters& counters = s_Tags[static_cast<size_t>(tag)];
+    counters.CurrentBytes.fetch_sub(static_cast<int64_t>(bytes), std::memory_order_relaxed);
+    counters.Frees.fetch_add(1, std::memory_order_relaxed);
+}
+
+void MemoryTracker::TrackGPU(GPUMemoryKind kind, int64_t deltaBytes)
+{
+    GPUCounters& counters = s_GPU[static_cast<size_t>(kind)];
+    const int64_t current = counters.CurrentBytes.fetch_add(deltaBytes, std::memory_order_relaxed) + deltaBytes;
+    UpdatePeak(counters.PeakBytes, current);
+}
+
+void MemoryTracker::EndFrame()
+{
+    uint64_t frameAllocations = 0;
+    for (TagCounters& counters : s_Tags)
+    {
+        const uint64_t allocations = counters.Allocations.load(std::memory_order_relaxed);
+        const uint64_t bytes = counters.AllocatedBytes.load(std::memory_order_relaxed);
+        counters.FrameAllocations = allocations - counters.LastAllocations;
+        counters.FrameBytes = bytes - counters.LastAllocatedBytes;
+        counters.LastAllocations = allocations;
+        counters.LastAllocatedBytes = bytes;
+        frameAllocations += counters.FrameAllocations;
+    }
+
+    std::rotate(s_AllocationHistory.begin(), s_AllocationHistory.begin() + 1, s_AllocationHistory.end());
+    s_AllocationHistory.back() = static_cast<float>(frameAllocations);
+}
+
+MemoryTagStats MemoryTracker::GetTagStats(MemoryTag tag)
+{
+    const TagCounters& counters = s_Tags[static_cast<size_t>(tag)];
+    MemoryTagStats stats;
+    stats.Name = GetTagName(tag);
+    stats.CurrentBytes = counters.CurrentBytes.load(std::memory_order_relaxed);
+    stats.PeakBytes = counters.PeakBytes.load(std::memory_order_relaxed);
+    stats.TotalAllocations = counters.Allocations.load(std::memory_order_relaxed);
+    stats.LiveAllocations = stats.TotalAllocations - counters.Frees.load(std::memory_order_relaxed);
+    stats.FrameAllocations = counters.FrameAllocations;
+    stats.FrameBytes = counters.FrameBytes;
+    return stats;
+}
+
+GPUMemoryStats MemoryTracker::GetGPUStats(GPUMemoryKind kind)
+{
+    const GPUCounters& counters = s_GPU[static_cast<size_t>(kind)];
+    return { GetGPUKindName(kind), counters.CurrentBytes.load(std::memory_order_relaxed), counters.PeakBytes.load(std::memory_order_relaxed) };
+}
+
+const char* MemoryTracker::GetTagName(MemoryTag tag)
+{
+    static const char* names[TagCount] = { "Untagged", "Core", "Rendering", "Mesh", "Texture", "Scene", "Editor", "Profiling", "Frame" };
+    return names[static_cast<size_t>(tag)];
+}
+
+const char* MemoryTracker::GetGPUKindName(GPUMemoryKind kind)
+{
+    static const char* names[GPUKindCount] = { "Buffers", "Textures", "Render Targets" };
+    return names[static_cast<size_t>(kind)];
+}
+
+// --- Operadores globales ---
+// Cada bloque lleva delante una cabecera de 16 bytes con su tamaño, la etiqueta y la distancia
+// hasta el inicio real de la reserva (mayor que 16 solo con alineaciones extendidas).
+namespace
+{
+    struct AllocationHeader
+    {
+        size_t Size;
+        uint32_t Offset;
+        MemoryTag Tag;
+    };
+    static_assert(sizeof(AllocationHeader) <= 16, "La cabecera debe caber en 16 bytes");
+
+    constexpr size_t HeaderSize = 16;
+
+    void* TryAllocate(size_t size, size_t alignment)
+    {
+        alignment = std::max(alignment, HeaderSize);
+        // Si malloc ya alinea a 16, con la alineación por defecto no hace falta relleno
+        const size_t padding = alignof(std::max_align_t) >= HeaderSize ? alignment - HeaderSize : alignment - 1;
+        auto* raw = static_cast<unsigned char*>(std::malloc(size + HeaderSize + padding));
+        if (!raw)
+            return nullptr;
+
+        const auto address = reinterpret_cast<uintptr_t>(raw) + HeaderSize;
+        const uintptr_t aligned = (address + alignment - 1) & ~(static_cast<uintptr_t>(alignment) - 1);
+        auto* user = reinterpret_cast<unsigned char*>(aligned);
+
+        const MemoryTag tag = MemoryTracker::GetThreadTag();
+        new (user - HeaderSize) AllocationHeader{ size, static_cast<uint32_t>(user - raw), tag };
+        MemoryTracker::OnAllocate(tag, size);
+        return user;
+    }
+
+    void* Allocate(size_t size, size_t alignment)
+    {
+        if (size == 0)
+            size = 1;
+
+        while (true)
+        {
+            if (void* pointer = TryAllocate(size, alignment))
+                return pointer;
+
+            std::new_handler handler = std::get_new_handler();
+            if (!handler)
+                throw std::bad_alloc();
+            handler();
+        }
+    }
+
+    void* AllocateNoThrow(size_t size, size_t alignment) noexcept
+    {
+        try
+        {
+            return Allocate(size, alignment);
+        }
+        catch (...)
+        {
+            return nullptr;
+        }
+    }
+
+    void Free(void* pointer) noexcept
+    {
+        if (!pointer)
+            return;
+
+        auto* user = static_cast<unsigned char*>(pointer);
+        const auto* header = reinterpret_cast<const AllocationHeader*>(user - HeaderSize);
+        MemoryTracker::OnFree(header->Tag, header->Size);
+        std::free(user - header->Offset);
+    }
+
+    constexpr size_t DefaultAlignment = __STDCPP_DEFAULT_NEW_ALIGNMENT__;
+}
+
+void* operator new(size_t size) { return Allocate(size, DefaultAlignment); }
+void* operator new[](size_t size) { return Allocate(size, DefaultAlignment); }
+void* operator new(size_t size, const std::nothrow_t&) noexcept { return AllocateNoThrow(size, DefaultAlignment); }
+void* operator new[](size_t size, const std::nothrow_t&) noexcept { return AllocateNoThrow(size, DefaultAlignment); }
+void* operator new(size_t size, std::align_val_t alignment) { return Allocate(size, static_cast<size_t>(alignment)); }
+void* operator new[](size_t size, std::align_val_t alignment) { return Allocate(size, static_cast<size_t>(alignment)); }
+void* operator new(size_t size, std::align_val_t alignment, const std::nothrow_t&) noexcept { return AllocateNoThrow(size, static_cast<size_t>(alignment)); }
+void* operator new[](size_t size, std::align_val_t alignment, const std::nothrow_t&) noexcept { return AllocateNoThrow(size, static_cast<size_t>(alignment)); }
+
+void operator delete(void* pointer) noexcept { Free(pointer); }
+void operator delete[](void* pointer) noexcept { Free(pointer); }
+void operator delete(void* pointer, size_t) noexcept { Free(pointer); }
+void operator delete[](void* pointer, size_t) noexcept { Free(pointer); }
+void operator delete(void* pointer, const std::nothrow_t&) noexcept { Free(pointer); }
+void operator delete[](void* pointer, const std::nothrow_t&) noexcept { Free(pointer); }
+void operator delete(void* pointer, std::align_val_t) noexcept { Free(pointer); }
+void operator delete[](void* pointer, std::align_val_t) noexcept { Free(pointer); }
+void operator delete(void* pointer, size_t, std::align_val_t) noexcept { Free(pointer); }
+void operator delete[](void* pointer, size_t, std::align_val_t) noexcept { Free(pointer); }
+void operator delete(void* pointer, std::align_val_t, const std::nothrow_t&) noexcept { Free(pointer); }
+void operator delete[](void* pointer, std::align_val_t, const std::nothrow_t&) noexcept { Free(pointer); }
+
+#endif
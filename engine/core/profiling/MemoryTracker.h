@@ -0,0 +1,142 @@
+#pragma once
+
+// Seguimiento de memoria por subsistema.
+// Los operadores globales new/delete guardan delante de cada bloque su tamaño y la etiqueta activa
+// en el hilo (MEMORY_TAG), así que una liberación se descuenta del subsistema que reservó aunque
+// ocurra en otro. La memoria de GPU la declaran los envoltorios de búferes, texturas y FBOs con
+// TRACK_GPU_MEMORY. Como el Profiler, desaparece por completo con FERX_SHIPPING.
+
+#include "Profiler.h"
+
+#ifdef FERX_PROFILING
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+enum class MemoryTag : uint8_t
+{
+    Untagged,
+    Core,
+    Rendering,
+    Mesh,
+    Texture,
+    Scene,
+    Editor,
+    Profiling,
+    // Bloques de FrameAllocator; lo que se reserva dentro de ellos ya no pasa por aquí
+    Frame,
+    Count
+};
+
+enum class GPUMemoryKind : uint8_t
+{
+    Buffer,
+    Texture,
+    RenderTarget,
+    Count
+};
+
+struct MemoryTagStats
+{
+    const char* Name{};
+    int64_t CurrentBytes{};
+    int64_t PeakBytes{};
+    uint64_t LiveAllocations{};
+    uint64_t TotalAllocations{};
+    // Del último frame cerrado con MemoryTracker::EndFrame
+    uint64_t FrameAllocations{};
+    uint64_t FrameBytes{};
+};
+
+struct GPUMemoryStats
+{
+    const char* Name{};
+    int64_t CurrentBytes{};
+    int64_t PeakBytes{};
+};
+
+class MemoryTracker
+{
+public:
+    static constexpr size_t TagCount = static_cast<size_t>(MemoryTag::Count);
+    static constexpr size_t GPUKindCount = static_cast<size_t>(GPUMemoryKind::Count);
+    static constexpr size_t HistorySize = 240;
+
+    // Los llaman los operadores globales; solo usan atómicos, nunca reservan memoria
+    static void OnAllocate(MemoryTag tag, size_t bytes);
+    static void OnFree(MemoryTag tag, size_t bytes);
+
+    static void TrackGPU(GPUMemoryKind kind, int64_t deltaBytes);
+
+    static MemoryTag GetThreadTag() { return t_Tag; }
+    static void SetThreadTag(MemoryTag tag) { t_Tag = tag; }
+
+    // Cierra el frame: calcula reservas y bytes por frame y los añade al historial
+    static void EndFrame();
+
+    static MemoryTagStats GetTagStats(MemoryTag tag);
+    static GPUMemoryStats GetGPUStats(GPUMemoryKind kind);
+
+    // Reservas totales por frame, de la más antigua a la más reciente
+    static const std::array<float, HistorySize>& GetAllocationHistory() { return s_AllocationHistory; }
+
+    static const char* GetTagName(MemoryTag tag);
+    static const char* GetGPUKindName(GPUMemoryKind kind);
+
+private:
+    struct TagCounters
+    {
+        std::atomic<int64_t> CurrentBytes{0};
+        std::atomic<int64_t> PeakBytes{0};
+        std::atomic<uint64_t> Allocations{0};
+        std::atomic<uint64_t> Frees{0};
+        std::atomic<uint64_t> AllocatedBytes{0};
+
+        // Acumulados al cerrar el frame anterior, para sacar la tasa por frame
+        uint64_t LastAllocations{};
+        uint64_t LastAllocatedBytes{};
+        uint64_t FrameAllocations{};
+        uint64_t FrameBytes{};
+    };
+
+    struct GPUCounters
+    {
+        std::atomic<int64_t> CurrentBytes{0};
+        std::atomic<int64_t> PeakBytes{0};
+    };
+
+    static void UpdatePeak(std::atomic<int64_t>& peak, int64_t value);
+
+    static thread_local MemoryTag t_Tag;
+
+    static TagCounters s_Tags[TagCount];
+    static GPUCounters s_GPU[GPUKindCount];
+    static std::array<float, HistorySize> s_AllocationHistory;
+};
+
+class MemoryTagScope
+{
+public:
+    explicit MemoryTagScope(MemoryTag tag) : m_Previous(MemoryTracker::GetThreadTag()) { MemoryTracker::SetThreadTag(tag); }
+    ~MemoryTagScope() { MemoryTracker::SetThreadTag(m_Previous); }
+
+    MemoryTagScope(const MemoryTagScope&) = delete;
+    MemoryTagScope& operator=(const MemoryTagScope&) = delete;
+
+private:
+    MemoryTag m_Previous;
+};
+
+#define MEMORY_TAG(tag) MemoryTagScope FERX_PROFILE_CONCAT(memoryTagScope, __LINE__)(MemoryTag::tag)
+#define TRACK_GPU_MEMORY(kind, deltaBytes) MemoryTracker::TrackGPU(GPUMemoryKind::kind, static_cast<int64_t>(deltaBytes))
+#define MEMORY_FRAME_END() MemoryTracker::EndFrame()
+
+#else
+
+#define MEMORY_TAG(tag)
+#define TRACK_GPU_MEMORY(kind, deltaBytes)
+#define MEMORY_FRAME_END()
+
+#endif
@@ -0,0 +1,345 @@
+#include "Profiler.h"
+#include "MemoryTracker.h"
+#include "Log.h"
+
+#ifdef FERX_PROFILING
+
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+#include <fstream>
+
+#if defined(__x86_64__) || defined(_M_X64)
+#ifdef _MSC_VER
+#include <intrin.h>
+#else
+#include <x86intrin.h>
+#endif
+#define FERX_PROFILE_RDTSC 1
+#endif
+
+thread_local uint32_t Profiler::t_Depth = 0;
+thread_local Profiler::ThreadBuffer* Profiler::t_Buffer = nullptr;
+
+std::mutex Profiler::s_ThreadsMutex;
+std::vector<std::unique_ptr<Profiler::ThreadBuffer>> Profiler::s_Threads;
+
+std::atomic<uint64_t> Profiler::s_DroppedEvents{0};
+
+uint64_t Profiler::s_FrameStart = 0;
+uint64_t Profiler::s_FrameIndex = 0;
+ProfileFrame Profiler::s_LastFrame;
+
+bool Profiler::s_Capturing = false;
+std::vector<ProfileFrame> Profiler::s_CapturedFrames;
+
+uint64_t Profiler::s_CalibrationTicks = 0;
+int64_t Profiler::s_CalibrationNanoseconds = 0;
+double Profiler::s_MillisecondsPerTick = 1e-6;
+
+namespace
+{
+    int64_t SteadyNanoseconds()
+    {
+        return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+    }
+}
+
+uint64_t Profiler::Now()
+{
+#ifdef FERX_PROFILE_RDTSC
+    return __rdtsc();
+#else
+    return static_cast<uint64_t>(SteadyNanoseconds());
+#endif
+}
+
+double Profiler::TicksToMilliseconds(uint64_t ticks)
+{
+    return static_cast<double>(ticks) * s_MillisecondsPerTick;
+}
+
+void Profiler::Init()
+{
+    SetThreadName("Main");
+
+    s_CalibrationTicks = Now();
+    s_CalibrationNanoseconds = SteadyNanoseconds();
+
+#ifdef FERX_PROFILE_RDTSC
+    // Estimación inicial de la frecuencia del TSC; EndFrame la refina con intervalos cada vez más largos
+    while (SteadyNanoseconds() - s_CalibrationNanoseconds < 2000000) {}
+    s_MillisecondsPerTick = static_cast<double>(SteadyNanoseconds() - s_CalibrationNanoseconds) / 1e6 /
+                            static_cast<double>(Now() - s_CalibrationTicks);
+#endif
+}
+
+void Profiler::Shutdown()
+{
+    // Los búferes de los hilos se conservan: algún hilo podría seguir grabando hasta terminar
+    s_Capturing = false;
+    s_CapturedFrames.clear();
+    s_LastFrame = ProfileFrame();
+}
+
+void Profiler::SetThreadName(const std::string& name)
+{
+    ThreadBuffer& buffer = GetThreadBuffer();
+    std::lock_guard<std::mutex> lock(s_ThreadsMutex);
+    buffer.Name = name;
+}
+
+Profiler::ThreadBuffer& Profiler::GetThreadBuffer()
+{
+    if (!t_Buffer)
+    {
+        MEMORY_TAG(Profiling);
+        std::lock_guard<std::mutex> lock(s_ThreadsMutex);
+        s_Threads.push_back(std::make_unique<ThreadBuffer>());
+        t_Buffer = s_Threads.back().get();
+        t_Buffer->ID = static_cast<uint32_t>(s_Threads.size() - 1);
+        t_Buffer->Name = "Thread " + std::to_string(t_Buffer->ID);
+    }
+    return *t_Buffer;
+}
+
+std::vector<ProfileThreadInfo> Profiler::GetThreads()
+{
+    std::lock_guard<std::mutex> lock(s_ThreadsMutex);
+    std::vector<ProfileThreadInfo> threads;
+    for (const auto& buffer : s_Threads)
+        threads.push_back({ buffer->ID, buffer->Name });
+    return threads;
+}
+
+uint32_t Profiler::RegisterVirtualThread(const std::string& name)
+{
+    std::lock_guard<std::mutex> lock(s_ThreadsMutex);
+    s_Threads.push_back(std::make_unique<ThreadBuffer>());
+    s_Threads.back()->ID = static_cast<uint32_t>(s_Threads.size() - 1);
+    s_Threads.back()->Name = name;
+    return s_Threads.back()->ID;
+}
+
+void Profiler::Record(const char* name, uint64_t start, uint64_t end, uint32_t depth)
+{
+    Push(GetThreadBuffer(), name, start, end, depth);
+}
+
+void Profiler::RecordTo(uint32_t threadID, const char* name, uint64_t start, uint64_t end, uint32_t depth)
+{
+    ThreadBuffer* buffer;
+    {
+        std::lock_guard<std::mutex> lock(s_ThreadsMutex);
+        if (threadID >= s_Threads.size())
+            return;
+        buffer = s_Threads[threadID].get();
+    }
+    Push(*buffer, name, start, end, depth);
+}
+
+void Profiler::Push(ThreadBuffer& buffer, const char* name, uint64_t start, uint64_t end, uint32_t depth)
+{
+    const size_t head = buffer.Head.load(std::memory_order_relaxed);
+    const size_t tail = buffer.Tail.load(std::memory_order_acquire);
+    if (head - tail >= EventsPerThread)
+    {
+        s_DroppedEvents.fetch_add(1, std::memory_order_relaxed);
+        return;
+    }
+
+    buffer.Events[head % EventsPerThread] = { name, start, end, depth, buffer.ID };
+    buffer.Head.store(head + 1, std::memory_order_release);
+}
+
+void Profiler::BeginFrame()
+{
+    s_FrameStart = Now();
+}
+
+void Profiler::EndFrame()
+{
+    const uint64_t frameEnd = Now();
+    MEMORY_TAG(Profiling);
+
+#ifdef FERX_PROFILE_RDTSC
+    const int64_t elapsedNanoseconds = SteadyNanoseconds() - s_CalibrationNanoseconds;
+    if (elapsedNanoseconds > 0 && frameEnd > s_CalibrationTicks)
+        s_MillisecondsPerTick = static_cast<double>(elapsedNanoseconds) / 1e6 / static_cast<double>(frameEnd - s_CalibrationTicks);
+#endif
+
+    ProfileFrame frame;
+    frame.Index = s_FrameIndex++;
+    frame.DurationMs = TicksToMilliseconds(frameEnd - s_FrameStart);
+    frame.Events.push_back({ "Frame", s_FrameStart, frameEnd, 0, 0 });
+
+    {
+        std::lock_guard<std::mutex> lock(s_ThreadsMutex);
+        for (const auto& buffer : s_Threads)
+        {
+            const size_t head = buffer->Head.load(std::memory_order_acquire);
+            size_t tail = buffer->Tail.load(std::memory_order_relaxed);
+            for (; tail != head; tail++)
+                frame.Events.push_back(buffer->Events[tail % EventsPerThread]);
+            buffer->Tail.store(tail, std::memory_order_release);
+        }
+    }
+
+    BuildTree(frame);
+
+    if (s_Capturing)
+    {
+        s_CapturedFrames.push_back(frame);
+        if (s_CapturedFrames.size() >= MaxCapturedFrames)
+            s_Capturing = false;
+    }
+
+    s_LastFrame = std::move(frame);
+}
+
+void Profiler::BuildTree(ProfileFrame& frame)
+{
+    struct TreeNode
+    {
+        const char* Name;
+        uint32_t ThreadID;
+        uint32_t Calls;
+        uint64_t Ticks;
+        std::vector<size_t> Children;
+    };
+
+    // El primer evento es el frame completo; el resto se ordena por hilo y por inicio
+    std::vector<const ProfileEvent*> events;
+    for (size_t i = 1; i < frame.Events.size(); i++)
+        events.push_back(&frame.Events[i]);
+    std::sort(events.begin(), events.end(), [](const ProfileEvent* a, const ProfileEvent* b)
+    {
+        if (a->ThreadID != b->ThreadID)
+            return a->ThreadID < b->ThreadID;
+        if (a->Start != b->Start)
+            return a->Start < b->Start;
+        return a->Depth < b->Depth;
+    });
+
+    std::vector<TreeNode> nodes;
+    std::vector<size_t> roots;
+    std::vector<size_t> stack;
+    uint32_t currentThread = ~0u;
+
+    for (const ProfileEvent* event : events)
+    {
+        // Cada hilo tiene una raíz virtual que no se muestra
+        if (event->ThreadID != currentThread)
+        {
+            currentThread = event->ThreadID;
+            nodes.push_back({ nullptr, currentThread, 0, 0, {} });
+            roots.push_back(nodes.size() - 1);
+            stack.assign(1, nodes.size() - 1);
+        }
+
+        // Si el padre empezó en un frame anterior y aún no ha terminado, se cuelga del más profundo disponible
+        stack.resize(std::min<size_t>(stack.size(), event->Depth + 1));
+        const size_t parent = stack.back();
+
+        size_t child = nodes.size();
+        for (size_t candidate : nodes[parent].Children)
+        {
+            if (std::strcmp(nodes[candidate].Name, event->Name) == 0)
+            {
+                child = candidate;
+                break;
+            }
+        }
+        if (child == nodes.size())
+        {
+            nodes.push_back({ event->Name, event->ThreadID, 0, 0, {} });
+            nodes[parent].Children.push_back(child);
+        }
+
+        nodes[child].Calls++;
+        nodes[child].Ticks += event->End - event->Start;
+        stack.push_back(child);
+    }
+
+    frame.Nodes.clear();
+    auto flatten = [&](auto&& self, size_t index, uint32_t depth) -> void
+    {
+        for (size_t child : nodes[index].Children)
+        {
+            const TreeNode& node = nodes[child];
+            frame.Nodes.push_back({ node.Name, depth, node.ThreadID, node.Calls, TicksToMilliseconds(node.Ticks) });
+            self(self, child, depth + 1);
+        }
+    };
+    for (size_t root : roots)
+        flatten(flatten, root, 0);
+}
+
+void Profiler::BeginCapture()
+{
+    s_CapturedFrames.clear();
+    s_Capturing = true;
+}
+
+void Profiler::EndCapture()
+{
+    s_Capturing = false;
+}
+
+bool Profiler::ExportChromeTrace(const std::string& path)
+{
+    std::ofstream file(path);
+    if (!file.is_open())
+    {
+        LOG_ERROR("Profiler", "Failed to write trace: {}", path);
+        return false;
+    }
+
+    uint64_t origin = ~0ull;
+    for (const ProfileFrame& frame : s_CapturedFrames)
+        for (const ProfileEvent& event : frame.Events)
+            origin = std::min(origin, event.Start);
+
+    auto writeString = [&file](const std::string& text)
+    {
+        file << '"';
+        for (char c : text)
+        {
+            if (c == '"' || c == '\\')
+                file << '\\';
+            file << c;
+        }
+        file << '"';
+    };
+
+    file << "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[";
+    bool first = true;
+
+    for (const ProfileThreadInfo& thread : GetThreads())
+    {
+        file << (first ? "" : ",") << "\n{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":0,\"tid\":" << thread.ID << ",\"args\":{\"name\":";
+        writeString(thread.Name);
+        file << "}}";
+        first = false;
+    }
+
+    file.precision(3);
+    file << std::fixed;
+    for (const ProfileFrame& frame : s_CapturedFrames)
+    {
+        for (const ProfileEvent& event : frame.Events)
+        {
+            file << (first ? "" : ",") << "\n{\"name\":";
+            writeString(event.Name);
+            file << ",\"ph\":\"X\",\"pid\":0,\"tid\":" << event.ThreadID
+                 << ",\"ts\":" << TicksToMicroseconds(event.Start - origin)
+                 << ",\"dur\":" << TicksToMicroseconds(event.End - event.Start) << "}";
+            first = false;
+        }
+    }
+
+    file << "\n]}\n";
+    return true;
+}
+
+#endif
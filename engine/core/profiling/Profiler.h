@@ -0,0 +1,171 @@
+#pragma once
+
+// Profiler de CPU por ámbitos. Cada hilo escribe eventos completos (inicio y fin) en su propio
+// búfer circular sin locks; al cerrar el frame, el hilo principal los vacía y construye el árbol
+// jerárquico que muestra el editor. Opcionalmente se acumulan para exportarlos a Chrome trace
+// (chrome://tracing, Perfetto).
+//
+// Con la opción de CMake FERX_SHIPPING se define FERX_SHIPPING y todo desaparece:
+// las macros quedan vacías y la clase Profiler no se compila.
+
+#ifndef FERX_SHIPPING
+#define FERX_PROFILING 1
+#endif
+
+#ifdef FERX_PROFILING
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+// Evento cerrado; 'Name' debe tener duración estática (literal o __func__)
+struct ProfileEvent
+{
+    const char* Name{};
+    uint64_t Start{};
+    uint64_t End{};
+    uint32_t Depth{};
+    uint32_t ThreadID{};
+};
+
+// Nodo del árbol agregado de un frame, en preorden. Las llamadas repetidas con el mismo
+// nombre bajo el mismo padre se suman en un único nodo.
+struct ProfileNode
+{
+    const char* Name{};
+    uint32_t Depth{};
+    uint32_t ThreadID{};
+    uint32_t Calls{};
+    double TotalMs{};
+};
+
+struct ProfileThreadInfo
+{
+    uint32_t ID{};
+    std::string Name;
+};
+
+struct ProfileFrame
+{
+    uint64_t Index{};
+    double DurationMs{};
+    std::vector<ProfileNode> Nodes;
+    std::vector<ProfileEvent> Events;
+};
+
+class Profiler
+{
+public:
+    static constexpr size_t EventsPerThread = 16384;
+    static constexpr size_t MaxCapturedFrames = 600;
+
+    static void Init();
+    static void Shutdown();
+
+    static void BeginFrame();
+    // Vacía los búferes de todos los hilos y construye el árbol del frame que termina
+    static void EndFrame();
+
+    static void SetThreadName(const std::string& name);
+
+    // Marca de tiempo en ticks (rdtsc en x86-64, steady_clock en el resto)
+    static uint64_t Now();
+    static double TicksToMilliseconds(uint64_t ticks);
+    static double TicksToMicroseconds(uint64_t ticks) { return TicksToMilliseconds(ticks) * 1000.0; }
+
+    static void Record(const char* name, uint64_t start, uint64_t end, uint32_t depth);
+
+    // Hilo virtual para líneas de tiempo que no son de CPU (p. ej. la GPU). Solo debe grabar en él
+    // un único hilo, que es quien pasa su ID a RecordTo.
+    static uint32_t RegisterVirtualThread(const std::string& name);
+    static void RecordTo(uint32_t threadID, const char* name, uint64_t start, uint64_t end, uint32_t depth);
+
+    static const ProfileFrame& GetLastFrame() { return s_LastFrame; }
+    static std::vector<ProfileThreadInfo> GetThreads();
+    static uint64_t GetDroppedEvents() { return s_DroppedEvents.load(std::memory_order_relaxed); }
+
+    // Captura de varios frames para exportar a Chrome trace
+    static void BeginCapture();
+    static void EndCapture();
+    static bool IsCapturing() { return s_Capturing; }
+    static size_t GetCapturedFrameCount() { return s_CapturedFrames.size(); }
+    static bool ExportChromeTrace(const std::string& path);
+
+    static thread_local uint32_t t_Depth;
+
+private:
+    // Búfer circular de un solo productor (el hilo dueño) y un solo consumidor (EndFrame)
+    struct ThreadBuffer
+    {
+        uint32_t ID{};
+        std::string Name;
+        std::unique_ptr<ProfileEvent[]> Events{ new ProfileEvent[EventsPerThread] };
+        std::atomic<size_t> Head{0};
+        std::atomic<size_t> Tail{0};
+    };
+
+    static ThreadBuffer& GetThreadBuffer();
+    static void Push(ThreadBuffer& buffer, const char* name, uint64_t start, uint64_t end, uint32_t depth);
+    static void BuildTree(ProfileFrame& frame);
+
+    static thread_local ThreadBuffer* t_Buffer;
+
+    // Solo se bloquea al registrar un hilo nuevo o al recorrer la lista, nunca al grabar eventos
+    static std::mutex s_ThreadsMutex;
+    static std::vector<std::unique_ptr<ThreadBuffer>> s_Threads;
+
+    static std::atomic<uint64_t> s_DroppedEvents;
+
+    static uint64_t s_FrameStart;
+    static uint64_t s_FrameIndex;
+    static ProfileFrame s_LastFrame;
+
+    static bool s_Capturing;
+    static std::vector<ProfileFrame> s_CapturedFrames;
+
+    // Calibración de ticks frente a steady_clock
+    static uint64_t s_CalibrationTicks;
+    static int64_t s_CalibrationNanoseconds;
+    static double s_MillisecondsPerTick;
+};
+
+class ProfileScope
+{
+public:
+    explicit ProfileScope(const char* name) : m_Name(name), m_Depth(Profiler::t_Depth++), m_Start(Profiler::Now()) {}
+    ~ProfileScope()
+    {
+        Profiler::Record(m_Name, m_Start, Profiler::Now(), m_Depth);
+        Profiler::t_Depth--;
+    }
+
+    ProfileScope(const ProfileScope&) = delete;
+    ProfileScope& operator=(const ProfileScope&) = delete;
+
+private:
+    const char* m_Name;
+    uint32_t m_Depth;
+    uint64_t m_Start;
+};
+
+#define FERX_PROFILE_CONCAT_IMPL(a, b) a##b
+#define FERX_PROFILE_CONCAT(a, b) FERX_PROFILE_CONCAT_IMPL(a, b)
+
+#define PROFILE_SCOPE(name) ProfileScope FERX_PROFILE_CONCAT(profileScope, __LINE__)(name)
+#define PROFILE_FUNCTION() PROFILE_SCOPE(__func__)
+#define PROFILE_THREAD(name) Profiler::SetThreadName(name)
+#define PROFILE_FRAME_BEGIN() Profiler::BeginFrame()
+#define PROFILE_FRAME_END() Profiler::EndFrame()
+
+#else
+
+#define PROFILE_SCOPE(name)
+#define PROFILE_FUNCTION()
+#define PROFILE_THREAD(name)
+#define PROFILE_FRAME_BEGIN()
+#define PROFILE_FRAME_END()
+
+#endif
@@ -1,4 +1,7 @@
 #include "FrameBuffer.h"
+#include "MemoryTracker.h"
+#include "RenderStats.h"
+#include "Log.h"
 
 FrameBuffer::FrameBuffer()
 {
@@ -18,8 +21,10 @@ void FrameBuffer::AttachTexture(int width, int height)
 	glRenderbufferStorage(GL_RENDERBUFFER, GL_DEPTH24_STENCIL8, width, height);
 	glFramebufferRenderbuffer(GL_FRAMEBUFFER, GL_DEPTH_STENCIL_ATTACHMENT, GL_RENDERBUFFER, m_RBO);
 
+	TrackGPUMemory(width, height);
+
 	if (glCheckFramebufferStatus(GL_FRAMEBUFFER) != GL_FRAMEBUFFER_COMPLETE)
-		std::cout << "ERROR::FRAMEBUFFER:: Framebuffer is not complete!" << std::endl;
+		LOG_ERROR("FrameBuffer", "ERROR::FRAMEBUFFER:: Framebuffer is not complete!");
 
 	glBindFramebuffer(GL_FRAMEBUFFER, 0);
 	glBindTexture(GL_TEXTURE_2D, 0);
@@ -41,14 +46,28 @@ FrameBuffer FrameBuffer::Create()
 	return FrameBuffer{};
 }
 
-void FrameBuffer::Shutdown() const
+void FrameBuffer::Shutdown()
 {
-	glDeleteBuffers(1, &m_FBO);
-	glDeleteBuffers(1, &m_RBO);
-	m_Texture->Shutdown();
+	TRACK_GPU_MEMORY(RenderTarget, -m_GPUBytes);
+	m_GPUBytes = 0;
+
+	glDeleteFramebuffers(1, &m_FBO);
+	glDeleteRenderbuffers(1, &m_RBO);
+	m_FBO = 0;
+	m_RBO = 0;
+
+	delete m_Texture;
+	m_Texture = nullptr;
 }
 
-void FrameBuffer::RescaleFrameBuffer(int width, int height) const
+void FrameBuffer::TrackGPUMemory(int width, int height)
+{
+	const int64_t bytes = static_cast<int64_t>(width) * height * 8;
+	TRACK_GPU_MEMORY(RenderTarget, bytes - m_GPUBytes);
+	m_GPUBytes = bytes;
+}
+
+void FrameBuffer::RescaleFrameBuffer(int width, int height)
 {
 	m_Texture->Bind();
 
@@ -60,14 +79,18 @@ void FrameBuffer::RescaleFrameBuffer(int width, int height) const
 	glBindRenderbuffer(GL_RENDERBUFFER, m_RBO);
 	glRenderbufferStorage(GL_RENDERBUFFER, GL_DEPTH24_STENCIL8, width, height);
 	glFramebufferRenderbuffer(GL_FRAMEBUFFER, GL_DEPTH_STENCIL_ATTACHMENT, GL_RENDERBUFFER, m_RBO);
+
+	TrackGPUMemory(width, height);
 }
 
 void FrameBuffer::Bind() const
 {
 	glBindFramebuffer(GL_FRAMEBUFFER, m_FBO);
+	RenderCounters::Bind(RenderBind::FrameBuffer);
 }
 
 void FrameBuffer::Unbind()
 {
 	glBindFramebuffer(GL_FRAMEBUFFER, 0);
+	RenderCounters::Bind(RenderBind::FrameBuffer);
 }
\ No newline at end of file
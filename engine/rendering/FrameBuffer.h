@@ -11,17 +11,21 @@ public:
     FrameBuffer();
     ~FrameBuffer();
 
-    void RescaleFrameBuffer(int width, int height) const;
+    void RescaleFrameBuffer(int width, int height);
     void AttachTexture(int width, int height);
     void Bind() const;
     static void Unbind();
-    void Shutdown() const;
+    void Shutdown();
 
     static FrameBuffer Create();
 
     Texture* GetFrameTexture() const;
 
 private:
+    // Color RGBA8 más profundidad/stencil D24S8
+    void TrackGPUMemory(int width, int height);
+
     unsigned int m_FBO{}, m_RBO{};
     Texture* m_Texture;
+    int64_t m_GPUBytes{};
 };
\ No newline at end of file
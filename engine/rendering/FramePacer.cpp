@@ -0,0 +1,140 @@
+#include "FramePacer.h"
+
+#include "RenderThread.h"
+#include "Profiler.h"
+
+#include <glad/glad.h>
+#define GLFW_INCLUDE_NONE
+#include <GLFW/glfw3.h>
+
+#include <chrono>
+#include <thread>
+
+std::atomic<PresentMode> FramePacer::s_Mode{PresentMode::VSync};
+std::atomic<double> FramePacer::s_TargetFPS{120.0};
+std::atomic<bool> FramePacer::s_IntervalDirty{false};
+bool FramePacer::s_AdaptiveSupported = false;
+
+int64_t FramePacer::s_NextFrame = 0;
+double FramePacer::s_LastWaitMs = 0.0;
+
+namespace
+{
+    // Margen que se espera activamente al final del limitador
+    constexpr int64_t SpinNanoseconds = 1500000;
+
+    int64_t SteadyNanoseconds()
+    {
+        return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+    }
+}
+
+void FramePacer::Init()
+{
+    s_AdaptiveSupported = glfwExtensionSupported("WGL_EXT_swap_control_tear") || glfwExtensionSupported("GLX_EXT_swap_control_tear");
+    glfwSwapInterval(GetSwapInterval(s_Mode.load()));
+    s_IntervalDirty = false;
+}
+
+void FramePacer::SetMode(PresentMode mode)
+{
+    if (mode == PresentMode::Count || mode == s_Mode.load())
+        return;
+
+    s_Mode = mode;
+    s_NextFrame = 0;
+    // El intervalo es estado del contexto: lo cambia el hilo que lo tiene activo
+    s_IntervalDirty = true;
+}
+
+const char* FramePacer::GetModeName(PresentMode mode)
+{
+    switch (mode)
+    {
+    case PresentMode::VSync: return "VSync";
+    case PresentMode::Uncapped: return "Uncapped";
+    case PresentMode::Adaptive: return "Adaptive VSync";
+    case PresentMode::Capped: return "Capped";
+    case PresentMode::LowLatency: return "Low Latency";
+    default: return "Unknown";
+    }
+}
+
+int FramePacer::GetSwapInterval(PresentMode mode)
+{
+    switch (mode)
+    {
+    case PresentMode::Uncapped:
+    case PresentMode::Capped:
+        return 0;
+    case PresentMode::Adaptive:
+        // Sin la extensión, -1 no es válido: se queda en VSync
+        return s_AdaptiveSupported ? -1 : 1;
+    default:
+        return 1;
+    }
+}
+
+void FramePacer::WaitForFrame()
+{
+    PROFILE_SCOPE("FramePacer::WaitForFrame");
+    const int64_t start = SteadyNanoseconds();
+
+    const PresentMode mode = s_Mode.load();
+    if (mode == PresentMode::LowLatency)
+    {
+        // El hilo de render termina su paquete con la espera a la fence: la entrada que se lea
+        // a continuación va directa al siguiente frame, sin otro en cola delante
+        RenderThread::WaitIdle();
+    }
+    else if (mode == PresentMode::Capped)
+    {
+        const auto period = static_cast<int64_t>(1e9 / s_TargetFPS.load());
+
+        // Si el frame llegó tarde se reinicia el plazo en lugar de acelerar los siguientes
+        s_NextFrame = s_NextFrame == 0 || start - s_NextFrame > period ? start : s_NextFrame + period;
+
+        int64_t now = start;
+        if (s_NextFrame - now > SpinNanoseconds)
+        {
+            std::this_thread::sleep_for(std::chrono::nanoseconds(s_NextFrame - now - SpinNanoseconds));
+            now = SteadyNanoseconds();
+        }
+        while (now < s_NextFrame)
+        {
+            std::this_thread::yield();
+            now = SteadyNanoseconds();
+        }
+    }
+
+    s_LastWaitMs = static_cast<double>(SteadyNanoseconds() - start) / 1e6;
+}
+
+void FramePacer::ApplySwapInterval()
+{
+    if (s_IntervalDirty.exchange(false))
+        glfwSwapInterval(GetSwapInterval(s_Mode.load()));
+}
+
+void FramePacer::OnPresent()
+{
+    if (s_Mode.load() != PresentMode::LowLatency)
+        return;
+
+    PROFILE_SCOPE("FramePacer::WaitForGPU");
+    GLsync fence = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+    if (!fence)
+        return;
+
+    // La primera espera vacía los comandos pendientes; las siguientes solo esperan.
+    // Tras un segundo se deja de esperar para no bloquear el editor si la GPU se cuelga.
+    GLbitfield flags = GL_SYNC_FLUSH_COMMANDS_BIT;
+    for (int attempt = 0; attempt < 10; attempt++)
+    {
+        const GLenum result = glClientWaitSync(fence, flags, 100000000); // 100 ms
+        if (result == GL_ALREADY_SIGNALED || result == GL_CONDITION_SATISFIED || result == GL_WAIT_FAILED)
+            break;
+        flags = 0;
+    }
+    glDeleteSync(fence);
+}
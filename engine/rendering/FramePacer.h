@@ -0,0 +1,66 @@
+#pragma once
+
+// Modos de presentación seleccionables en tiempo de ejecución:
+//  - VSync: intervalo de swap 1, la GPU espera al refresco del monitor
+//  - Uncapped: intervalo 0, tan rápido como se pueda (con tearing)
+//  - Adaptive: intervalo -1 (EXT_swap_control_tear); sincroniza si se llega a tiempo y si no
+//    presenta en cuanto puede en lugar de esperar al siguiente refresco
+//  - Capped: intervalo 0 y limitador en CPU al ritmo objetivo; duerme hasta poco antes del plazo
+//    y termina esperando activamente, porque el planificador no despierta con precisión de milisegundo
+//  - LowLatency: VSync, y tras cada swap el hilo de render espera a una fence de la GPU; el hilo
+//    principal no lee la entrada hasta que el frame anterior ha terminado, así que no se acumulan
+//    frames en cola entre la entrada y la pantalla
+//
+// La latencia de entrada a pantalla de cada modo se mide en GPUProfiler (PROFILE_GPU_PRESENT).
+
+#include <atomic>
+#include <cstdint>
+
+enum class PresentMode
+{
+    VSync,
+    Uncapped,
+    Adaptive,
+    Capped,
+    LowLatency,
+    Count
+};
+
+class FramePacer
+{
+public:
+    // Con el contexto de la ventana activo: detecta EXT_swap_control_tear y aplica el intervalo
+    static void Init();
+
+    static void SetMode(PresentMode mode);
+    static PresentMode GetMode() { return s_Mode.load(); }
+    static const char* GetModeName(PresentMode mode);
+    static bool IsAdaptiveSupported() { return s_AdaptiveSupported; }
+
+    // Ritmo del limitador en modo Capped
+    static void SetTargetFPS(double fps) { s_TargetFPS.store(fps > 1.0 ? fps : 1.0); }
+    static double GetTargetFPS() { return s_TargetFPS.load(); }
+
+    // Hilo principal, antes de leer la entrada del frame: limitador o espera al hilo de render
+    static void WaitForFrame();
+
+    // Hilo de render, antes del swap: aplica el intervalo si ha cambiado el modo
+    static void ApplySwapInterval();
+    // Hilo de render, después del swap: en LowLatency espera a que la GPU termine el frame
+    static void OnPresent();
+
+    // Milisegundos que esperó WaitForFrame en el último frame
+    static double GetLastWaitMs() { return s_LastWaitMs; }
+
+private:
+    static int GetSwapInterval(PresentMode mode);
+
+    static std::atomic<PresentMode> s_Mode;
+    static std::atomic<double> s_TargetFPS;
+    static std::atomic<bool> s_IntervalDirty;
+    static bool s_AdaptiveSupported;
+
+    // Plazo del próximo frame del limitador (ns de steady_clock); 0 sin referencia
+    static int64_t s_NextFrame;
+    static double s_LastWaitMs;
+};
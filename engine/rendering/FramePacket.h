@@ -0,0 +1,102 @@
+#pragma once
+
+// Datos de un frame que el hilo principal prepara para el hilo de render (RenderThread).
+// Es una copia: mientras el hilo de render dibuja un paquete, el principal ya está llenando el
+// siguiente y puede mover la cámara o editar la escena sin afectarle.
+
+#include "FrameAllocator.h"
+
+#include <glad/glad.h>
+#include <glm/glm.hpp>
+
+#include <cstdint>
+#include <memory>
+#include <memory_resource>
+#include <vector>
+
+// Un objeto visible con el LOD y los rangos de meshlets ya elegidos en el hilo principal
+struct SceneInstance
+{
+    glm::mat4 Model{1.0f};
+    glm::vec3 Color{1.0f};
+    unsigned int LOD{};
+    // Descarte por meshlets: rangos [FirstMeshletRange, FirstMeshletRange + MeshletRangeCount)
+    // de ScenePacket::MeshletCounts/MeshletOffsets. Puede no quedar ninguno visible.
+    bool Meshlets{};
+    uint32_t FirstMeshletRange{};
+    uint32_t MeshletRangeCount{};
+
+    bool operator==(const SceneInstance& other) const
+    {
+        return Model == other.Model && Color == other.Color && LOD == other.LOD && Meshlets == other.Meshlets &&
+               FirstMeshletRange == other.FirstMeshletRange && MeshletRangeCount == other.MeshletRangeCount;
+    }
+};
+
+struct ScenePacket
+{
+    // Generación de recursos del renderer con la que se construyó el paquete. Si la malla o la
+    // textura cambian antes de dibujarlo, los rangos de meshlets y las peticiones de mips ya no valen.
+    uint64_t ResourceGeneration{};
+    // Falso si el paquete dibujaría lo mismo que el anterior: el hilo de render se salta el pase de
+    // escena y el FrameBuffer conserva la última imagen (redibujo bajo demanda del editor)
+    bool Dirty = true;
+
+    glm::vec3 ClearColor{0.0f};
+    glm::mat4 View{1.0f};
+    glm::mat4 Projection{1.0f};
+
+    // En la memoria del frame en que se construyó (Reset); una copia usa la del destino
+    std::pmr::vector<SceneInstance> Instances;
+    std::pmr::vector<GLsizei> MeshletCounts;
+    std::pmr::vector<const void*> MeshletOffsets;
+    // Texels por píxel pedidos a la textura difusa por cada objeto (TextureStreamer::RequestMip)
+    std::pmr::vector<float> MipRequests;
+
+    // Misma imagen: cámara, color de fondo, recursos y objetos con sus LOD y meshlets.
+    // Las peticiones de mips no cuentan; solo cambian si cambia la cámara.
+    bool DrawsSameAs(const ScenePacket& other) const
+    {
+        return ResourceGeneration == other.ResourceGeneration && ClearColor == other.ClearColor &&
+               View == other.View && Projection == other.Projection && Instances == other.Instances &&
+               MeshletCounts == other.MeshletCounts && MeshletOffsets == other.MeshletOffsets;
+    }
+
+    // Vacía las listas y las pasa a 'resource' (FrameAllocator::GetResource()): llenarlas ya no reserva
+    // en el heap. Lo anterior queda en la memoria de su frame, que se descarta entera.
+    void Reset(std::pmr::memory_resource* resource)
+    {
+        FrameAllocator::Rebind(Instances, resource);
+        FrameAllocator::Rebind(MeshletCounts, resource);
+        FrameAllocator::Rebind(MeshletOffsets, resource);
+        FrameAllocator::Rebind(MipRequests, resource);
+    }
+
+    // Conserva la capacidad de los vectores para el siguiente frame
+    void Clear()
+    {
+        Instances.clear();
+        MeshletCounts.clear();
+        MeshletOffsets.clear();
+        MipRequests.clear();
+    }
+};
+
+// Dibujo que va sobre la escena en el framebuffer por defecto (la GUI del editor). El motor no
+// conoce ImGui: el editor guarda aquí su propia copia de las listas de dibujo.
+class FrameOverlay
+{
+public:
+    virtual ~FrameOverlay() = default;
+    virtual void Render() = 0;
+};
+
+struct FramePacket
+{
+    uint64_t Index{};
+    // Profiler::Now() cuando el hilo principal leyó la entrada de este frame (latencia hasta la pantalla)
+    uint64_t InputTicks{};
+    ScenePacket Scene;
+    // Se reutiliza entre frames; vacío si no hay nada que dibujar encima
+    std::unique_ptr<FrameOverlay> Overlay;
+};
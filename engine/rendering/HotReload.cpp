@@ -0,0 +1,148 @@
+#include "HotReload.h"
+#include "MemoryTracker.h"
+#include "Profiler.h"
+#include "Log.h"
+
+#include <algorithm>
+#include <filesystem>
+
+std::unique_ptr<FileWatcher> HotReload::s_Watcher;
+
+std::mutex HotReload::s_Mutex;
+std::unordered_set<std::string> HotReload::s_ShaderPaths;
+std::unordered_set<std::string> HotReload::s_TexturePaths;
+std::unordered_set<std::string> HotReload::s_ChangedShaders;
+std::vector<HotReload::PendingTexture> HotReload::s_DecodedTextures;
+
+std::vector<Shader*> HotReload::s_Shaders;
+std::vector<Texture*> HotReload::s_Textures;
+
+void HotReload::Init(const std::string& directory)
+{
+    s_Watcher = std::make_unique<FileWatcher>(directory, &HotReload::OnFileChanged);
+    LOG_INFO("HotReload", "Watching {}", directory);
+}
+
+void HotReload::Shutdown()
+{
+    // Se detiene el hilo antes de limpiar lo que su callback consulta
+    s_Watcher.reset();
+
+    std::lock_guard<std::mutex> lock(s_Mutex);
+    s_ShaderPaths.clear();
+    s_TexturePaths.clear();
+    s_ChangedShaders.clear();
+    s_DecodedTextures.clear();
+    s_Shaders.clear();
+    s_Textures.clear();
+}
+
+std::string HotReload::Normalize(const std::string& path)
+{
+    std::error_code error;
+    const std::filesystem::path canonical = std::filesystem::weakly_canonical(path, error);
+    return error ? path : canonical.string();
+}
+
+void HotReload::Watch(Shader* shader)
+{
+    s_Shaders.push_back(shader);
+
+    std::lock_guard<std::mutex> lock(s_Mutex);
+    s_ShaderPaths.insert(Normalize(shader->GetVertexPath()));
+    s_ShaderPaths.insert(Normalize(shader->GetFragmentPath()));
+}
+
+void HotReload::Watch(Texture* texture)
+{
+    s_Textures.push_back(texture);
+
+    std::lock_guard<std::mutex> lock(s_Mutex);
+    s_TexturePaths.insert(Normalize(texture->GetPath()));
+}
+
+void HotReload::Unwatch(const Shader* shader)
+{
+    // Las rutas se quedan registradas: otro shader puede compartirlas y un cambio sin dueño se ignora
+    s_Shaders.erase(std::remove(s_Shaders.begin(), s_Shaders.end(), shader), s_Shaders.end());
+}
+
+void HotReload::Unwatch(const Texture* texture)
+{
+    s_Textures.erase(std::remove(s_Textures.begin(), s_Textures.end(), texture), s_Textures.end());
+}
+
+// Hilo del watcher: solo trabajo de CPU
+void HotReload::OnFileChanged(const std::string& path)
+{
+    PROFILE_SCOPE("HotReload::OnFileChanged");
+    MEMORY_TAG(Texture);
+
+    const std::string normalized = Normalize(path);
+
+    bool isTexture;
+    {
+        std::lock_guard<std::mutex> lock(s_Mutex);
+        if (s_ShaderPaths.count(normalized) > 0)
+            s_ChangedShaders.insert(normalized);
+        isTexture = s_TexturePaths.count(normalized) > 0;
+    }
+
+    if (isTexture)
+    {
+        // La decodificación ocurre fuera del lock y fuera del bucle de render
+        PendingTexture pending{ normalized, {} };
+        if (!Texture::Decode(path, pending.Image))
+        {
+            LOG_ERROR("HotReload", "Failed to decode texture {}", path);
+            return;
+        }
+
+        std::lock_guard<std::mutex> lock(s_Mutex);
+        // Si la imagen cambió varias veces antes del Update(), solo cuenta la última
+        s_DecodedTextures.erase(std::remove_if(s_DecodedTextures.begin(), s_DecodedTextures.end(),
+                                               [&](const PendingTexture& other) { return other.Path == normalized; }),
+                                s_DecodedTextures.end());
+        s_DecodedTextures.push_back(std::move(pending));
+    }
+}
+
+// Hilo de OpenGL, entre frames
+bool HotReload::Update()
+{
+    PROFILE_SCOPE("HotReload::Update");
+    MEMORY_TAG(Rendering);
+
+    std::unordered_set<std::string> changedShaders;
+    std::vector<PendingTexture> decodedTextures;
+    {
+        std::lock_guard<std::mutex> lock(s_Mutex);
+        if (s_ChangedShaders.empty() && s_DecodedTextures.empty())
+            return false;
+        changedShaders.swap(s_ChangedShaders);
+        decodedTextures.swap(s_DecodedTextures);
+    }
+
+    for (Shader* shader : s_Shaders)
+    {
+        if (changedShaders.count(Normalize(shader->GetVertexPath())) == 0 &&
+            changedShaders.count(Normalize(shader->GetFragmentPath())) == 0)
+            continue;
+
+        if (shader->Reload())
+            LOG_INFO("HotReload", "Reloaded shader: {}, {}", shader->GetVertexPath(), shader->GetFragmentPath());
+    }
+
+    for (const PendingTexture& pending : decodedTextures)
+    {
+        for (Texture* texture : s_Textures)
+        {
+            if (Normalize(texture->GetPath()) != pending.Path)
+                continue;
+
+            texture->Upload(pending.Image);
+            LOG_INFO("HotReload", "Reloaded texture: {}", texture->GetPath());
+        }
+    }
+    return true;
+}
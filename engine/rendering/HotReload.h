@@ -0,0 +1,54 @@
+#pragma once
+
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_set>
+#include <vector>
+
+#include "FileWatcher.h"
+#include "Shader.h"
+#include "Texture.h"
+
+// Recarga en caliente de shaders y texturas.
+// El FileWatcher detecta cambios y, para texturas, decodifica la imagen en su propio hilo.
+// Update() se llama desde el hilo de OpenGL entre frames y aplica los cambios pendientes:
+// recompila solo los shaders afectados y sube solo las texturas modificadas.
+class HotReload
+{
+public:
+    static void Init(const std::string& directory);
+    static void Shutdown();
+
+    static void Watch(Shader* shader);
+    static void Watch(Texture* texture);
+    static void Unwatch(const Shader* shader);
+    static void Unwatch(const Texture* texture);
+
+    // Devuelve true si se recargó algún shader o textura (hay que volver a dibujar)
+    static bool Update();
+
+private:
+    struct PendingTexture
+    {
+        std::string Path;
+        TextureImage Image;
+    };
+
+    static void OnFileChanged(const std::string& path);
+    static std::string Normalize(const std::string& path);
+
+    static std::unique_ptr<FileWatcher> s_Watcher;
+
+    static std::mutex s_Mutex;
+    // Rutas vigiladas, consultadas desde el hilo del watcher
+    static std::unordered_set<std::string> s_ShaderPaths;
+    static std::unordered_set<std::string> s_TexturePaths;
+    // Cambios pendientes de aplicar en el siguiente Update()
+    static std::unordered_set<std::string> s_ChangedShaders;
+    static std::vector<PendingTexture> s_DecodedTextures;
+
+    // Solo se accede desde el hilo de OpenGL
+    static std::vector<Shader*> s_Shaders;
+    static std::vector<Texture*> s_Textures;
+};
@@ -1,4 +1,7 @@
 #include "IndexBuffer.h"
+#include "MemoryTracker.h"
+#include "RenderStats.h"
+#include "RenderCapture.h"
 
 IndexBuffer::IndexBuffer()
 {
@@ -18,19 +21,31 @@ IndexBuffer IndexBuffer::Create()
 void IndexBuffer::Bind() const
 {
     glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, m_IBO);
+    RenderCounters::Bind(RenderBind::Buffer);
 }
 void IndexBuffer::Unbind()
 {
     glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, 0);
 }
 
-void IndexBuffer::SetData(int size, const void* data) const
+void IndexBuffer::SetData(int size, const void* data)
 {
     Bind();
     glBufferData(GL_ELEMENT_ARRAY_BUFFER, size, data, GL_STATIC_DRAW);
+    RenderCounters::BufferUpload(size);
+    RenderCapture::Invalidate(CaptureResource::Buffer, m_IBO);
+
+    // glBufferData sustituye el almacenamiento anterior
+    TRACK_GPU_MEMORY(Buffer, size - m_Size);
+    m_Size = size;
 }
 
-void IndexBuffer::Shutdown() const
+void IndexBuffer::Shutdown()
 {
+    RenderCapture::Invalidate(CaptureResource::Buffer, m_IBO);
+    TRACK_GPU_MEMORY(Buffer, -m_Size);
+    m_Size = 0;
+
     glDeleteBuffers(1, &m_IBO);
+    m_IBO = 0;
 }
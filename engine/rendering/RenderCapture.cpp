@@ -0,0 +1,546 @@
+#include "RenderCapture.h"
+#include "Log.h"
+
+#include <cstring>
+#include <fstream>
+
+bool RenderCapture::s_Requested = false;
+bool RenderCapture::s_Recording = false;
+std::string RenderCapture::s_Path;
+unsigned int RenderCapture::s_FrameCount = 0;
+unsigned int RenderCapture::s_RecordedFrames = 0;
+
+std::vector<uint8_t> RenderCapture::s_Data;
+std::unordered_set<unsigned int> RenderCapture::s_Captured[static_cast<size_t>(CaptureResource::Count)];
+std::unordered_map<GLuint, std::vector<RenderCapture::UniformInfo>> RenderCapture::s_ProgramUniforms;
+std::unordered_map<GLuint, std::vector<std::vector<uint8_t>>> RenderCapture::s_UniformValues;
+std::unordered_map<GLuint, std::vector<GLuint>> RenderCapture::s_VertexArrayBuffers;
+RenderCapture::EmittedState RenderCapture::s_State;
+
+namespace
+{
+    // Tamaño del valor de un uniforme; 0 para los tipos que no se capturan
+    size_t UniformSize(GLenum type, bool& integer)
+    {
+        integer = false;
+        switch (type)
+        {
+        case GL_FLOAT: return 4;
+        case GL_FLOAT_VEC2: return 8;
+        case GL_FLOAT_VEC3: return 12;
+        case GL_FLOAT_VEC4: return 16;
+        case GL_FLOAT_MAT2: return 16;
+        case GL_FLOAT_MAT3: return 36;
+        case GL_FLOAT_MAT4: return 64;
+        default: break;
+        }
+
+        integer = true;
+        switch (type)
+        {
+        case GL_INT:
+        case GL_BOOL:
+        case GL_SAMPLER_2D:
+            return 4;
+        case GL_INT_VEC2:
+        case GL_BOOL_VEC2:
+            return 8;
+        case GL_INT_VEC3:
+        case GL_BOOL_VEC3:
+            return 12;
+        case GL_INT_VEC4:
+        case GL_BOOL_VEC4:
+            return 16;
+        default:
+            return 0;
+        }
+    }
+
+    GLint GetInteger(GLenum name)
+    {
+        GLint value = 0;
+        glGetIntegerv(name, &value);
+        return value;
+    }
+}
+
+void RenderCapture::Start(const std::string& path, unsigned int frameCount)
+{
+    if (s_Requested)
+    {
+        LOG_ERROR("RenderCapture", "A render capture is already in progress: {}", s_Path);
+        return;
+    }
+
+    s_Path = path;
+    s_FrameCount = frameCount > 0 ? frameCount : 1;
+    s_Requested = true;
+}
+
+void RenderCapture::BeginFrame()
+{
+    if (!s_Requested)
+        return;
+
+    if (!s_Recording)
+    {
+        s_Data.clear();
+        for (auto& captured : s_Captured)
+            captured.clear();
+        s_ProgramUniforms.clear();
+        s_UniformValues.clear();
+        s_VertexArrayBuffers.clear();
+        s_RecordedFrames = 0;
+
+        Write(RenderCaptureMagic);
+        Write(RenderCaptureVersion);
+        Write(s_FrameCount);
+        WriteString(reinterpret_cast<const char*>(glGetString(GL_VENDOR)));
+        WriteString(reinterpret_cast<const char*>(glGetString(GL_RENDERER)));
+        s_Recording = true;
+    }
+
+    // Cada frame parte de un estado emitido vacío, para poder reproducirlo en bucle
+    s_State = EmittedState();
+    for (auto& values : s_UniformValues)
+        values.second.clear();
+
+    GLint viewport[4];
+    glGetIntegerv(GL_VIEWPORT, viewport);
+
+    const size_t command = BeginCommand(CaptureCommand::FrameBegin);
+    Write(viewport[0] + viewport[2]);
+    Write(viewport[1] + viewport[3]);
+    EndCommand(command);
+}
+
+void RenderCapture::EndFrame()
+{
+    if (!s_Recording)
+        return;
+
+    EndCommand(BeginCommand(CaptureCommand::FrameEnd));
+
+    if (++s_RecordedFrames < s_FrameCount)
+        return;
+
+    s_Recording = false;
+    s_Requested = false;
+    if (WriteFile())
+        LOG_INFO("RenderCapture", "Render capture written: {} ({} frames, {} KB)", s_Path, s_RecordedFrames, s_Data.size() / 1024);
+
+    s_Data.clear();
+    s_Data.shrink_to_fit();
+}
+
+bool RenderCapture::WriteFile()
+{
+    std::ofstream file(s_Path, std::ios::binary);
+    if (!file.is_open())
+    {
+        LOG_ERROR("RenderCapture", "Failed to write render capture: {}", s_Path);
+        return false;
+    }
+
+    file.write(reinterpret_cast<const char*>(s_Data.data()), static_cast<std::streamsize>(s_Data.size()));
+    return file.good();
+}
+
+void RenderCapture::RecordClear(GLbitfield mask)
+{
+    // glClear solo depende de los valores de borrado (el programa activo aún puede ser el de ImGui)
+    GLfloat color[4];
+    GLfloat depth = 1.0f;
+    glGetFloatv(GL_COLOR_CLEAR_VALUE, color);
+    glGetFloatv(GL_DEPTH_CLEAR_VALUE, &depth);
+
+    const size_t command = BeginCommand(CaptureCommand::Clear);
+    Write(static_cast<uint32_t>(mask));
+    Write(color, sizeof(color));
+    Write(depth);
+    EndCommand(command);
+}
+
+void RenderCapture::RecordDrawElements(GLenum mode, GLsizei count, GLenum type, const void* offset)
+{
+    SnapshotState();
+
+    const size_t command = BeginCommand(CaptureCommand::DrawElements);
+    Write(static_cast<uint32_t>(mode));
+    Write(static_cast<int32_t>(count));
+    Write(static_cast<uint32_t>(type));
+    Write(static_cast<uint64_t>(reinterpret_cast<uintptr_t>(offset)));
+    EndCommand(command);
+}
+
+void RenderCapture::RecordMultiDrawElements(GLenum mode, const GLsizei* counts, GLenum type, const void* const* offsets, GLsizei drawCount)
+{
+    SnapshotState();
+
+    const size_t command = BeginCommand(CaptureCommand::MultiDrawElements);
+    Write(static_cast<uint32_t>(mode));
+    Write(static_cast<uint32_t>(type));
+    Write(static_cast<int32_t>(drawCount));
+    for (GLsizei i = 0; i < drawCount; i++)
+        Write(static_cast<int32_t>(counts[i]));
+    for (GLsizei i = 0; i < drawCount; i++)
+        Write(static_cast<uint64_t>(reinterpret_cast<uintptr_t>(offsets[i])));
+    EndCommand(command);
+}
+
+void RenderCapture::SnapshotState()
+{
+    GLint viewport[4];
+    glGetIntegerv(GL_VIEWPORT, viewport);
+    if (std::memcmp(viewport, s_State.Viewport, sizeof(viewport)) != 0)
+    {
+        const size_t command = BeginCommand(CaptureCommand::Viewport);
+        Write(viewport, sizeof(viewport));
+        EndCommand(command);
+        std::memcpy(s_State.Viewport, viewport, sizeof(viewport));
+    }
+
+    const int64_t flags = (glIsEnabled(GL_DEPTH_TEST) ? CaptureDepthTest : 0u) |
+                          (glIsEnabled(GL_CULL_FACE) ? CaptureCullFace : 0u) |
+                          (glIsEnabled(GL_BLEND) ? CaptureBlend : 0u);
+    if (flags != s_State.Flags)
+    {
+        const size_t command = BeginCommand(CaptureCommand::State);
+        Write(static_cast<uint32_t>(flags));
+        EndCommand(command);
+        s_State.Flags = flags;
+    }
+
+    std::vector<GLint> samplerUnits;
+    const GLint program = GetInteger(GL_CURRENT_PROGRAM);
+    if (program != 0)
+    {
+        CaptureProgram(program);
+        if (program != s_State.Program)
+        {
+            const size_t command = BeginCommand(CaptureCommand::UseProgram);
+            Write(static_cast<uint32_t>(program));
+            EndCommand(command);
+            s_State.Program = program;
+        }
+        CaptureUniforms(program, samplerUnits);
+    }
+
+    const GLint vertexArray = GetInteger(GL_VERTEX_ARRAY_BINDING);
+    if (vertexArray != 0)
+        CaptureVertexArray(vertexArray);
+    if (vertexArray != s_State.VertexArray)
+    {
+        const size_t command = BeginCommand(CaptureCommand::BindVertexArray);
+        Write(static_cast<uint32_t>(vertexArray));
+        EndCommand(command);
+        s_State.VertexArray = vertexArray;
+    }
+
+    // Solo importan las unidades que lee algún sampler del programa
+    const GLint activeUnit = GetInteger(GL_ACTIVE_TEXTURE);
+    for (GLint unit : samplerUnits)
+    {
+        glActiveTexture(GL_TEXTURE0 + unit);
+        const GLint texture = GetInteger(GL_TEXTURE_BINDING_2D);
+        if (texture != 0)
+            CaptureTexture(texture);
+
+        const auto it = s_State.Textures.find(unit);
+        if (it != s_State.Textures.end() && it->second == texture)
+            continue;
+
+        const size_t command = BeginCommand(CaptureCommand::BindTexture);
+        Write(static_cast<uint32_t>(unit));
+        Write(static_cast<uint32_t>(texture));
+        EndCommand(command);
+        s_State.Textures[unit] = texture;
+    }
+    glActiveTexture(activeUnit);
+}
+
+bool RenderCapture::IsCaptured(CaptureResource resource, unsigned int name)
+{
+    return !s_Captured[static_cast<size_t>(resource)].insert(name).second;
+}
+
+void RenderCapture::CaptureProgram(GLuint program)
+{
+    if (IsCaptured(CaptureResource::Program, program))
+        return;
+
+    // Los shaders se borran tras enlazar, pero siguen adjuntos al programa y conservan su código
+    GLuint shaders[2]{};
+    GLsizei shaderCount = 0;
+    glGetAttachedShaders(program, 2, &shaderCount, shaders);
+
+    std::string sources[2];
+    for (GLsizei i = 0; i < shaderCount; i++)
+    {
+        GLint type = 0, length = 0;
+        glGetShaderiv(shaders[i], GL_SHADER_TYPE, &type);
+        glGetShaderiv(shaders[i], GL_SHADER_SOURCE_LENGTH, &length);
+
+        std::string source(static_cast<size_t>(length), '\0');
+        if (length > 0)
+            glGetShaderSource(shaders[i], length, nullptr, source.data());
+        source.resize(std::strlen(source.c_str()));
+        sources[type == GL_VERTEX_SHADER ? 0 : 1] = source;
+    }
+    if (sources[0].empty() || sources[1].empty())
+        LOG_ERROR("RenderCapture", "Program {} has no readable shader sources", program);
+
+    const size_t command = BeginCommand(CaptureCommand::CreateProgram);
+    Write(static_cast<uint32_t>(program));
+    WriteString(sources[0]);
+    WriteString(sources[1]);
+    EndCommand(command);
+
+    // El programa se recrea en la reproducción: hay que volver a activarlo y enviar todos sus uniformes
+    s_State.Program = -1;
+    s_UniformValues.erase(program);
+
+    std::vector<UniformInfo>& uniforms = s_ProgramUniforms[program];
+    uniforms.clear();
+
+    GLint uniformCount = 0, maxLength = 0;
+    glGetProgramiv(program, GL_ACTIVE_UNIFORMS, &uniformCount);
+    glGetProgramiv(program, GL_ACTIVE_UNIFORM_MAX_LENGTH, &maxLength);
+    std::vector<char> nameBuffer(static_cast<size_t>(maxLength) + 1);
+
+    for (GLint i = 0; i < uniformCount; i++)
+    {
+        GLint size = 0;
+        GLenum type = 0;
+        glGetActiveUniform(program, static_cast<GLuint>(i), static_cast<GLsizei>(nameBuffer.size()), nullptr, &size, &type, nameBuffer.data());
+
+        bool integer;
+        if (UniformSize(type, integer) == 0)
+            continue;
+
+        // Los arrays se capturan elemento a elemento, cada uno con su nombre "base[i]"
+        std::string name = nameBuffer.data();
+        if (size > 1 && name.size() > 3 && name.compare(name.size() - 3, 3, "[0]") == 0)
+            name.resize(name.size() - 3);
+
+        for (GLint element = 0; element < size; element++)
+        {
+            const std::string elementName = size > 1 ? name + "[" + std::to_string(element) + "]" : name;
+            const GLint location = glGetUniformLocation(program, elementName.c_str());
+            if (location >= 0)
+                uniforms.push_back({ elementName, type, location });
+        }
+    }
+}
+
+void RenderCapture::CaptureUniforms(GLuint program, std::vector<GLint>& samplerUnits)
+{
+    const std::vector<UniformInfo>& uniforms = s_ProgramUniforms[program];
+    std::vector<std::vector<uint8_t>>& lastValues = s_UniformValues[program];
+    lastValues.resize(uniforms.size());
+
+    uint8_t value[64];
+    for (size_t i = 0; i < uniforms.size(); i++)
+    {
+        const UniformInfo& uniform = uniforms[i];
+        bool integer;
+        const size_t size = UniformSize(uniform.Type, integer);
+        if (integer)
+            glGetUniformiv(program, uniform.Location, reinterpret_cast<GLint*>(value));
+        else
+            glGetUniformfv(program, uniform.Location, reinterpret_cast<GLfloat*>(value));
+
+        if (uniform.Type == GL_SAMPLER_2D)
+            samplerUnits.push_back(*reinterpret_cast<GLint*>(value));
+
+        std::vector<uint8_t>& last = lastValues[i];
+        if (last.size() == size && std::memcmp(last.data(), value, size) == 0)
+            continue;
+        last.assign(value, value + size);
+
+        const size_t command = BeginCommand(CaptureCommand::Uniform);
+        WriteString(uniform.Name);
+        Write(static_cast<uint32_t>(uniform.Type));
+        Write(value, size);
+        EndCommand(command);
+    }
+}
+
+void RenderCapture::CaptureVertexArray(GLuint vertexArray)
+{
+    if (IsCaptured(CaptureResource::VertexArray, vertexArray))
+    {
+        // El VAO puede seguir siendo válido aunque se haya vuelto a subir alguno de sus búferes
+        for (GLuint buffer : s_VertexArrayBuffers[vertexArray])
+            CaptureBuffer(buffer);
+        return;
+    }
+
+    struct Attribute
+    {
+        uint32_t Index, Buffer, Type;
+        int32_t Size, Stride;
+        uint32_t Normalized, Integer, Divisor;
+        uint64_t Offset;
+    };
+    std::vector<Attribute> attributes;
+    std::vector<GLuint>& buffers = s_VertexArrayBuffers[vertexArray];
+    buffers.clear();
+
+    // Se consulta el VAO vinculado, que es el que va a usar el draw
+    const GLint maxAttributes = GetInteger(GL_MAX_VERTEX_ATTRIBS);
+    for (GLint index = 0; index < maxAttributes; index++)
+    {
+        GLint enabled = 0;
+        glGetVertexAttribiv(index, GL_VERTEX_ATTRIB_ARRAY_ENABLED, &enabled);
+        if (!enabled)
+            continue;
+
+        GLint buffer = 0, size = 0, type = 0, stride = 0, normalized = 0, integer = 0, divisor = 0;
+        void* pointer = nullptr;
+        glGetVertexAttribiv(index, GL_VERTEX_ATTRIB_ARRAY_BUFFER_BINDING, &buffer);
+        glGetVertexAttribiv(index, GL_VERTEX_ATTRIB_ARRAY_SIZE, &size);
+        glGetVertexAttribiv(index, GL_VERTEX_ATTRIB_ARRAY_TYPE, &type);
+        glGetVertexAttribiv(index, GL_VERTEX_ATTRIB_ARRAY_STRIDE, &stride);
+        glGetVertexAttribiv(index, GL_VERTEX_ATTRIB_ARRAY_NORMALIZED, &normalized);
+        glGetVertexAttribiv(index, GL_VERTEX_ATTRIB_ARRAY_INTEGER, &integer);
+        glGetVertexAttribiv(index, GL_VERTEX_ATTRIB_ARRAY_DIVISOR, &divisor);
+        glGetVertexAttribPointerv(index, GL_VERTEX_ATTRIB_ARRAY_POINTER, &pointer);
+
+        attributes.push_back({ static_cast<uint32_t>(index), static_cast<uint32_t>(buffer), static_cast<uint32_t>(type),
+                               size, stride, static_cast<uint32_t>(normalized), static_cast<uint32_t>(integer),
+                               static_cast<uint32_t>(divisor), static_cast<uint64_t>(reinterpret_cast<uintptr_t>(pointer)) });
+        buffers.push_back(buffer);
+    }
+    const GLint elementBuffer = GetInteger(GL_ELEMENT_ARRAY_BUFFER_BINDING);
+    buffers.push_back(elementBuffer);
+
+    // Los búferes van antes que el VAO que los referencia
+    for (GLuint buffer : buffers)
+        CaptureBuffer(buffer);
+
+    const size_t command = BeginCommand(CaptureCommand::CreateVertexArray);
+    Write(static_cast<uint32_t>(vertexArray));
+    Write(static_cast<uint32_t>(elementBuffer));
+    Write(static_cast<uint32_t>(attributes.size()));
+    for (const Attribute& attribute : attributes)
+    {
+        Write(attribute.Index);
+        Write(attribute.Buffer);
+        Write(attribute.Type);
+        Write(attribute.Size);
+        Write(attribute.Stride);
+        Write(attribute.Normalized);
+        Write(attribute.Integer);
+        Write(attribute.Divisor);
+        Write(attribute.Offset);
+    }
+    EndCommand(command);
+
+    s_State.VertexArray = -1;
+}
+
+void RenderCapture::CaptureBuffer(GLuint buffer)
+{
+    if (buffer == 0 || IsCaptured(CaptureResource::Buffer, buffer))
+        return;
+
+    // GL_COPY_READ_BUFFER no forma parte del estado del VAO, así que leer no altera nada
+    const GLint previous = GetInteger(GL_COPY_READ_BUFFER_BINDING);
+    glBindBuffer(GL_COPY_READ_BUFFER, buffer);
+
+    GLint size = 0;
+    glGetBufferParameteriv(GL_COPY_READ_BUFFER, GL_BUFFER_SIZE, &size);
+
+    const size_t command = BeginCommand(CaptureCommand::CreateBuffer);
+    Write(static_cast<uint32_t>(buffer));
+    Write(static_cast<uint32_t>(size));
+    const size_t start = s_Data.size();
+    s_Data.resize(start + static_cast<size_t>(size));
+    if (size > 0)
+        glGetBufferSubData(GL_COPY_READ_BUFFER, 0, size, s_Data.data() + start);
+    EndCommand(command);
+
+    glBindBuffer(GL_COPY_READ_BUFFER, previous);
+}
+
+void RenderCapture::CaptureTexture(GLuint texture)
+{
+    if (IsCaptured(CaptureResource::Texture, texture))
+        return;
+
+    GLint minFilter = 0, magFilter = 0, wrapS = 0, wrapT = 0, baseLevel = 0, maxLevel = 0;
+    glGetTexParameteriv(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, &minFilter);
+    glGetTexParameteriv(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, &magFilter);
+    glGetTexParameteriv(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, &wrapS);
+    glGetTexParameteriv(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, &wrapT);
+    glGetTexParameteriv(GL_TEXTURE_2D, GL_TEXTURE_BASE_LEVEL, &baseLevel);
+    glGetTexParameteriv(GL_TEXTURE_2D, GL_TEXTURE_MAX_LEVEL, &maxLevel);
+
+    // Niveles con almacenamiento; los mips expulsados por el streaming tienen tamaño cero
+    struct Level
+    {
+        int32_t Index, Width, Height;
+    };
+    std::vector<Level> levels;
+    GLint levelCount = 1;
+    for (GLint size = GetInteger(GL_MAX_TEXTURE_SIZE); size > 1; size /= 2)
+        levelCount++;
+    for (GLint level = 0; level < levelCount && level <= maxLevel; level++)
+    {
+        GLint width = 0, height = 0;
+        glGetTexLevelParameteriv(GL_TEXTURE_2D, level, GL_TEXTURE_WIDTH, &width);
+        glGetTexLevelParameteriv(GL_TEXTURE_2D, level, GL_TEXTURE_HEIGHT, &height);
+        if (width > 0 && height > 0)
+            levels.push_back({ level, width, height });
+    }
+
+    const size_t command = BeginCommand(CaptureCommand::CreateTexture);
+    Write(static_cast<uint32_t>(texture));
+    Write(minFilter);
+    Write(magFilter);
+    Write(wrapS);
+    Write(wrapT);
+    Write(baseLevel);
+    Write(maxLevel);
+    Write(static_cast<uint32_t>(levels.size()));
+    for (const Level& level : levels)
+    {
+        Write(level.Index);
+        Write(level.Width);
+        Write(level.Height);
+
+        const size_t start = s_Data.size();
+        s_Data.resize(start + static_cast<size_t>(level.Width) * level.Height * 4);
+        glGetTexImage(GL_TEXTURE_2D, level.Index, GL_RGBA, GL_UNSIGNED_BYTE, s_Data.data() + start);
+    }
+    EndCommand(command);
+
+    s_State.Textures.clear();
+}
+
+size_t RenderCapture::BeginCommand(CaptureCommand command)
+{
+    const size_t start = s_Data.size();
+    Write(static_cast<uint8_t>(command));
+    Write(static_cast<uint32_t>(0));
+    return start;
+}
+
+void RenderCapture::EndCommand(size_t start)
+{
+    const auto size = static_cast<uint32_t>(s_Data.size() - start - sizeof(uint8_t) - sizeof(uint32_t));
+    std::memcpy(s_Data.data() + start + sizeof(uint8_t), &size, sizeof(size));
+}
+
+void RenderCapture::Write(const void* data, size_t size)
+{
+    const auto* bytes = static_cast<const uint8_t*>(data);
+    s_Data.insert(s_Data.end(), bytes, bytes + size);
+}
+
+void RenderCapture::WriteString(const std::string& text)
+{
+    Write(static_cast<uint32_t>(text.size()));
+    Write(text.data(), text.size());
+}
@@ -0,0 +1,142 @@
+#pragma once
+
+// Captura de los envíos del renderizador a un archivo binario para reproducirlos con RenderReplay.
+// En cada draw se toma una instantánea del estado de OpenGL que le afecta (programa y uniformes,
+// VAO, texturas de los samplers, estado fijo, viewport) y solo se escriben los cambios respecto al
+// draw anterior. Los recursos se leen de la GPU la primera vez que se usan, así que la captura no
+// depende de cómo se crearon; una subida o un borrado los invalida y se vuelven a leer.
+//
+// Formato: cabecera (magia, versión, frames, vendor y renderer de OpenGL) seguida de comandos
+// { uint8 tipo, uint32 tamaño, datos }. Los identificadores son los nombres de OpenGL originales.
+
+#include <glad/glad.h>
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+constexpr uint32_t RenderCaptureMagic = 0x43585246; // "FRXC"
+constexpr uint32_t RenderCaptureVersion = 1;
+
+enum class CaptureCommand : uint8_t
+{
+    FrameBegin = 1,
+    FrameEnd,
+    Viewport,
+    State,
+    Clear,
+    CreateBuffer,
+    CreateTexture,
+    CreateProgram,
+    CreateVertexArray,
+    UseProgram,
+    Uniform,
+    BindVertexArray,
+    BindTexture,
+    DrawElements,
+    MultiDrawElements
+};
+
+enum class CaptureResource : uint8_t
+{
+    Buffer,
+    Texture,
+    Program,
+    VertexArray,
+    Count
+};
+
+// Bits del comando State
+constexpr uint32_t CaptureDepthTest = 1 << 0;
+constexpr uint32_t CaptureCullFace = 1 << 1;
+constexpr uint32_t CaptureBlend = 1 << 2;
+
+class RenderCapture
+{
+public:
+    // Empieza a grabar en el siguiente frame y escribe 'path' al terminar 'frameCount' frames
+    static void Start(const std::string& path, unsigned int frameCount = 1);
+    static bool IsActive() { return s_Requested; }
+    static bool IsRecording() { return s_Recording; }
+
+    // Renderer::Render los llama con el FBO de la escena ya vinculado y al cerrar el frame
+    static void BeginFrame();
+    static void EndFrame();
+
+    // Ganchos de los envoltorios de OpenGL; sin captura en curso no hacen nada
+    static void OnClear(GLbitfield mask)
+    {
+        if (s_Recording)
+            RecordClear(mask);
+    }
+    static void OnDrawElements(GLenum mode, GLsizei count, GLenum type, const void* offset)
+    {
+        if (s_Recording)
+            RecordDrawElements(mode, count, type, offset);
+    }
+    static void OnMultiDrawElements(GLenum mode, const GLsizei* counts, GLenum type, const void* const* offsets, GLsizei drawCount)
+    {
+        if (s_Recording)
+            RecordMultiDrawElements(mode, counts, type, offsets, drawCount);
+    }
+    // El recurso cambió de contenido o se borró (su nombre puede reutilizarse)
+    static void Invalidate(CaptureResource resource, unsigned int name)
+    {
+        if (s_Recording)
+            s_Captured[static_cast<size_t>(resource)].erase(name);
+    }
+
+private:
+    struct UniformInfo
+    {
+        std::string Name;
+        GLenum Type{};
+        GLint Location{};
+    };
+
+    // Estado ya emitido, para escribir solo los cambios
+    struct EmittedState
+    {
+        GLint Program = -1;
+        GLint VertexArray = -1;
+        std::unordered_map<GLint, GLint> Textures;
+        int64_t Flags = -1;
+        GLint Viewport[4]{ -1, -1, -1, -1 };
+    };
+
+    static void RecordClear(GLbitfield mask);
+    static void RecordDrawElements(GLenum mode, GLsizei count, GLenum type, const void* offset);
+    static void RecordMultiDrawElements(GLenum mode, const GLsizei* counts, GLenum type, const void* const* offsets, GLsizei drawCount);
+
+    static void SnapshotState();
+    static void CaptureProgram(GLuint program);
+    static void CaptureUniforms(GLuint program, std::vector<GLint>& samplerUnits);
+    static void CaptureVertexArray(GLuint vertexArray);
+    static void CaptureBuffer(GLuint buffer);
+    // Lee la textura vinculada en la unidad activa
+    static void CaptureTexture(GLuint texture);
+    static bool IsCaptured(CaptureResource resource, unsigned int name);
+
+    static size_t BeginCommand(CaptureCommand command);
+    static void EndCommand(size_t start);
+    static void Write(const void* data, size_t size);
+    template<typename T>
+    static void Write(const T& value) { Write(&value, sizeof(T)); }
+    static void WriteString(const std::string& text);
+
+    static bool WriteFile();
+
+    static bool s_Requested;
+    static bool s_Recording;
+    static std::string s_Path;
+    static unsigned int s_FrameCount;
+    static unsigned int s_RecordedFrames;
+
+    static std::vector<uint8_t> s_Data;
+    static std::unordered_set<unsigned int> s_Captured[static_cast<size_t>(CaptureResource::Count)];
+    static std::unordered_map<GLuint, std::vector<UniformInfo>> s_ProgramUniforms;
+    static std::unordered_map<GLuint, std::vector<std::vector<uint8_t>>> s_UniformValues;
+    static std::unordered_map<GLuint, std::vector<GLuint>> s_VertexArrayBuffers;
+    static EmittedState s_State;
+};
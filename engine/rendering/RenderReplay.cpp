@@ -0,0 +1,450 @@
+#include "RenderReplay.h"
+#include "Shader.h"
+#include "Log.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+#include <fstream>
+#include <map>
+
+namespace
+{
+    // Lectura secuencial de los datos de un comando; al pasarse del final devuelve ceros
+    class CommandReader
+    {
+    public:
+        CommandReader(const uint8_t* data, size_t size) : m_Data(data), m_End(data + size) {}
+
+        template<typename T>
+        T Read()
+        {
+            T value{};
+            ReadBytes(&value, sizeof(T));
+            return value;
+        }
+
+        std::string ReadString()
+        {
+            const auto size = Read<uint32_t>();
+            if (size > Remaining())
+            {
+                m_Data = m_End;
+                return {};
+            }
+            std::string text(reinterpret_cast<const char*>(m_Data), size);
+            m_Data += size;
+            return text;
+        }
+
+        // Puntero a 'size' bytes sin copiarlos; nullptr si no quedan
+        const uint8_t* Skip(size_t size)
+        {
+            if (size > Remaining())
+            {
+                m_Data = m_End;
+                return nullptr;
+            }
+            const uint8_t* data = m_Data;
+            m_Data += size;
+            return data;
+        }
+
+        void ReadBytes(void* out, size_t size)
+        {
+            if (const uint8_t* data = Skip(size))
+                std::memcpy(out, data, size);
+        }
+
+        size_t Remaining() const { return static_cast<size_t>(m_End - m_Data); }
+
+    private:
+        const uint8_t* m_Data;
+        const uint8_t* m_End;
+    };
+
+    using Clock = std::chrono::steady_clock;
+}
+
+RenderReplay::~RenderReplay()
+{
+    Shutdown();
+}
+
+bool RenderReplay::Load(const std::string& path)
+{
+    std::ifstream file(path, std::ios::binary | std::ios::ate);
+    if (!file.is_open())
+    {
+        LOG_ERROR("RenderReplay", "Failed to open render capture: {}", path);
+        return false;
+    }
+
+    m_Data.resize(static_cast<size_t>(file.tellg()));
+    file.seekg(0);
+    file.read(reinterpret_cast<char*>(m_Data.data()), static_cast<std::streamsize>(m_Data.size()));
+
+    CommandReader header(m_Data.data(), m_Data.size());
+    if (header.Read<uint32_t>() != RenderCaptureMagic || header.Read<uint32_t>() != RenderCaptureVersion)
+    {
+        LOG_ERROR("RenderReplay", "Not a render capture or unsupported version: {}", path);
+        return false;
+    }
+    m_FrameCount = header.Read<uint32_t>();
+    m_Vendor = header.ReadString();
+    m_Renderer = header.ReadString();
+
+    m_Commands.clear();
+    std::map<std::pair<CaptureCommand, uint32_t>, unsigned int> creations;
+
+    size_t offset = m_Data.size() - header.Remaining();
+    while (offset < m_Data.size())
+    {
+        CommandReader reader(m_Data.data() + offset, m_Data.size() - offset);
+        Command command;
+        command.Type = static_cast<CaptureCommand>(reader.Read<uint8_t>());
+        command.Size = reader.Read<uint32_t>();
+        command.Offset = offset + sizeof(uint8_t) + sizeof(uint32_t);
+        if (command.Size > reader.Remaining())
+        {
+            LOG_ERROR("RenderReplay", "Render capture is truncated: {}", path);
+            return false;
+        }
+
+        CommandReader payload(m_Data.data() + command.Offset, command.Size);
+        switch (command.Type)
+        {
+        case CaptureCommand::FrameBegin:
+            m_Width = std::max(m_Width, payload.Read<int32_t>());
+            m_Height = std::max(m_Height, payload.Read<int32_t>());
+            break;
+        case CaptureCommand::CreateBuffer:
+        case CaptureCommand::CreateTexture:
+        case CaptureCommand::CreateProgram:
+        case CaptureCommand::CreateVertexArray:
+            creations[{ command.Type, payload.Read<uint32_t>() }]++;
+            break;
+        default:
+            break;
+        }
+
+        m_Commands.push_back(command);
+        offset = command.Offset + command.Size;
+    }
+
+    // Un recurso creado una sola vez conserva su contenido entre pasadas
+    for (Command& command : m_Commands)
+    {
+        if (command.Type < CaptureCommand::CreateBuffer || command.Type > CaptureCommand::CreateVertexArray)
+            continue;
+        CommandReader payload(m_Data.data() + command.Offset, command.Size);
+        command.SkipOnRepeat = creations[{ command.Type, payload.Read<uint32_t>() }] == 1;
+    }
+
+    if (m_Width <= 0 || m_Height <= 0)
+    {
+        LOG_ERROR("RenderReplay", "Render capture has no frames: {}", path);
+        return false;
+    }
+    return true;
+}
+
+std::vector<double> RenderReplay::Run(unsigned int passes)
+{
+    std::vector<double> frameTimes;
+    if (m_Commands.empty())
+        return frameTimes;
+
+    if (!m_FBO)
+    {
+        m_FBO = std::make_unique<FrameBuffer>();
+        m_FBO->AttachTexture(m_Width, m_Height);
+    }
+
+    Clock::time_point frameStart;
+    for (unsigned int pass = 0; pass < passes; pass++)
+    {
+        for (const Command& command : m_Commands)
+        {
+            if (m_Warm && command.SkipOnRepeat)
+                continue;
+
+            if (command.Type == CaptureCommand::FrameBegin)
+                frameStart = Clock::now();
+
+            Execute(command);
+
+            if (command.Type == CaptureCommand::FrameEnd)
+            {
+                glFinish();
+                frameTimes.push_back(std::chrono::duration<double, std::milli>(Clock::now() - frameStart).count());
+            }
+        }
+        m_Warm = true;
+    }
+
+    glBindVertexArray(0);
+    glUseProgram(0);
+    m_Program = 0;
+    FrameBuffer::Unbind();
+    return frameTimes;
+}
+
+void RenderReplay::Shutdown()
+{
+    for (const auto& buffer : m_Objects[static_cast<size_t>(CaptureResource::Buffer)])
+        glDeleteBuffers(1, &buffer.second);
+    for (const auto& texture : m_Objects[static_cast<size_t>(CaptureResource::Texture)])
+        glDeleteTextures(1, &texture.second);
+    for (const auto& program : m_Objects[static_cast<size_t>(CaptureResource::Program)])
+        glDeleteProgram(program.second);
+    for (const auto& vertexArray : m_Objects[static_cast<size_t>(CaptureResource::VertexArray)])
+        glDeleteVertexArrays(1, &vertexArray.second);
+
+    for (auto& objects : m_Objects)
+        objects.clear();
+    m_UniformLocations.clear();
+    m_Program = 0;
+    m_Warm = false;
+    m_FBO.reset();
+}
+
+GLuint RenderReplay::Find(CaptureResource resource, uint32_t id) const
+{
+    const auto& objects = m_Objects[static_cast<size_t>(resource)];
+    const auto it = objects.find(id);
+    return it != objects.end() ? it->second : 0;
+}
+
+GLint RenderReplay::GetUniformLocation(const std::string& name)
+{
+    auto& locations = m_UniformLocations[m_Program];
+    const auto it = locations.find(name);
+    if (it != locations.end())
+        return it->second;
+
+    const GLint location = glGetUniformLocation(m_Program, name.c_str());
+    locations[name] = location;
+    return location;
+}
+
+void RenderReplay::Execute(const Command& command)
+{
+    CommandReader reader(m_Data.data() + command.Offset, command.Size);
+
+    switch (command.Type)
+    {
+    case CaptureCommand::FrameBegin:
+        m_FBO->Bind();
+        glViewport(0, 0, m_Width, m_Height);
+        break;
+
+    case CaptureCommand::FrameEnd:
+        break;
+
+    case CaptureCommand::Viewport:
+    {
+        GLint viewport[4]{};
+        reader.ReadBytes(viewport, sizeof(viewport));
+        glViewport(viewport[0], viewport[1], viewport[2], viewport[3]);
+        break;
+    }
+
+    case CaptureCommand::State:
+    {
+        const auto flags = reader.Read<uint32_t>();
+        auto apply = [](GLenum capability, bool enabled) { enabled ? glEnable(capability) : glDisable(capability); };
+        apply(GL_DEPTH_TEST, flags & CaptureDepthTest);
+        apply(GL_CULL_FACE, flags & CaptureCullFace);
+        apply(GL_BLEND, flags & CaptureBlend);
+        break;
+    }
+
+    case CaptureCommand::Clear:
+    {
+        const auto mask = reader.Read<uint32_t>();
+        GLfloat color[4]{};
+        reader.ReadBytes(color, sizeof(color));
+        glClearColor(color[0], color[1], color[2], color[3]);
+        glClearDepth(reader.Read<GLfloat>());
+        glClear(mask);
+        break;
+    }
+
+    case CaptureCommand::CreateBuffer:
+    {
+        const auto id = reader.Read<uint32_t>();
+        const auto size = reader.Read<uint32_t>();
+        const uint8_t* data = reader.Skip(size);
+
+        // Se reutiliza el nombre para que los VAOs ya creados sigan apuntando a este búfer
+        GLuint& buffer = m_Objects[static_cast<size_t>(CaptureResource::Buffer)][id];
+        if (buffer == 0)
+            glGenBuffers(1, &buffer);
+        glBindBuffer(GL_COPY_WRITE_BUFFER, buffer);
+        glBufferData(GL_COPY_WRITE_BUFFER, size, data, GL_STATIC_DRAW);
+        glBindBuffer(GL_COPY_WRITE_BUFFER, 0);
+        break;
+    }
+
+    case CaptureCommand::CreateTexture:
+    {
+        const auto id = reader.Read<uint32_t>();
+        GLuint& texture = m_Objects[static_cast<size_t>(CaptureResource::Texture)][id];
+        if (texture == 0)
+            glGenTextures(1, &texture);
+        glBindTexture(GL_TEXTURE_2D, texture);
+
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, reader.Read<GLint>());
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, reader.Read<GLint>());
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, reader.Read<GLint>());
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, reader.Read<GLint>());
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_BASE_LEVEL, reader.Read<GLint>());
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAX_LEVEL, reader.Read<GLint>());
+
+        const auto levelCount = reader.Read<uint32_t>();
+        for (uint32_t i = 0; i < levelCount; i++)
+        {
+            const auto level = reader.Read<int32_t>();
+            const auto width = reader.Read<int32_t>();
+            const auto height = reader.Read<int32_t>();
+            const uint8_t* pixels = reader.Skip(static_cast<size_t>(width) * height * 4);
+            if (pixels)
+                glTexImage2D(GL_TEXTURE_2D, level, GL_RGBA8, width, height, 0, GL_RGBA, GL_UNSIGNED_BYTE, pixels);
+        }
+        break;
+    }
+
+    case CaptureCommand::CreateProgram:
+    {
+        const auto id = reader.Read<uint32_t>();
+        const std::string vertexCode = reader.ReadString();
+        const std::string fragmentCode = reader.ReadString();
+
+        GLuint& program = m_Objects[static_cast<size_t>(CaptureResource::Program)][id];
+        if (program != 0)
+        {
+            glDeleteProgram(program);
+            m_UniformLocations.erase(program);
+        }
+        program = Shader::Compile(vertexCode, fragmentCode);
+        if (program == 0)
+            LOG_ERROR("RenderReplay", "Failed to compile captured program {}", id);
+        break;
+    }
+
+    case CaptureCommand::CreateVertexArray:
+    {
+        const auto id = reader.Read<uint32_t>();
+        const auto elementBuffer = reader.Read<uint32_t>();
+        const auto attributeCount = reader.Read<uint32_t>();
+
+        // Un VAO no guarda datos, así que al recrearlo basta con uno nuevo
+        GLuint& vertexArray = m_Objects[static_cast<size_t>(CaptureResource::VertexArray)][id];
+        if (vertexArray != 0)
+            glDeleteVertexArrays(1, &vertexArray);
+        glGenVertexArrays(1, &vertexArray);
+        glBindVertexArray(vertexArray);
+
+        for (uint32_t i = 0; i < attributeCount; i++)
+        {
+            const auto index = reader.Read<uint32_t>();
+            const auto buffer = reader.Read<uint32_t>();
+            const auto type = reader.Read<uint32_t>();
+            const auto size = reader.Read<int32_t>();
+            const auto stride = reader.Read<int32_t>();
+            const auto normalized = reader.Read<uint32_t>();
+            const auto integer = reader.Read<uint32_t>();
+            const auto divisor = reader.Read<uint32_t>();
+            const auto* offset = reinterpret_cast<const void*>(static_cast<uintptr_t>(reader.Read<uint64_t>()));
+
+            glBindBuffer(GL_ARRAY_BUFFER, Find(CaptureResource::Buffer, buffer));
+            if (integer)
+                glVertexAttribIPointer(index, size, type, stride, offset);
+            else
+                glVertexAttribPointer(index, size, type, normalized ? GL_TRUE : GL_FALSE, stride, offset);
+            glEnableVertexAttribArray(index);
+            glVertexAttribDivisor(index, divisor);
+        }
+        glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, Find(CaptureResource::Buffer, elementBuffer));
+        glBindBuffer(GL_ARRAY_BUFFER, 0);
+        break;
+    }
+
+    case CaptureCommand::UseProgram:
+        m_Program = Find(CaptureResource::Program, reader.Read<uint32_t>());
+        glUseProgram(m_Program);
+        break;
+
+    case CaptureCommand::Uniform:
+    {
+        const std::string name = reader.ReadString();
+        const auto type = reader.Read<uint32_t>();
+        uint8_t value[64]{};
+        reader.ReadBytes(value, std::min<size_t>(reader.Remaining(), sizeof(value)));
+
+        const GLint location = GetUniformLocation(name);
+        const auto* floats = reinterpret_cast<const GLfloat*>(value);
+        const auto* ints = reinterpret_cast<const GLint*>(value);
+        switch (type)
+        {
+        case GL_FLOAT: glUniform1fv(location, 1, floats); break;
+        case GL_FLOAT_VEC2: glUniform2fv(location, 1, floats); break;
+        case GL_FLOAT_VEC3: glUniform3fv(location, 1, floats); break;
+        case GL_FLOAT_VEC4: glUniform4fv(location, 1, floats); break;
+        case GL_FLOAT_MAT2: glUniformMatrix2fv(location, 1, GL_FALSE, floats); break;
+        case GL_FLOAT_MAT3: glUniformMatrix3fv(location, 1, GL_FALSE, floats); break;
+        case GL_FLOAT_MAT4: glUniformMatrix4fv(location, 1, GL_FALSE, floats); break;
+        case GL_INT_VEC2:
+        case GL_BOOL_VEC2: glUniform2iv(location, 1, ints); break;
+        case GL_INT_VEC3:
+        case GL_BOOL_VEC3: glUniform3iv(location, 1, ints); break;
+        case GL_INT_VEC4:
+        case GL_BOOL_VEC4: glUniform4iv(location, 1, ints); break;
+        default: glUniform1iv(location, 1, ints); break;
+        }
+        break;
+    }
+
+    case CaptureCommand::BindVertexArray:
+        glBindVertexArray(Find(CaptureResource::VertexArray, reader.Read<uint32_t>()));
+        break;
+
+    case CaptureCommand::BindTexture:
+    {
+        const auto unit = reader.Read<uint32_t>();
+        const auto texture = reader.Read<uint32_t>();
+        glActiveTexture(GL_TEXTURE0 + unit);
+        glBindTexture(GL_TEXTURE_2D, Find(CaptureResource::Texture, texture));
+        break;
+    }
+
+    case CaptureCommand::DrawElements:
+    {
+        const auto mode = reader.Read<uint32_t>();
+        const auto count = reader.Read<int32_t>();
+        const auto type = reader.Read<uint32_t>();
+        const auto offset = static_cast<uintptr_t>(reader.Read<uint64_t>());
+        glDrawElements(mode, count, type, reinterpret_cast<const void*>(offset));
+        break;
+    }
+
+    case CaptureCommand::MultiDrawElements:
+    {
+        const auto mode = reader.Read<uint32_t>();
+        const auto type = reader.Read<uint32_t>();
+        const auto drawCount = reader.Read<int32_t>();
+        if (drawCount <= 0 || static_cast<size_t>(drawCount) * (sizeof(int32_t) + sizeof(uint64_t)) > reader.Remaining())
+            break;
+
+        std::vector<GLsizei> counts(static_cast<size_t>(drawCount));
+        std::vector<const void*> offsets(static_cast<size_t>(drawCount));
+        for (GLsizei& count : counts)
+            count = reader.Read<int32_t>();
+        for (const void*& offset : offsets)
+            offset = reinterpret_cast<const void*>(static_cast<uintptr_t>(reader.Read<uint64_t>()));
+        glMultiDrawElements(mode, counts.data(), type, offsets.data(), drawCount);
+        break;
+    }
+    }
+}
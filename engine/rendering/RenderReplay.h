@@ -0,0 +1,68 @@
+#pragma once
+
+// Reproduce capturas de RenderCapture sin escena, editor ni recursos en disco: crea los búferes,
+// texturas, programas y VAOs guardados y vuelve a emitir los comandos en un FrameBuffer propio
+// del tamaño capturado. Sirve para medir el mismo frame en otra máquina, otro driver u otra
+// versión del motor. Necesita un contexto de OpenGL actual (p. ej. el modo headless).
+
+#include "RenderCapture.h"
+#include "FrameBuffer.h"
+
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+class RenderReplay
+{
+public:
+    RenderReplay() = default;
+    ~RenderReplay();
+
+    RenderReplay(const RenderReplay&) = delete;
+    RenderReplay& operator=(const RenderReplay&) = delete;
+
+    bool Load(const std::string& path);
+
+    // Reproduce todos los frames 'passes' veces y devuelve el tiempo de cada frame en milisegundos
+    // (CPU + GPU, con glFinish). Tras la primera pasada (también entre llamadas) se omiten las
+    // subidas de recursos que no cambian durante la captura, así que solo se mide el trabajo del frame.
+    std::vector<double> Run(unsigned int passes = 1);
+    void Shutdown();
+
+    unsigned int GetFrameCount() const { return m_FrameCount; }
+    int GetWidth() const { return m_Width; }
+    int GetHeight() const { return m_Height; }
+    const std::string& GetVendor() const { return m_Vendor; }
+    const std::string& GetRenderer() const { return m_Renderer; }
+    // Destino de la reproducción, con el último frame emitido
+    FrameBuffer* GetFrameBuffer() const { return m_FBO.get(); }
+
+private:
+    struct Command
+    {
+        CaptureCommand Type{};
+        size_t Offset{};
+        uint32_t Size{};
+        // Creación de un recurso que no vuelve a cambiar en la captura
+        bool SkipOnRepeat{};
+    };
+
+    void Execute(const Command& command);
+    GLuint Find(CaptureResource resource, uint32_t id) const;
+    GLint GetUniformLocation(const std::string& name);
+
+    std::vector<uint8_t> m_Data;
+    std::vector<Command> m_Commands;
+    unsigned int m_FrameCount{};
+    int m_Width{}, m_Height{};
+    std::string m_Vendor;
+    std::string m_Renderer;
+
+    std::unique_ptr<FrameBuffer> m_FBO;
+    std::unordered_map<uint32_t, GLuint> m_Objects[static_cast<size_t>(CaptureResource::Count)];
+    std::unordered_map<GLuint, std::unordered_map<std::string, GLint>> m_UniformLocations;
+    GLuint m_Program{};
+    // Los recursos que no cambian ya están creados
+    bool m_Warm = false;
+};
@@ -0,0 +1,57 @@
+#include "RenderStats.h"
+
+RenderStats RenderCounters::s_Current;
+RenderStats RenderCounters::s_LastFrame;
+RenderBudget RenderCounters::s_Budget;
+
+std::array<RenderStats, RenderCounters::HistorySize> RenderCounters::s_History;
+size_t RenderCounters::s_HistoryCount = 0;
+uint64_t RenderCounters::s_Frame = 0;
+
+void RenderCounters::EndFrame()
+{
+    s_Current.Frame = s_Frame;
+    s_History[s_Frame % HistorySize] = s_Current;
+    if (s_HistoryCount < HistorySize)
+        s_HistoryCount++;
+
+    s_LastFrame = s_Current;
+    s_Current = RenderStats();
+    s_Frame++;
+}
+
+std::vector<RenderStats> RenderCounters::GetHistory()
+{
+    std::vector<RenderStats> history;
+    history.reserve(s_HistoryCount);
+    for (uint64_t frame = s_Frame - s_HistoryCount; frame < s_Frame; frame++)
+        history.push_back(s_History[frame % HistorySize]);
+    return history;
+}
+
+std::vector<std::string> RenderCounters::CheckBudget(const RenderStats& stats, const RenderBudget& budget)
+{
+    std::vector<std::string> violations;
+    auto check = [&violations](const char* name, uint64_t value, uint64_t limit)
+    {
+        if (limit > 0 && value > limit)
+            violations.push_back(std::string(name) + ": " + std::to_string(value) + " > " + std::to_string(limit));
+    };
+
+    uint64_t stateChanges = 0;
+    for (uint32_t binds : stats.Binds)
+        stateChanges += binds;
+
+    check("Draw calls", stats.DrawCalls, budget.MaxDrawCalls);
+    check("Triangles", stats.Triangles, budget.MaxTriangles);
+    check("State changes", stateChanges, budget.MaxStateChanges);
+    check("Upload bytes", stats.UniformBytes + stats.BufferUploadBytes + stats.TextureUploadBytes, budget.MaxUploadBytes);
+    check("FBO switches", stats.GetFrameBufferSwitches(), budget.MaxFrameBufferSwitches);
+    return violations;
+}
+
+const char* RenderCounters::GetBindName(RenderBind bind)
+{
+    static const char* names[static_cast<size_t>(RenderBind::Count)] = { "Shader", "Texture", "Vertex Array", "Buffer", "FrameBuffer" };
+    return names[static_cast<size_t>(bind)];
+}
@@ -0,0 +1,106 @@
+#pragma once
+
+// Contadores por frame del renderizador. Los envoltorios de OpenGL (Shader, Texture, VertexArray,
+// búferes, FrameBuffer, Mesh) los incrementan al emitir cada llamada; Renderer::Render cierra el
+// frame con EndFrame. Todo ocurre en el hilo de OpenGL, así que son enteros sin sincronizar.
+// Lo que se emite entre dos frames (p. ej. importar una malla desde la GUI) cuenta para el siguiente.
+
+#include <array>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+enum class RenderBind : uint8_t
+{
+    Shader,
+    Texture,
+    VertexArray,
+    Buffer,
+    FrameBuffer,
+    Count
+};
+
+struct RenderStats
+{
+    uint64_t Frame{};
+
+    uint32_t DrawCalls{};
+    uint32_t Instances{};
+    // Rangos enviados dentro de glMultiDrawElements (meshlets); cada llamada cuenta como un draw call
+    uint32_t MultiDrawRanges{};
+    uint64_t Triangles{};
+
+    std::array<uint32_t, static_cast<size_t>(RenderBind::Count)> Binds{};
+
+    uint32_t UniformUpdates{};
+    uint64_t UniformBytes{};
+    uint64_t BufferUploadBytes{};
+    uint64_t TextureUploadBytes{};
+
+    uint32_t GetBinds(RenderBind bind) const { return Binds[static_cast<size_t>(bind)]; }
+    // Cambios de render target
+    uint32_t GetFrameBufferSwitches() const { return GetBinds(RenderBind::FrameBuffer); }
+};
+
+// Límites por frame; 0 significa sin límite
+struct RenderBudget
+{
+    uint32_t MaxDrawCalls{};
+    uint64_t MaxTriangles{};
+    uint32_t MaxStateChanges{};
+    uint64_t MaxUploadBytes{};
+    uint32_t MaxFrameBufferSwitches{};
+};
+
+class RenderCounters
+{
+public:
+    static constexpr size_t HistorySize = 240;
+
+    static void Draw(uint64_t indexCount, uint32_t instances = 1)
+    {
+        s_Current.DrawCalls++;
+        s_Current.Instances += instances;
+        s_Current.Triangles += indexCount / 3 * instances;
+    }
+    static void MultiDraw(uint64_t indexCount, uint32_t ranges)
+    {
+        s_Current.DrawCalls++;
+        s_Current.Instances++;
+        s_Current.MultiDrawRanges += ranges;
+        s_Current.Triangles += indexCount / 3;
+    }
+    static void Bind(RenderBind bind) { s_Current.Binds[static_cast<size_t>(bind)]++; }
+    static void Uniform(uint64_t bytes)
+    {
+        s_Current.UniformUpdates++;
+        s_Current.UniformBytes += bytes;
+    }
+    static void BufferUpload(uint64_t bytes) { s_Current.BufferUploadBytes += bytes; }
+    static void TextureUpload(uint64_t bytes) { s_Current.TextureUploadBytes += bytes; }
+
+    // Guarda el frame en curso como último, lo añade al historial y empieza uno nuevo
+    static void EndFrame();
+
+    static const RenderStats& GetCurrent() { return s_Current; }
+    static const RenderStats& GetLastFrame() { return s_LastFrame; }
+    // Frames cerrados, del más antiguo al más reciente (como mucho HistorySize)
+    static std::vector<RenderStats> GetHistory();
+
+    // Comprueba 'stats' contra 'budget' y devuelve una línea por cada límite superado
+    static std::vector<std::string> CheckBudget(const RenderStats& stats, const RenderBudget& budget);
+
+    static void SetBudget(const RenderBudget& budget) { s_Budget = budget; }
+    static const RenderBudget& GetBudget() { return s_Budget; }
+
+    static const char* GetBindName(RenderBind bind);
+
+private:
+    static RenderStats s_Current;
+    static RenderStats s_LastFrame;
+    static RenderBudget s_Budget;
+
+    static std::array<RenderStats, HistorySize> s_History;
+    static size_t s_HistoryCount;
+    static uint64_t s_Frame;
+};
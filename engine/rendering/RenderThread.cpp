@@ -0,0 +1,184 @@
+#include "RenderThread.h"
+
+#include "Renderer.h"
+#include "Window.h"
+#include "Profiler.h"
+#include "GPUProfiler.h"
+#include "StartupTimer.h"
+#include "FramePacer.h"
+#include "TaskScheduler.h"
+
+std::thread RenderThread::s_Thread;
+std::thread::id RenderThread::s_ThreadId;
+Window* RenderThread::s_Window = nullptr;
+
+std::mutex RenderThread::s_Mutex;
+std::condition_variable RenderThread::s_WorkCondition;
+std::condition_variable RenderThread::s_DoneCondition;
+
+FramePacket RenderThread::s_Packets[2];
+unsigned int RenderThread::s_WriteIndex = 0;
+uint64_t RenderThread::s_FrameIndex = 0;
+bool RenderThread::s_PacketPending = false;
+bool RenderThread::s_Stopping = false;
+std::deque<RenderThread::Command*> RenderThread::s_Commands;
+
+void RenderThread::Start(Window* window)
+{
+    if (IsRunning() || !window || !window->GetNativeWindow())
+        return;
+
+    s_Window = window;
+    s_Stopping = false;
+    s_PacketPending = false;
+
+    // Un contexto solo puede estar activo en un hilo: se suelta aquí y lo toma el de render
+    glfwMakeContextCurrent(nullptr);
+    s_Thread = std::thread(Run, window);
+    s_ThreadId = s_Thread.get_id();
+}
+
+void RenderThread::Stop()
+{
+    if (!IsRunning())
+        return;
+
+    {
+        std::lock_guard<std::mutex> lock(s_Mutex);
+        s_Stopping = true;
+    }
+    s_WorkCondition.notify_one();
+    s_Thread.join();
+    s_ThreadId = std::thread::id();
+
+    glfwMakeContextCurrent(s_Window->GetNativeWindow());
+
+    // Las listas de dibujo de la GUI pertenecen al editor, que se apaga justo después
+    for (FramePacket& packet : s_Packets)
+    {
+        packet.Overlay.reset();
+        packet.Scene.Clear();
+    }
+    s_Window = nullptr;
+}
+
+bool RenderThread::IsRenderThread()
+{
+    return std::this_thread::get_id() == s_ThreadId;
+}
+
+void RenderThread::WaitIdle()
+{
+    if (!IsRunning())
+        return;
+
+    std::unique_lock<std::mutex> lock(s_Mutex);
+    s_DoneCondition.wait(lock, []() { return !s_PacketPending; });
+}
+
+void RenderThread::Submit()
+{
+    FramePacket& packet = s_Packets[s_WriteIndex];
+    packet.Index = s_FrameIndex++;
+
+    // Sin hilo se dibuja y presenta aquí mismo
+    if (!IsRunning())
+    {
+        RenderPacket(packet);
+        return;
+    }
+
+    WaitIdle();
+    {
+        std::lock_guard<std::mutex> lock(s_Mutex);
+        s_WriteIndex = 1 - s_WriteIndex;
+        s_PacketPending = true;
+    }
+    s_WorkCondition.notify_one();
+}
+
+void RenderThread::Invoke(const std::function<void()>& command)
+{
+    if (!IsRunning() || IsRenderThread())
+    {
+        command();
+        return;
+    }
+
+    Command pending{&command, false};
+    std::unique_lock<std::mutex> lock(s_Mutex);
+    s_Commands.push_back(&pending);
+    s_WorkCondition.notify_one();
+    s_DoneCondition.wait(lock, [&pending]() { return pending.Done; });
+}
+
+void RenderThread::Run(Window* window)
+{
+    glfwMakeContextCurrent(window->GetNativeWindow());
+    PROFILE_THREAD("Render");
+
+    std::unique_lock<std::mutex> lock(s_Mutex);
+    while (true)
+    {
+        s_WorkCondition.wait(lock, []() { return s_PacketPending || !s_Commands.empty() || s_Stopping; });
+
+        // El paquete va antes que los comandos: se construyó con los recursos que un comando
+        // posterior (p. ej. recrear el FBO al redimensionar) podría borrar
+        if (s_PacketPending)
+        {
+            FramePacket& packet = s_Packets[1 - s_WriteIndex];
+            lock.unlock();
+            RenderPacket(packet);
+            lock.lock();
+            s_PacketPending = false;
+            s_DoneCondition.notify_all();
+            continue;
+        }
+
+        if (!s_Commands.empty())
+        {
+            Command* command = s_Commands.front();
+            s_Commands.pop_front();
+            lock.unlock();
+            (*command->Function)();
+            lock.lock();
+            command->Done = true;
+            s_DoneCondition.notify_all();
+            continue;
+        }
+
+        if (s_Stopping)
+            break;
+    }
+    lock.unlock();
+
+    // Las cargas que esperaban al próximo frame siguen aquí, con el contexto, antes de devolverlo
+    TaskScheduler::ResumeRenderThreadTasks();
+
+    glfwMakeContextCurrent(nullptr);
+}
+
+void RenderThread::RenderPacket(FramePacket& packet)
+{
+    PROFILE_SCOPE("RenderThread::RenderPacket");
+
+    PROFILE_GPU_FRAME_BEGIN();
+    Renderer::Submit(packet.Scene);
+    if (packet.Overlay)
+        packet.Overlay->Render();
+    // Cierra las consultas de GPU del frame antes del swap; se leerán unos frames más tarde
+    PROFILE_GPU_FRAME_END();
+
+    if (GLFWwindow* window = s_Window ? s_Window->GetNativeWindow() : nullptr)
+    {
+        PROFILE_SCOPE("SwapBuffers");
+        // El intervalo de swap es estado del contexto: si cambió el modo de presentación se aplica aquí
+        FramePacer::ApplySwapInterval();
+        glfwSwapBuffers(window);
+    }
+    PROFILE_GPU_PRESENT(packet.InputTicks);
+    FramePacer::OnPresent();
+
+    // El primer frame ya está en pantalla: cierra el tiempo de arranque
+    StartupTimer::MarkFirstFrame();
+}
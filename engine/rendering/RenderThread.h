@@ -0,0 +1,70 @@
+#pragma once
+
+// Hilo dueño del contexto de OpenGL en el editor. El hilo principal simula, procesa la entrada y
+// construye la GUI del frame N+1 mientras este envía a la GPU el frame N, así que el trabajo de
+// la escena en CPU y el coste del driver se solapan en lugar de sumarse.
+//
+// Hay dos FramePacket: el principal escribe en GetWritePacket() y lo entrega con Submit(); el hilo
+// de render solo lee el otro. El estado que escribe el render (RenderCounters, GPUProfiler,
+// TextureStreamer, el FBO) solo se lee en el principal después de WaitIdle().
+// Cualquier otra llamada a OpenGL desde el principal (cargar una malla, redimensionar) pasa por Invoke().
+
+#include "FramePacket.h"
+
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <thread>
+
+class Window;
+
+class RenderThread
+{
+public:
+    // Mueve el contexto de la ventana al hilo de render; sin ventana (headless) no hace nada
+    static void Start(Window* window);
+    // Termina el frame en curso y devuelve el contexto al hilo que llamó a Start
+    static void Stop();
+
+    static bool IsRunning() { return s_Thread.joinable(); }
+    static bool IsRenderThread();
+
+    // Paquete que el hilo principal está llenando
+    static FramePacket& GetWritePacket() { return s_Packets[s_WriteIndex]; }
+    // Espera a que el hilo de render termine el paquete anterior
+    static void WaitIdle();
+    // Entrega el paquete de escritura y pasa a llenar el otro
+    static void Submit();
+
+    // Ejecuta 'command' con el contexto de OpenGL y espera a que termine. Sin hilo de render
+    // (headless, benchmarks) o desde el propio hilo se ejecuta directamente.
+    static void Invoke(const std::function<void()>& command);
+
+private:
+    struct Command
+    {
+        const std::function<void()>* Function;
+        bool Done;
+    };
+
+    static void Run(Window* window);
+    static void RenderPacket(FramePacket& packet);
+
+    static std::thread s_Thread;
+    static std::thread::id s_ThreadId;
+    static Window* s_Window;
+
+    static std::mutex s_Mutex;
+    // Despierta al hilo de render (paquete, comando o parada)
+    static std::condition_variable s_WorkCondition;
+    // Despierta al principal (paquete terminado o comando ejecutado)
+    static std::condition_variable s_DoneCondition;
+
+    static FramePacket s_Packets[2];
+    static unsigned int s_WriteIndex;
+    static uint64_t s_FrameIndex;
+    static bool s_PacketPending;
+    static bool s_Stopping;
+    static std::deque<Command*> s_Commands;
+};
@@ -1,186 +1,575 @@
 #include "Renderer.h"
-#include "Engine.h"
+#include "Engine.h" // Necesario para Engine::Get() y sus métodos
+#include "StartupTimer.h" // Fases del arranque (GLAD, shaders, búferes)
+#include "RenderThread.h" // Invoke para las llamadas a OpenGL desde el hilo principal
+#include "TaskScheduler.h" // Corrutinas de carga y su salto al hilo de render
+#include "Log.h" // Mensajes de error (LOG_ERROR)
 
+#include <algorithm>
+
+// Inicialización de los datos estáticos del renderizador
 RendererData Renderer::s_Data;
 
-float Renderer::s_DeltaTime = 0.0f;
-float Renderer::s_LastFrame = 0.0f;
+// Inicialización de variables estáticas para la interpolación de la cámara y el ratón
+glm::vec3 Renderer::s_PreviousCameraPosition{0.0f};
+
+// Invalidación del redibujo bajo demanda (hilo principal o de render)
+std::atomic<bool> Renderer::s_Invalidated{true};
 
-bool Renderer::s_FirstMouse = true;
-float Renderer::s_LastX;
-float Renderer::s_LastY;
+// Textura ya subida por LoadTextureAsync, a la espera de ApplyPendingResources
+std::atomic<Texture*> Renderer::s_PendingTexture{nullptr};
 
+// Constructor por defecto
 Renderer::Renderer() = default;
 
+// Destructor
 Renderer::~Renderer()
 {
+    // Asegura que los recursos se liberen al destruir el renderizador
     Shutdown();
 }
 
-void Renderer::Init()
+// Inicialización del subsistema de renderizado
+bool Renderer::Init()
 {
-    if (!gladLoadGLLoader(reinterpret_cast<GLADloadproc>(glfwGetProcAddress))) {
-        std::cerr << "Failed to initialize GLAD" << std::endl;
-        return;
+    MEMORY_TAG(Rendering);
+    Window* window = Engine::Get()->GetWindow();
+
+    // Carga las funciones de OpenGL usando GLAD, con el cargador de GLFW o de EGL (headless)
+    {
+        StartupScope phase("GLAD");
+        if (!gladLoadGLLoader(window->GetProcLoader())) {
+            LOG_ERROR("Renderer", "Failed to initialize GLAD");
+            return false; // Salir si GLAD no se inicializa
+        }
     }
 
+#ifdef FERX_PROFILING
+    // Las consultas de tiempo de GPU necesitan el contexto ya cargado
+    GPUProfiler::Init();
+#endif
+
+    // Configura las variables iniciales del renderizador
     SetVariables();
+    // Carga los shaders
     LoadShaders();
+    // Configura la malla inicial y el FrameBuffer
     SetupBuffers();
+    // Establece los callbacks de GLFW para eventos de ventana y entrada
     SetCallbacks();
+
+    // Sin superficie (headless) el viewport inicial es 0x0: se ajusta al tamaño del FBO
+    if (window->IsHeadless()) {
+        WindowSize size = window->GetSize();
+        glViewport(0, 0, size.Width, size.Height);
+    }
+    return true;
 }
 
+// Configura las variables de datos iniciales del renderizador
 void Renderer::SetVariables()
 {
-    s_Data.m_Scene = new Scene();
-    s_Data.m_Camera = new Camera(glm::vec3(0.0f, 0.0f, 3.0f));
-    s_Data.m_Cube = new Cube("Cube");
-    s_Data.m_ClearColor = new glm::vec3(0.0f, 0.1f, 0.2f);
+    MEMORY_TAG(Scene);
 
+    // Crea nuevas instancias de los componentes de la escena y la cámara
+    s_Data.m_Scene = new Scene();
+    s_Data.m_Camera = new Camera(glm::vec3(0.0f, 0.0f, 3.0f)); // Cámara en posición inicial
+    s_PreviousCameraPosition = s_Data.m_Camera->Position; // Sin paso anterior no hay nada que interpolar
+    s_Data.m_Cube = new Cube("Cube"); // Crea un objeto cubo
+    s_Data.m_ClearColor = new glm::vec3(0.0f, 0.1f, 0.2f); // Color de fondo inicial
+    // Copiar a m_LastScene conserva el recurso del destino: se fija una vez y no vuelve a cambiar
+    s_Data.m_LastScene.Reset(&s_Data.m_LastScenePool);
+
+    // Añade el cubo a la escena
     s_Data.m_Scene->AddCube(std::shared_ptr<Cube>(s_Data.m_Cube));
 }
 
+// Devuelve una referencia a la estructura de datos del renderizador
 RendererData& Renderer::GetData()
 {
     return s_Data;
 }
 
+// Carga los shaders desde archivos
 void Renderer::LoadShaders()
 {
+    StartupScope phase("Renderer shaders");
     s_Data.m_Shader = new Shader(ENGINE_RESOURCES_PATH"shaders/vertex.glsl", ENGINE_RESOURCES_PATH"shaders/fragment.glsl");
+
+    // Los cambios en los recursos se recargan sin reiniciar el editor
+    HotReload::Init(ENGINE_RESOURCES_PATH);
+    HotReload::Watch(s_Data.m_Shader);
 }
 
+// Configura la malla inicial (el cubo) a partir de sus datos estáticos
 void Renderer::SetupBuffers()
 {
-    s_Data.m_VAO = new VertexArray();
-    s_Data.m_VBO = new VertexBuffer();
-    s_Data.m_IBO = new IndexBuffer();
+    StartupScope phase("Renderer buffers");
+    // El cubo pasa por el mismo pipeline que las mallas importadas
+    MeshData cube = MeshImporter::FromPositionsAndColors(Cube::GetVertices(), Cube::GetIndices());
+    cube.Name = "Cube";
+    MeshOptimizer::Optimize(cube);
 
-    s_Data.m_VAO->Bind();
+    s_Data.m_Mesh = new Mesh(std::move(cube), s_Data.m_VertexFormat);
+
+    // Obtiene el tamaño actual de la ventana para adjuntar la textura al FBO
+    WindowSize windowSize = Engine::Get()->GetWindow()->GetSize();
+    SetupFrameBuffer(windowSize.Width, windowSize.Height);
+}
 
-    s_Data.m_VBO->SetData(sizeof(float) * Cube::GetVertices().size(), Cube::GetVertices().data());
-    s_Data.m_IBO->SetData(sizeof(unsigned int) * Cube::GetIndices().size(), Cube::GetIndices().data());
+// Configura el FrameBuffer donde se dibuja la escena
+void Renderer::SetupFrameBuffer(int width, int height)
+{
+    // Al redimensionar se sustituye el FBO entero; el anterior se libera con sus adjuntos
+    delete s_Data.m_FBO;
+    s_Data.m_FBO = new FrameBuffer();
+    s_Data.m_FBO->AttachTexture(width, height);
+    FrameBuffer::Unbind(); // Desvincula el FBO
 
-    glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, 6 * sizeof(float), nullptr);
-    glEnableVertexAttribArray(0);
+    // El FBO nuevo está vacío: hay que dibujar la escena aunque no haya cambiado
+    Invalidate();
+}
 
-    glVertexAttribPointer(1, 3, GL_FLOAT, GL_FALSE, 6 * sizeof(float), reinterpret_cast<void*>(3 * sizeof(float)));
-    glEnableVertexAttribArray(1);
+// Importa una malla (OBJ/glTF), la optimiza y sustituye a la actual
+bool Renderer::LoadMesh(const std::string& path)
+{
+    MEMORY_TAG(Mesh);
+    // La importación y la optimización no usan OpenGL: se hacen en el hilo que llama
+    MeshData data;
+    if (!MeshImporter::Load(path, data))
+        return false;
+
+    MeshOptimizer::Optimize(data);
+
+    // La subida a la GPU y el borrado de la malla anterior, con el contexto
+    RenderThread::Invoke([&data]() {
+        MEMORY_TAG(Mesh);
+        delete s_Data.m_Mesh;
+        s_Data.m_Mesh = new Mesh(std::move(data), s_Data.m_VertexFormat);
+        s_Data.m_ResourceGeneration++;
+    });
+    return true;
+}
 
-    VertexArray::Unbind();
-    VertexBuffer::Unbind();
-    IndexBuffer::Unbind();
+// Carga una textura con streaming de mips y la aplica a los objetos de la escena
+bool Renderer::LoadTexture(const std::string& path)
+{
+    MEMORY_TAG(Texture);
+    // Lectura, decodificación y mips no usan OpenGL: el hilo de render solo espera a la subida
+    TextureImage image;
+    if (!Texture::Decode(path, image))
+    {
+        LOG_ERROR("Renderer", "Failed to load texture: {}", path);
+        return false;
+    }
+    std::vector<TextureImage> mips = Texture::BuildMipChain(image);
 
-    s_Data.m_FBO = new FrameBuffer();
-    WindowSize windowSize = Engine::Get()->GetWindow()->GetSize();
-    s_Data.m_FBO->AttachTexture(windowSize.Width, windowSize.Height);
-    FrameBuffer::Unbind();
+    RenderThread::Invoke([&path, &mips]() {
+        MEMORY_TAG(Texture);
+        auto* texture = new Texture();
+        texture->GenerateStreaming(path, std::move(mips));
+        ReplaceTexture(texture);
+    });
+    return true;
 }
 
+Task<bool> Renderer::LoadTextureAsync(std::string path)
+{
+    // Hilo de E/S y después un hilo de trabajo: ni el principal ni el de render esperan al disco
+    const FileReadResult file = co_await TaskScheduler::ReadFile(path);
+    TextureImage image;
+    if (!file.Success || !Texture::Decode(file.GetBytes(), file.BytesRead, image))
+    {
+        LOG_ERROR("Renderer", "Failed to load texture: {}", path);
+        co_return false;
+    }
+    std::vector<TextureImage> mips = Texture::BuildMipChain(image);
+    image = {};
+
+    co_await TaskScheduler::SwitchToRenderThread();
+    MEMORY_TAG(Texture);
+    auto* texture = new Texture();
+    texture->GenerateStreaming(path, std::move(mips));
+
+    // El hilo principal puede estar en Update leyendo la textura actual: la sustitución se hace en
+    // ApplyPendingResources. Si otra carga terminó antes y aún no se aplicó, esta la reemplaza.
+    delete s_PendingTexture.exchange(texture);
+    co_return true;
+}
+
+// Hilo principal, con el de render parado (después de RenderThread::WaitIdle) o en el hilo único
+void Renderer::ApplyPendingResources()
+{
+    // Invoke espera a que termine: Update no vuelve a leer la textura hasta que está sustituida
+    if (Texture* texture = s_PendingTexture.exchange(nullptr))
+        RenderThread::Invoke([texture]() { ReplaceTexture(texture); });
+
+    // HotReload puede haber cambiado el tamaño de la textura en el último Submit
+    s_Data.m_TextureWidth = s_Data.m_Texture ? s_Data.m_Texture->GetWidth() : 0;
+}
+
+void Renderer::ReplaceTexture(Texture* texture)
+{
+    if (s_Data.m_Texture)
+    {
+        HotReload::Unwatch(s_Data.m_Texture);
+        TextureStreamer::Unregister(s_Data.m_Texture);
+        delete s_Data.m_Texture;
+    }
+
+    s_Data.m_Texture = texture;
+    s_Data.m_TextureWidth = texture->GetWidth();
+    TextureStreamer::Register(texture);
+    HotReload::Watch(texture);
+    s_Data.m_ResourceGeneration++;
+}
+
+// Cambia el formato de vértices y vuelve a subir la malla actual con él
+void Renderer::SetVertexFormat(MeshVertexFormat format)
+{
+    RenderThread::Invoke([format]() {
+        s_Data.m_VertexFormat = format;
+        s_Data.m_Mesh->SetVertexFormat(format);
+    });
+    Invalidate();
+}
+
+// Fuerza el dibujo de la escena en el próximo frame y despierta al editor si está esperando eventos.
+// Se puede llamar desde cualquier hilo.
+void Renderer::Invalidate()
+{
+    s_Invalidated = true;
+    if (Engine::Get() && Engine::Get()->GetWindow() && Engine::Get()->GetWindow()->GetNativeWindow())
+        glfwPostEmptyEvent();
+}
+
+// Establece los callbacks de GLFW para eventos de ventana y entrada
 void Renderer::SetCallbacks()
 {
+    // En modo headless no hay ventana ni eventos
+    if (!Engine::Get()->GetWindow()->GetNativeWindow())
+        return;
+
+    // Los callbacks llegan en el hilo principal (glfwPollEvents); lo que usa OpenGL pasa por
+    // RenderThread::Invoke, que espera al frame en curso del hilo de render
+
+    // Teclado, ratón y scroll van a la cola de Input. Se instalan aquí, antes de GUI::Init:
+    // el backend de ImGui para GLFW encadena los callbacks que ya existen
+    Input::Init(Engine::Get()->GetWindow()->GetNativeWindow());
+
+    // Callback para redimensionamiento de ventana: reconfigura el FrameBuffer
     glfwSetWindowSizeCallback(Engine::Get()->GetWindow()->GetNativeWindow(), [](GLFWwindow* window, int width, int height)
     {
-        SetupBuffers();
+        // La malla no depende del tamaño de la ventana, solo el FBO
+        RenderThread::Invoke([width, height]() { SetupFrameBuffer(width, height); });
     });
+    // Callback para redimensionamiento del framebuffer: ajusta el viewport de OpenGL
     glfwSetFramebufferSizeCallback(Engine::Get()->GetWindow()->GetNativeWindow(), [](GLFWwindow* window, int width, int height)
     {
-        glViewport(0, 0, width, height);
-    });
-    glfwSetScrollCallback(Engine::Get()->GetWindow()->GetNativeWindow(), [](GLFWwindow* window, double xOffset, double yOffset)
-    {
-        s_Data.m_Camera->ProcessMouseScroll(static_cast<float>(yOffset));
+        RenderThread::Invoke([width, height]() { glViewport(0, 0, width, height); }); // Ajusta el viewport de OpenGL
     });
 }
 
+// Función principal de renderizado: prepara y dibuja el frame en el mismo hilo (headless y benchmarks)
 void Renderer::Render() {
-    auto currentFrame = static_cast<float>(glfwGetTime());
-    s_DeltaTime = currentFrame - s_LastFrame;
-    s_LastFrame = currentFrame;
+    PROFILE_SCOPE("Renderer::Render");
+    ApplyPendingResources();
+    Update(s_Data.m_Packet, 1.0f);
+    Submit(s_Data.m_Packet);
+}
 
-    s_Data.m_FBO->Bind();
+// Un paso de simulación de duración fija: guarda el estado anterior para interpolar y mueve la cámara
+void Renderer::Simulate(float deltaTime)
+{
+    PROFILE_SCOPE("Renderer::Simulate");
 
-    glfwPollEvents();
-    ProcessInput(Engine::Get()->GetWindow()->GetNativeWindow());
+    s_PreviousCameraPosition = s_Data.m_Camera->Position;
+    for (const auto& cube : s_Data.m_Scene->GetCubes())
+        cube->SavePreviousTransform();
 
-    glEnable(GL_DEPTH_TEST);
+    // El movimiento con teclado depende del tiempo: avanza lo mismo a cualquier frecuencia de frames
+    if (Engine::Get()->GetWindow()->GetNativeWindow())
+        ProcessMovement(deltaTime);
+}
 
-    glClearColor(s_Data.m_ClearColor->x, s_Data.m_ClearColor->y, s_Data.m_ClearColor->z, 1.0f);
-    glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
+// Parte del frame en el hilo principal: entrada, cámara, selección de LOD y descarte de meshlets.
+// No llama a OpenGL; el resultado queda en 'packet' para Submit (en este hilo o en el de render).
+// 'alpha' interpola las transformaciones entre los dos últimos pasos de Simulate.
+void Renderer::Update(ScenePacket& packet, float alpha)
+{
+    PROFILE_SCOPE("Renderer::Update");
+    MEMORY_TAG(Rendering);
+
+    // Las listas del paquete van en la memoria del frame: construirlas no llama a malloc
+    packet.Reset(FrameAllocator::GetResource());
+    packet.Instances.reserve(s_Data.m_Scene->GetCubes().size());
+    packet.MipRequests.reserve(s_Data.m_Scene->GetCubes().size());
+    packet.ResourceGeneration = s_Data.m_ResourceGeneration;
 
-    s_Data.m_Shader->Use();
+    // ELIMINADO: glfwPollEvents(); // Esto debe ser llamado una sola vez en el bucle principal de la aplicación (Editor::Run())
+    // El ratón gira la cámara en cada frame, sin esperar al siguiente paso fijo (no hay en modo headless)
+    if (GLFWwindow* window = Engine::Get()->GetWindow()->GetNativeWindow())
+        ProcessInput(window);
 
-    s_Data.m_Cube->Draw();
+    packet.ClearColor = *s_Data.m_ClearColor;
 
-    const glm::mat4& model = *s_Data.m_Cube->GetModelMatrix();
-    const glm::mat4& view = s_Data.m_Camera->GetViewMatrix();
+    // Cámara con la posición interpolada entre pasos; la orientación es la del último frame
+    Camera camera = *s_Data.m_Camera;
+    camera.Position = glm::mix(s_PreviousCameraPosition, camera.Position, alpha);
 
+    // Obtiene las matrices de vista y proyección, comunes a todos los objetos
+    packet.View = camera.GetViewMatrix();
+
+    // Calcula la matriz de proyección (perspectiva)
     WindowSize size = Engine::Get()->GetWindow()->GetSize();
-    glm::mat4 projection = glm::perspective(glm::radians(45.0f), static_cast<float>(size.Width) / static_cast<float>(size.Height), 0.1f, 100.0f);
+    packet.Projection = camera.GetProjectionMatrix(static_cast<float>(size.Width) / static_cast<float>(size.Height));
+
+    // Píxeles por unidad a distancia 1: convierte el error geométrico de cada LOD en píxeles
+    const float pixelsPerUnit = camera.GetPixelsPerUnit(static_cast<float>(size.Height));
+    const MeshData& meshData = s_Data.m_Mesh->GetData();
+    const glm::mat4 viewProjection = packet.Projection * packet.View;
 
-    glUniformMatrix4fv(s_Data.m_Shader->GetUniformLocation("model"), 1, GL_FALSE, glm::value_ptr(model));
-    glUniformMatrix4fv(s_Data.m_Shader->GetUniformLocation("view"), 1, GL_FALSE, glm::value_ptr(view));
-    glUniformMatrix4fv(s_Data.m_Shader->GetUniformLocation("projection"), 1, GL_FALSE, glm::value_ptr(projection));
-    glUniform3fv(s_Data.m_Shader->GetUniformLocation("color"), 1, glm::value_ptr(*s_Data.m_Cube->GetShaderColor()));
+    s_Data.m_MeshletStats = MeshletCullStats();
 
-    *s_Data.m_Cube->GetModelMatrix() = glm::mat4(1.0f);
+    // La textura es del hilo de render (recargas, streaming): aquí solo se usa su ancho ya copiado
+    const float textureWidth = static_cast<float>(s_Data.m_TextureWidth);
+
+    for (const auto& cube : s_Data.m_Scene->GetCubes())
+    {
+        PROFILE_SCOPE("Update Object");
 
-    s_Data.m_VAO->Bind();
+        cube->Draw(alpha); // Calcula la matriz de modelo a partir de posición, rotación y escala
 
-    glDrawElements(GL_TRIANGLES, 36, GL_UNSIGNED_INT, nullptr);
+        SceneInstance& instance = packet.Instances.emplace_back();
+        instance.Model = *cube->GetModelMatrix();
+        instance.Color = *cube->GetShaderColor();
 
-    glBindFramebuffer(GL_FRAMEBUFFER, 0);
+        // Selección de LOD por error proyectado en pantalla, con histéresis por objeto
+        const glm::vec3 scale = glm::abs(*cube->GetScale());
+        const float maxScale = std::max(scale.x, std::max(scale.y, scale.z));
+        const glm::vec3 center = glm::vec3(instance.Model * glm::vec4(meshData.BoundsCenter, 1.0f));
+        const float distance = std::max(glm::distance(camera.Position, center) - meshData.BoundsRadius * maxScale, camera.NearPlane);
+
+        instance.LOD = s_Data.m_Mesh->SelectLOD(pixelsPerUnit * maxScale / distance, cube->GetLOD(), s_Data.m_LODThreshold, s_Data.m_LODHysteresis);
+        cube->SetLOD(instance.LOD);
+
+        // Texels del mip 0 por píxel: tamaño de la textura por densidad de UV frente a píxeles por unidad
+        if (textureWidth > 0.0f)
+            packet.MipRequests.push_back(textureWidth * meshData.UVDensity * distance / (pixelsPerUnit * maxScale));
+
+        // En el LOD 0 solo se envían los meshlets dentro del frustum y no orientados de espaldas
+        if (instance.LOD == 0 && s_Data.m_MeshletCulling && s_Data.m_Mesh->GetMeshlets().size() > 1)
+        {
+            MeshletCuller::Cull(s_Data.m_Mesh->GetMeshlets(), instance.Model, viewProjection, camera.Position, s_Data.m_MeshletDrawList);
+            s_Data.m_MeshletStats += s_Data.m_MeshletDrawList.Stats;
+
+            instance.Meshlets = true;
+            instance.FirstMeshletRange = static_cast<uint32_t>(packet.MeshletCounts.size());
+            instance.MeshletRangeCount = static_cast<uint32_t>(s_Data.m_MeshletDrawList.Counts.size());
+            packet.MeshletCounts.insert(packet.MeshletCounts.end(), s_Data.m_MeshletDrawList.Counts.begin(), s_Data.m_MeshletDrawList.Counts.end());
+            packet.MeshletOffsets.insert(packet.MeshletOffsets.end(), s_Data.m_MeshletDrawList.Offsets.begin(), s_Data.m_MeshletDrawList.Offsets.end());
+        }
+
+        // Restablece la matriz del modelo del cubo para el siguiente frame
+        *cube->GetModelMatrix() = glm::mat4(1.0f);
+    }
 
-    glfwSwapBuffers(Engine::Get()->GetWindow()->GetNativeWindow());
+    // Redibujo bajo demanda: la escena solo se vuelve a dibujar si el paquete cambia (cámara, objetos,
+    // propiedades, recursos) o si algo lo ha invalidado (recargas, mips nuevos, un FBO nuevo)
+    packet.Dirty = !s_Data.m_OnDemand || s_Invalidated.exchange(false) || !packet.DrawsSameAs(s_Data.m_LastScene);
+    if (packet.Dirty && s_Data.m_OnDemand)
+        s_Data.m_LastScene = packet;
 }
 
-void Renderer::ProcessInput(GLFWwindow *window)
+// Parte del frame con el contexto de OpenGL: dibuja un paquete ya preparado en el FrameBuffer
+void Renderer::Submit(const ScenePacket& packet)
 {
-    if(Input::IsMouseButtonPressed(ButtonRight))
+    PROFILE_SCOPE("Renderer::Submit");
+    MEMORY_TAG(Rendering);
+
+    // Continúa las cargas que esperaban al hilo de render (TaskScheduler::SwitchToRenderThread)
+    TaskScheduler::ResumeRenderThreadTasks();
+
+    // Aplica los shaders y texturas modificados antes de empezar el frame
+    const bool reloaded = HotReload::Update();
+
+    // Sin cambios se conserva la imagen del FrameBuffer. Tampoco se cierran los contadores, así que
+    // el panel Render Stats sigue mostrando el último frame dibujado. Una captura en curso sí dibuja.
+    if (!packet.Dirty && !reloaded && !RenderCapture::IsActive())
+    {
+        s_Data.m_SkippedFrames++;
+        return;
+    }
+
+    PROFILE_GPU_SCOPE("Scene");
+
+    // Vincula el FrameBuffer para que todo el dibujo se realice en él
+    s_Data.m_FBO->Bind();
+    RenderCapture::BeginFrame();
+
+    glEnable(GL_DEPTH_TEST); // Habilita la prueba de profundidad para objetos 3D
+
+    // Establece el color de fondo y limpia los búferes de color y profundidad
+    glClearColor(packet.ClearColor.x, packet.ClearColor.y, packet.ClearColor.z, 1.0f);
+    glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
+    RenderCapture::OnClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
+
+    s_Data.m_Shader->Use(); // Activa el shader para el dibujo
+
+    s_Data.m_Shader->SetMat4("view", packet.View);
+    s_Data.m_Shader->SetMat4("projection", packet.Projection);
+
+    // Deshacen la cuantización de posiciones y UV del formato Compressed (identidad en Float)
+    const glm::mat4 positionTransform = s_Data.m_Mesh->GetPositionTransform();
+    s_Data.m_Shader->SetVec4("texCoordTransform", s_Data.m_Mesh->GetTexCoordTransform());
+
+    // Si la malla o la textura cambiaron después de preparar el paquete, sus rangos de meshlets y
+    // sus peticiones de mips son de los recursos anteriores: se dibuja por LOD y no se piden mips
+    const bool current = packet.ResourceGeneration == s_Data.m_ResourceGeneration;
+
+    Texture* texture = s_Data.m_Texture;
+    s_Data.m_Shader->SetInt("useTexture", texture != nullptr);
+    if (texture)
     {
-        auto mousePos = Input::GetMousePosition();
+        glActiveTexture(GL_TEXTURE0);
+        texture->Bind();
+        s_Data.m_Shader->SetInt("diffuseTexture", 0);
+    }
+
+    // Dibuja cada objeto de la escena con la malla activa (el cubo o la última importada)
+    for (const SceneInstance& instance : packet.Instances)
+    {
+        PROFILE_SCOPE("Draw Object");
+
+        // Pasa la matriz de modelo y el color al shader como uniformes
+        s_Data.m_Shader->SetMat4("model", instance.Model * positionTransform);
+        s_Data.m_Shader->SetVec3("color", instance.Color);
 
-        if(s_FirstMouse)
+        if (instance.Meshlets && current)
         {
-            s_LastX = mousePos.x;
-            s_LastY = mousePos.y;
-            s_FirstMouse = false;
+            s_Data.m_Mesh->DrawMeshlets(packet.MeshletCounts.data() + instance.FirstMeshletRange,
+                                        packet.MeshletOffsets.data() + instance.FirstMeshletRange,
+                                        static_cast<GLsizei>(instance.MeshletRangeCount));
         }
+        else
+        {
+            // Mesh::Draw limita el LOD a los de la malla actual
+            s_Data.m_Mesh->Draw(instance.LOD);
+        }
+    }
 
-        float xOffset = mousePos.x - s_LastX;
-        float yOffset = s_LastY - mousePos.y;
+    // Sube o expulsa mips según lo que se ha visto en este frame
+    if (texture && current)
+    {
+        for (const float texelsPerPixel : packet.MipRequests)
+            TextureStreamer::RequestMip(texture, texelsPerPixel);
+    }
+    const unsigned int streamedIn = TextureStreamer::GetStats().StreamedIn;
+    TextureStreamer::Update();
+    // Los mips recién subidos necesitan otro frame para verse (y puede quedar alguno por subir), y los
+    // que se releen del archivo se suben en cuanto llegan; los que esperan a que haya presupuesto no,
+    // o la escena no dejaría nunca de dibujarse
+    if (TextureStreamer::GetStats().StreamedIn != streamedIn || TextureStreamer::GetStats().ReloadingTextures > 0)
+        Invalidate();
+
+    // Desvincula el FrameBuffer y vuelve al framebuffer por defecto (la pantalla)
+    FrameBuffer::Unbind();
 
-        s_LastX = mousePos.x;
-        s_LastY = mousePos.y;
+    // Cierra los contadores de draw calls, binds y subidas de este frame (panel Render Stats y benchmarks)
+    RenderCounters::EndFrame();
+    RenderCapture::EndFrame();
 
-        s_Data.m_Camera->ProcessMouseMovement(xOffset, yOffset);
+    // ELIMINADO: glfwSwapBuffers(Engine::Get()->GetWindow()->GetNativeWindow()); // Esto debe ser llamado una sola vez en el bucle principal de la aplicación (Editor::Run())
+}
 
-        glfwSetInputMode(window, GLFW_CURSOR, GLFW_CURSOR_DISABLED);
-    }
-    else
+// Procesa la entrada del ratón (del InputState del frame) para orientar la cámara y hacer zoom
+void Renderer::ProcessInput(GLFWwindow *window)
+{
+    if(Input::IsActionDown(InputAction::Look)) // Si se mantiene el botón de mirar (derecho por defecto)
     {
-        glfwSetInputMode(window, GLFW_CURSOR, GLFW_CURSOR_NORMAL);
+        // El movimiento del frame en que se pulsa no cuenta: el cursor venía de cualquier sitio
+        if(!Input::WasActionPressed(InputAction::Look))
+        {
+            // Desplazamiento acumulado del ratón en el frame; Y invertida porque la pantalla crece hacia abajo
+            const glm::vec2 delta = Input::GetMouseDelta();
+            if(delta.x != 0.0f || delta.y != 0.0f)
+                s_Data.m_Camera->ProcessMouseMovement(delta.x, -delta.y);
+        }
     }
 
-    if (Input::IsKeyPressed(W))
-        s_Data.m_Camera->ProcessKeyboard(FORWARD, s_DeltaTime);
-    if (Input::IsKeyPressed(S))
-        s_Data.m_Camera->ProcessKeyboard(BACKWARD, s_DeltaTime);
-    if (Input::IsKeyPressed(A))
-        s_Data.m_Camera->ProcessKeyboard(LEFT, s_DeltaTime);
-    if (Input::IsKeyPressed(D))
-        s_Data.m_Camera->ProcessKeyboard(RIGHT, s_DeltaTime);
-    if (Input::IsKeyPressed(Q))
-        s_Data.m_Camera->ProcessKeyboard(DOWN, s_DeltaTime);
-    if (Input::IsKeyPressed(E))
-        s_Data.m_Camera->ProcessKeyboard(UP, s_DeltaTime);
+    // El modo del cursor solo cambia en los flancos: deshabilitado mientras se mira (cámara en
+    // primera persona) y normal al soltar
+    if(Input::WasActionPressed(InputAction::Look) && Input::IsActionDown(InputAction::Look))
+        glfwSetInputMode(window, GLFW_CURSOR, GLFW_CURSOR_DISABLED);
+    else if(Input::WasActionReleased(InputAction::Look))
+        glfwSetInputMode(window, GLFW_CURSOR, GLFW_CURSOR_NORMAL);
+
+    // Zoom de la cámara con el scroll del frame
+    const float scroll = Input::GetScroll().y;
+    if(scroll != 0.0f)
+        s_Data.m_Camera->ProcessMouseScroll(scroll);
+}
+
+// Mueve la cámara con el teclado durante un paso de simulación. Una pulsación más corta que un
+// frame también mueve (flanco de pulsación sin tecla mantenida).
+void Renderer::ProcessMovement(float deltaTime)
+{
+    const auto active = [](InputAction action)
+    {
+        return Input::IsActionDown(action) || Input::WasActionPressed(action);
+    };
+
+    if (active(InputAction::MoveForward))
+        s_Data.m_Camera->ProcessKeyboard(FORWARD, deltaTime);
+    if (active(InputAction::MoveBackward))
+        s_Data.m_Camera->ProcessKeyboard(BACKWARD, deltaTime);
+    if (active(InputAction::MoveLeft))
+        s_Data.m_Camera->ProcessKeyboard(LEFT, deltaTime);
+    if (active(InputAction::MoveRight))
+        s_Data.m_Camera->ProcessKeyboard(RIGHT, deltaTime);
+    if (active(InputAction::MoveDown))
+        s_Data.m_Camera->ProcessKeyboard(DOWN, deltaTime);
+    if (active(InputAction::MoveUp))
+        s_Data.m_Camera->ProcessKeyboard(UP, deltaTime);
 }
 
+// Apagado y liberación de recursos del renderizador
 void Renderer::Shutdown()
 {
-    s_Data.m_VAO->Shutdown();
-    s_Data.m_VBO->Shutdown();
-    s_Data.m_FBO->Shutdown();
-    s_Data.m_IBO->Shutdown();
-    s_Data.m_Shader->Shutdown();
+    // Detiene el hilo de recarga antes de liberar los recursos que vigila
+    HotReload::Shutdown();
+    // Las cargas que esperaban un frame más terminan ahora, con los recursos aún vivos. Las que
+    // vuelvan a pedir el hilo de render, o lleguen desde un hilo de trabajo después, se cancelan.
+    TaskScheduler::ResumeRenderThreadTasks();
+    TaskScheduler::CancelRenderThreadTasks();
+
+#ifdef FERX_PROFILING
+    GPUProfiler::Shutdown();
+#endif
+
+    // Libera los búferes y shaders (sus destructores borran los objetos de OpenGL)
+    delete s_Data.m_FBO;
+    s_Data.m_FBO = nullptr;
+    delete s_Data.m_Shader;
+    s_Data.m_Shader = nullptr;
+
+    // ¡IMPORTANTE! Liberar la memoria asignada con 'new' para los punteros en RendererData
+    // Esto es crucial para evitar fugas de memoria.
+    delete s_Data.m_Scene;
+    s_Data.m_Scene = nullptr;
+    delete s_Data.m_Camera;
+    s_Data.m_Camera = nullptr;
+    // m_Cube pertenece a la escena (shared_ptr), no se libera aquí
+    s_Data.m_Cube = nullptr;
+    delete s_Data.m_Mesh;
+    s_Data.m_Mesh = nullptr;
+    if (s_Data.m_Texture)
+        TextureStreamer::Unregister(s_Data.m_Texture);
+    delete s_Data.m_Texture;
+    s_Data.m_Texture = nullptr;
+    s_Data.m_TextureWidth = 0;
+    // Una carga terminada que ya no llegó a aplicarse
+    delete s_PendingTexture.exchange(nullptr);
+    delete s_Data.m_ClearColor;
+    s_Data.m_ClearColor = nullptr;
 }
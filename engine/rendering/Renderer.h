@@ -2,6 +2,7 @@
 
 #define GLFW_INCLUDE_NONE
 #include <GLFW/glfw3.h>
+#include <atomic>
 #include <iostream>
 #include "VertexArray.h"
 #include "VertexBuffer.h"
@@ -12,21 +13,64 @@
 #include "Scene.h"
 #include "Shader.h"
 #include "Texture.h"
+#include "HotReload.h"
+#include "TextureStreamer.h"
 #include "Camera.h"
 #include "Cube.h"
+#include "Profiler.h"
+#include "GPUProfiler.h"
+#include "MemoryTracker.h"
+#include "RenderStats.h"
+#include "RenderCapture.h"
+#include "Mesh.h"
+#include "MeshImporter.h"
+#include "MeshOptimizer.h"
+#include "FramePacket.h"
+#include "Task.h"
 
 struct RendererData
 {
-    VertexArray* m_VAO;
-    VertexBuffer* m_VBO;
-    IndexBuffer* m_IBO;
-    FrameBuffer* m_FBO;
+    Mesh* m_Mesh;
+    // Textura difusa aplicada a todos los objetos, cargada en streaming de mips
+    Texture* m_Texture = nullptr;
+    // Ancho de m_Texture para las peticiones de mips de Update. Lo escribe el hilo principal (o el de
+    // render con el principal esperando en Invoke): una recarga en el hilo de render cambia el de la
+    // textura mientras Update corre, y este solo se actualiza en ApplyPendingResources.
+    int m_TextureWidth = 0;
+    FrameBuffer* m_FBO = nullptr;
     Scene* m_Scene;
     Shader* m_Shader;
     Camera* m_Camera;
     Cube* m_Cube;
 
     glm::vec3* m_ClearColor;
+
+    // Error máximo tolerado en pantalla (píxeles) y margen de histéresis para elegir LOD
+    float m_LODThreshold = 1.0f;
+    float m_LODHysteresis = 0.25f;
+
+    // Formato de vértices con el que se suben las mallas nuevas
+    MeshVertexFormat m_VertexFormat = MeshVertexFormat::Compressed;
+
+    // Descarte por meshlets cuando se dibuja el LOD 0; la lista se reutiliza entre objetos
+    bool m_MeshletCulling = true;
+    MeshletDrawList m_MeshletDrawList;
+    MeshletCullStats m_MeshletStats;
+
+    // Sube cada vez que se sustituye la malla o la textura (ScenePacket::ResourceGeneration)
+    uint64_t m_ResourceGeneration = 0;
+    // Paquete de Render(), cuando Update y Submit van en el mismo hilo
+    ScenePacket m_Packet;
+
+    // Redibujo bajo demanda (editor): se salta el pase de escena si el paquete no cambia.
+    // Desactivado por defecto para que el modo headless y los benchmarks dibujen siempre.
+    bool m_OnDemand = false;
+    // Último paquete dibujado, para comparar. Sus listas van en un pool propio (SetVariables): la copia
+    // de cada frame reutiliza su capacidad y solo pide memoria al heap si la escena crece.
+    std::pmr::unsynchronized_pool_resource m_LastScenePool;
+    ScenePacket m_LastScene;
+    // Frames en los que el hilo de render se saltó el pase de escena
+    uint64_t m_SkippedFrames = 0;
 };
 
 class Renderer
@@ -35,25 +79,49 @@ public:
     Renderer();
     ~Renderer();
 
-    static void Init();
+    static bool Init();
+    // Update + Submit en el hilo actual (headless y benchmarks)
     static void Render();
+    // Un paso de simulación de 'deltaTime' segundos (FixedTimestep)
+    static void Simulate(float deltaTime);
+    // Hilo principal: entrada, cámara, LOD y meshlets. No usa OpenGL.
+    // 'alpha' en [0, 1] interpola entre el estado del paso anterior y el actual
+    static void Update(ScenePacket& packet, float alpha);
+    // Hilo con el contexto de OpenGL: dibuja el paquete en el FrameBuffer
+    static void Submit(const ScenePacket& packet);
     static void Shutdown();
 
     static RendererData& GetData();
 
+    static bool LoadMesh(const std::string& path);
+    static bool LoadTexture(const std::string& path);
+    // Misma carga sin bloquear: lectura con AsyncIO, decodificación en un hilo de trabajo y subida en
+    // el hilo de render al empezar el siguiente frame. 'path' va por valor: la tarea lo usa al reanudarse.
+    // La textura nueva no sustituye a la actual hasta el siguiente ApplyPendingResources.
+    static Task<bool> LoadTextureAsync(std::string path);
+    // Aplica lo que las cargas asíncronas y las recargas dejaron listo. Hilo principal, sin que Update
+    // ni Submit estén en curso: después de RenderThread::WaitIdle en el editor, antes de Update en el hilo único.
+    static void ApplyPendingResources();
+    static void SetVertexFormat(MeshVertexFormat format);
+    // Obliga a dibujar la escena en el próximo frame (redibujo bajo demanda)
+    static void Invalidate();
+
 private:
     static RendererData s_Data;
 
     static void SetVariables();
     static void LoadShaders();
     static void SetupBuffers();
+    static void SetupFrameBuffer(int width, int height);
     static void SetCallbacks();
+    // Sustituye la textura de la escena por una ya subida (hilo de OpenGL)
+    static void ReplaceTexture(Texture* texture);
     static void ProcessInput(GLFWwindow* window);
+    static void ProcessMovement(float deltaTime);
 
-    static float s_DeltaTime;
-    static float s_LastFrame;
+    // Posición de la cámara al empezar el último paso de simulación
+    static glm::vec3 s_PreviousCameraPosition;
 
-    static bool s_FirstMouse;
-    static float s_LastX;
-    static float s_LastY;
+    static std::atomic<bool> s_Invalidated;
+    static std::atomic<Texture*> s_PendingTexture;
 };
\ No newline at end of file
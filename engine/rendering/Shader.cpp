@@ -1,243 +1,174 @@
-#include "Renderer.h"
-#include "Engine.h" // Necesario para Engine::Get() y sus métodos
+#include "Shader.h"
+#include "RenderStats.h"
+#include "RenderCapture.h"
+#include "AsyncIO.h"
+#include "Log.h"
 
-// Inicialización de los datos estáticos del renderizador
-RendererData Renderer::s_Data;
-
-// Inicialización de variables estáticas para el control del tiempo y el ratón
-float Renderer::s_DeltaTime = 0.0f;
-float Renderer::s_LastFrame = 0.0f;
-
-bool Renderer::s_FirstMouse = true;
-float Renderer::s_LastX;
-float Renderer::s_LastY;
+Shader::Shader(const std::string& vPath, const std::string& fPath) : m_VertexPath(vPath), m_FragmentPath(fPath)
+{
+    std::string vertexCode, fragmentCode;
+    ReadSources(vPath, fPath, vertexCode, fragmentCode);
 
-// Constructor por defecto
-Renderer::Renderer() = default;
+    m_ID = Compile(vertexCode, fragmentCode);
+}
 
-// Destructor
-Renderer::~Renderer()
+Shader::~Shader()
 {
-    // Asegura que los recursos se liberen al destruir el renderizador
     Shutdown();
 }
 
-// Inicialización del subsistema de renderizado
-void Renderer::Init()
+Shader Shader::Create(const std::string& vPath, const std::string& fPath)
 {
-    // Carga las funciones de OpenGL usando GLAD
-    if (!gladLoadGLLoader(reinterpret_cast<GLADloadproc>(glfwGetProcAddress))) {
-        std::cerr << "Failed to initialize GLAD" << std::endl;
-        return; // Salir si GLAD no se inicializa
-    }
-
-    // Configura las variables iniciales del renderizador
-    SetVariables();
-    // Carga los shaders
-    LoadShaders();
-    // Configura los búferes de vértices e índices
-    SetupBuffers();
-    // Establece los callbacks de GLFW para eventos de ventana y entrada
-    SetCallbacks();
+    return Shader{vPath, fPath};
 }
 
-// Configura las variables de datos iniciales del renderizador
-void Renderer::SetVariables()
+void Shader::Use() const
 {
-    // Crea nuevas instancias de los componentes de la escena y la cámara
-    s_Data.m_Scene = new Scene();
-    s_Data.m_Camera = new Camera(glm::vec3(0.0f, 0.0f, 3.0f)); // Cámara en posición inicial
-    s_Data.m_Cube = new Cube("Cube"); // Crea un objeto cubo
-    s_Data.m_ClearColor = new glm::vec3(0.0f, 0.1f, 0.2f); // Color de fondo inicial
-
-    // Añade el cubo a la escena
-    s_Data.m_Scene->AddCube(std::shared_ptr<Cube>(s_Data.m_Cube));
+    glUseProgram(m_ID);
+    RenderCounters::Bind(RenderBind::Shader);
 }
 
-// Devuelve una referencia a la estructura de datos del renderizador
-RendererData& Renderer::GetData()
+void Shader::Shutdown() const
 {
-    return s_Data;
+    RenderCapture::Invalidate(CaptureResource::Program, m_ID);
+    glDeleteProgram(m_ID);
 }
 
-// Carga los shaders desde archivos
-void Renderer::LoadShaders()
+int Shader::GetUniformLocation(const std::string& name)
 {
-    s_Data.m_Shader = new Shader(ENGINE_RESOURCES_PATH"shaders/vertex.glsl", ENGINE_RESOURCES_PATH"shaders/fragment.glsl");
+    const auto it = m_Uniforms.find(name);
+    if (it != m_Uniforms.end())
+        return it->second;
+
+    const int location = glGetUniformLocation(m_ID, name.c_str());
+    m_Uniforms[name] = location;
+    return location;
 }
 
-// Configura los búferes de vértices, índices y el FrameBuffer
-void Renderer::SetupBuffers()
+void Shader::SetInt(const std::string& name, int value)
 {
-    // Crea instancias de VertexArray, VertexBuffer e IndexBuffer
-    s_Data.m_VAO = new VertexArray();
-    s_Data.m_VBO = new VertexBuffer();
-    s_Data.m_IBO = new IndexBuffer();
-
-    s_Data.m_VAO->Bind(); // Vincula el VAO
-
-    // Establece los datos de vértices e índices para el cubo
-    s_Data.m_VBO->SetData(sizeof(float) * Cube::GetVertices().size(), Cube::GetVertices().data());
-    s_Data.m_IBO->SetData(sizeof(unsigned int) * Cube::GetIndices().size(), Cube::GetIndices().data());
-
-    // Configura los atributos de los vértices (posiciones y colores)
-    glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, 6 * sizeof(float), nullptr);
-    glEnableVertexAttribArray(0);
-
-    glVertexAttribPointer(1, 3, GL_FLOAT, GL_FALSE, 6 * sizeof(float), reinterpret_cast<void*>(3 * sizeof(float)));
-    glEnableVertexAttribArray(1);
-
-    // Desvincula los búferes después de la configuración
-    VertexArray::Unbind();
-    VertexBuffer::Unbind();
-    IndexBuffer::Unbind();
-
-    // Configura el FrameBuffer
-    s_Data.m_FBO = new FrameBuffer();
-    // Obtiene el tamaño actual de la ventana para adjuntar la textura al FBO
-    WindowSize windowSize = Engine::Get()->GetWindow()->GetSize();
-    s_Data.m_FBO->AttachTexture(windowSize.Width, windowSize.Height);
-    FrameBuffer::Unbind(); // Desvincula el FBO
+    glUniform1i(GetUniformLocation(name), value);
+    RenderCounters::Uniform(sizeof(value));
 }
 
-// Establece los callbacks de GLFW para eventos de ventana y entrada
-void Renderer::SetCallbacks()
+void Shader::SetVec3(const std::string& name, const glm::vec3& value)
 {
-    // Callback para redimensionamiento de ventana: reconfigura los búferes
-    glfwSetWindowSizeCallback(Engine::Get()->GetWindow()->GetNativeWindow(), [](GLFWwindow* window, int width, int height)
-    {
-        SetupBuffers(); // Vuelve a configurar los búferes (incluyendo FBO) al cambiar el tamaño de la ventana
-    });
-    // Callback para redimensionamiento del framebuffer: ajusta el viewport de OpenGL
-    glfwSetFramebufferSizeCallback(Engine::Get()->GetWindow()->GetNativeWindow(), [](GLFWwindow* window, int width, int height)
-    {
-        glViewport(0, 0, width, height); // Ajusta el viewport de OpenGL
-    });
-    // Callback para el scroll del ratón: procesa el zoom de la cámara
-    glfwSetScrollCallback(Engine::Get()->GetWindow()->GetNativeWindow(), [](GLFWwindow* window, double xOffset, double yOffset)
-    {
-        s_Data.m_Camera->ProcessMouseScroll(static_cast<float>(yOffset));
-    });
+    glUniform3fv(GetUniformLocation(name), 1, glm::value_ptr(value));
+    RenderCounters::Uniform(sizeof(value));
 }
 
-// Función principal de renderizado (dibujo de la escena)
-void Renderer::Render() {
-    // Calcula el delta time para movimientos dependientes del tiempo
-    auto currentFrame = static_cast<float>(glfwGetTime());
-    s_DeltaTime = currentFrame - s_LastFrame;
-    s_LastFrame = currentFrame;
-
-    // Vincula el FrameBuffer para que todo el dibujo se realice en él
-    s_Data.m_FBO->Bind();
-
-    // ELIMINADO: glfwPollEvents(); // Esto debe ser llamado una sola vez en el bucle principal de la aplicación (Editor::Run())
-    ProcessInput(Engine::Get()->GetWindow()->GetNativeWindow()); // Procesa la entrada del ratón y teclado
+void Shader::SetVec4(const std::string& name, const glm::vec4& value)
+{
+    glUniform4fv(GetUniformLocation(name), 1, glm::value_ptr(value));
+    RenderCounters::Uniform(sizeof(value));
+}
 
-    glEnable(GL_DEPTH_TEST); // Habilita la prueba de profundidad para objetos 3D
+void Shader::SetMat4(const std::string& name, const glm::mat4& value)
+{
+    glUniformMatrix4fv(GetUniformLocation(name), 1, GL_FALSE, glm::value_ptr(value));
+    RenderCounters::Uniform(sizeof(value));
+}
 
-    // Establece el color de fondo y limpia los búferes de color y profundidad
-    glClearColor(s_Data.m_ClearColor->x, s_Data.m_ClearColor->y, s_Data.m_ClearColor->z, 1.0f);
-    glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
+bool Shader::Reload()
+{
+    std::string vertexCode, fragmentCode;
+    if (!ReadSources(m_VertexPath, m_FragmentPath, vertexCode, fragmentCode) || vertexCode.empty() || fragmentCode.empty())
+        return false;
 
-    s_Data.m_Shader->Use(); // Activa el shader para el dibujo
+    const unsigned int program = Compile(vertexCode, fragmentCode);
+    if (program == 0)
+    {
+        LOG_ERROR("Shader", "Shader reload failed, keeping previous program: {}, {}", m_VertexPath, m_FragmentPath);
+        return false;
+    }
 
-    s_Data.m_Cube->Draw(); // Dibuja el cubo (puede ser una llamada a glDrawElements/Arrays interna)
+    // Las localizaciones de uniformes pueden cambiar con el nuevo programa
+    RenderCapture::Invalidate(CaptureResource::Program, m_ID);
+    glDeleteProgram(m_ID);
+    m_ID = program;
+    m_Uniforms.clear();
+    return true;
+}
 
-    // Obtiene las matrices de modelo, vista y proyección
-    const glm::mat4& model = *s_Data.m_Cube->GetModelMatrix();
-    const glm::mat4& view = s_Data.m_Camera->GetViewMatrix();
+bool Shader::ReadSources(const std::string& vPath, const std::string& fPath, std::string& vertexCode, std::string& fragmentCode)
+{
+    std::vector<FileReadRequest> requests(2);
+    requests[0].Path = vPath;
+    requests[1].Path = fPath;
+    std::vector<std::future<FileReadResult>> sources = AsyncIO::Get().ReadBatch(std::move(requests));
+
+    bool success = true;
+    std::string* codes[] = { &vertexCode, &fragmentCode };
+    for (size_t i = 0; i < sources.size(); i++)
+    {
+        const FileReadResult result = sources[i].get();
+        if (!result.Success)
+        {
+            LOG_ERROR("Shader", "ERROR::SHADER::FILE_NOT_SUCCESSFULLY_READ: {}", result.Path);
+            success = false;
+            continue;
+        }
+        codes[i]->assign(reinterpret_cast<const char*>(result.GetBytes()), result.BytesRead);
+    }
+    return success;
+}
 
-    // Calcula la matriz de proyección (perspectiva)
-    WindowSize size = Engine::Get()->GetWindow()->GetSize();
-    glm::mat4 projection = glm::perspective(glm::radians(45.0f), static_cast<float>(size.Width) / static_cast<float>(size.Height), 0.1f, 100.0f);
+unsigned int Shader::Compile(const std::string& vertexCode, const std::string& fragmentCode)
+{
+    const char* vShaderCode = vertexCode.c_str();
+    const char* fShaderCode = fragmentCode.c_str();
 
-    // Pasa las matrices y el color al shader como uniformes
-    glUniformMatrix4fv(s_Data.m_Shader->GetUniformLocation("model"), 1, GL_FALSE, glm::value_ptr(model));
-    glUniformMatrix4fv(s_Data.m_Shader->GetUniformLocation("view"), 1, GL_FALSE, glm::value_ptr(view));
-    glUniformMatrix4fv(s_Data.m_Shader->GetUniformLocation("projection"), 1, GL_FALSE, glm::value_ptr(projection));
-    glUniform3fv(s_Data.m_Shader->GetUniformLocation("color"), 1, glm::value_ptr(*s_Data.m_Cube->GetShaderColor()));
+    const unsigned int vertex = glCreateShader(GL_VERTEX_SHADER);
+    glShaderSource(vertex, 1, &vShaderCode, nullptr);
+    glCompileShader(vertex);
+    bool success = CheckCompileErrors(vertex, "VERTEX");
 
-    // Restablece la matriz del modelo del cubo (si es necesario, esto puede variar según la lógica del motor)
-    *s_Data.m_Cube->GetModelMatrix() = glm::mat4(1.0f);
+    const unsigned int fragment = glCreateShader(GL_FRAGMENT_SHADER);
+    glShaderSource(fragment, 1, &fShaderCode, nullptr);
+    glCompileShader(fragment);
+    success = CheckCompileErrors(fragment, "FRAGMENT") && success;
 
-    s_Data.m_VAO->Bind(); // Vincula el VAO antes de dibujar
+    const unsigned int program = glCreateProgram();
+    glAttachShader(program, vertex);
+    glAttachShader(program, fragment);
+    glLinkProgram(program);
+    success = CheckCompileErrors(program, "PROGRAM") && success;
 
-    // Dibuja los elementos indexados (el cubo)
-    glDrawElements(GL_TRIANGLES, 36, GL_UNSIGNED_INT, nullptr);
+    glDeleteShader(vertex);
+    glDeleteShader(fragment);
 
-    // Desvincula el FrameBuffer y vuelve al framebuffer por defecto (la pantalla)
-    glBindFramebuffer(GL_FRAMEBUFFER, 0);
+    if (!success)
+    {
+        glDeleteProgram(program);
+        return 0;
+    }
 
-    // ELIMINADO: glfwSwapBuffers(Engine::Get()->GetWindow()->GetNativeWindow()); // Esto debe ser llamado una sola vez en el bucle principal de la aplicación (Editor::Run())
+    return program;
 }
 
-// Procesa la entrada del usuario (ratón y teclado) para controlar la cámara
-void Renderer::ProcessInput(GLFWwindow *window)
+bool Shader::CheckCompileErrors(unsigned int shader, const std::string& type)
 {
-    if(Input::IsMouseButtonPressed(ButtonRight)) // Si el botón derecho del ratón está presionado
-    {
-        auto mousePos = Input::GetMousePosition(); // Obtiene la posición actual del ratón
+    int success;
+    char infoLog[1024];
 
-        if(s_FirstMouse) // Si es la primera vez que se detecta el ratón
+    if (type != "PROGRAM")
+    {
+        glGetShaderiv(shader, GL_COMPILE_STATUS, &success);
+        if (!success)
         {
-            s_LastX = mousePos.x; // Guarda la posición inicial del ratón
-            s_LastY = mousePos.y;
-            s_FirstMouse = false; // Ya no es la primera vez
+            glGetShaderInfoLog(shader, 1024, nullptr, infoLog);
+            LOG_ERROR("Shader", "ERROR::SHADER_COMPILATION_ERROR of type: {}\n{}", type, infoLog);
         }
-
-        // Calcula el desplazamiento del ratón
-        float xOffset = mousePos.x - s_LastX;
-        float yOffset = s_LastY - mousePos.y; // Invertido porque las coordenadas Y de la pantalla aumentan hacia abajo
-
-        // Actualiza la última posición del ratón
-        s_LastX = mousePos.x;
-        s_LastY = mousePos.y;
-
-        // Procesa el movimiento del ratón para la cámara
-        s_Data.m_Camera->ProcessMouseMovement(xOffset, yOffset);
-
-        // Deshabilita el cursor de GLFW para una experiencia de cámara en primera persona
-        glfwSetInputMode(window, GLFW_CURSOR, GLFW_CURSOR_DISABLED);
     }
-    else // Si el botón derecho del ratón no está presionado
+    else
     {
-        // Habilita el cursor de GLFW
-        glfwSetInputMode(window, GLFW_CURSOR, GLFW_CURSOR_NORMAL);
+        glGetProgramiv(shader, GL_LINK_STATUS, &success);
+        if (!success)
+        {
+            glGetProgramInfoLog(shader, 1024, nullptr, infoLog);
+            LOG_ERROR("Shader", "ERROR::PROGRAM_LINKING_ERROR of type: {}\n{}", type, infoLog);
+        }
     }
 
-    // Procesa la entrada del teclado para mover la cámara
-    if (Input::IsKeyPressed(W))
-        s_Data.m_Camera->ProcessKeyboard(FORWARD, s_DeltaTime);
-    if (Input::IsKeyPressed(S))
-        s_Data.m_Camera->ProcessKeyboard(BACKWARD, s_DeltaTime);
-    if (Input::IsKeyPressed(A))
-        s_Data.m_Camera->ProcessKeyboard(LEFT, s_DeltaTime);
-    if (Input::IsKeyPressed(D))
-        s_Data.m_Camera->ProcessKeyboard(RIGHT, s_DeltaTime);
-    if (Input::IsKeyPressed(Q))
-        s_Data.m_Camera->ProcessKeyboard(DOWN, s_DeltaTime);
-    if (Input::IsKeyPressed(E))
-        s_Data.m_Camera->ProcessKeyboard(UP, s_DeltaTime);
-}
-
-// Apagado y liberación de recursos del renderizador
-void Renderer::Shutdown()
-{
-    // Libera la memoria de los búferes y shaders
-    s_Data.m_VAO->Shutdown();
-    s_Data.m_VBO->Shutdown();
-    s_Data.m_FBO->Shutdown();
-    s_Data.m_IBO->Shutdown();
-    s_Data.m_Shader->Shutdown();
-
-    // ¡IMPORTANTE! Liberar la memoria asignada con 'new' para los punteros en RendererData
-    // Esto es crucial para evitar fugas de memoria.
-    delete s_Data.m_Scene;
-    s_Data.m_Scene = nullptr;
-    delete s_Data.m_Camera;
-    s_Data.m_Camera = nullptr;
-    delete s_Data.m_Cube;
-    s_Data.m_Cube = nullptr;
-    delete s_Data.m_ClearColor;
-    s_Data.m_ClearColor = nullptr;
+    return success;
 }
@@ -25,7 +25,28 @@ public:
     void Shutdown() const;
     int GetUniformLocation(const std::string& name);
 
+    // Envoltorios de glUniform* que además cuentan los bytes subidos en RenderStats
+    void SetInt(const std::string& name, int value);
+    void SetVec3(const std::string& name, const glm::vec3& value);
+    void SetVec4(const std::string& name, const glm::vec4& value);
+    void SetMat4(const std::string& name, const glm::mat4& value);
+
+    // Recompila desde disco. Si falla, se conserva el programa anterior y devuelve false.
+    bool Reload();
+
+    // Compila y enlaza un programa; devuelve 0 si falla. La usa también RenderReplay
+    static unsigned int Compile(const std::string& vertexCode, const std::string& fragmentCode);
+
+    const std::string& GetVertexPath() const { return m_VertexPath; }
+    const std::string& GetFragmentPath() const { return m_FragmentPath; }
+
 private:
+    // Lee los dos archivos en el mismo lote de AsyncIO; falso si alguno no se pudo leer
+    static bool ReadSources(const std::string& vPath, const std::string& fPath, std::string& vertexCode, std::string& fragmentCode);
+    static bool CheckCompileErrors(unsigned int shader, const std::string& type);
+
     unsigned int m_ID{};
+    std::string m_VertexPath;
+    std::string m_FragmentPath;
     std::unordered_map<std::string, int> m_Uniforms{};
 };
\ No newline at end of file
@@ -1,4 +1,12 @@
 #include "Texture.h"
+#include "MemoryTracker.h"
+#include "RenderStats.h"
+#include "RenderCapture.h"
+#include "AsyncIO.h"
+#include "ThreadPool.h"
+#include "Log.h"
+
+#include <algorithm>
 
 Texture::Texture()
 {
@@ -24,34 +32,342 @@ void Texture::Init()
 void Texture::Bind() const
 {
     glBindTexture(GL_TEXTURE_2D, m_Texture);
+    RenderCounters::Bind(RenderBind::Texture);
 }
 
-void Texture::Shutdown() const
+void Texture::Shutdown()
 {
+    RenderCapture::Invalidate(CaptureResource::Texture, m_Texture);
+    TRACK_GPU_MEMORY(Texture, -static_cast<int64_t>(m_GPUBytes));
+    m_GPUBytes = 0;
+
     glDeleteTextures(1, &m_Texture);
+    m_Texture = 0;
+}
+
+void Texture::TrackGPUMemory()
+{
+    // Se llama tras cada cambio de mips residentes, así que también invalida la copia capturada
+    RenderCapture::Invalidate(CaptureResource::Texture, m_Texture);
+
+    const size_t bytes = GetResidentBytes();
+    TRACK_GPU_MEMORY(Texture, static_cast<int64_t>(bytes) - static_cast<int64_t>(m_GPUBytes));
+    m_GPUBytes = bytes;
 }
 
 void Texture::GenerateFromImage(const std::string& path)
 {
-    m_Data = stbi_load(path.c_str(), &m_Width, &m_Height, &m_NrChannels, 0);
+    m_Path = path;
+
+    TextureImage image;
+    if (Decode(path, image))
+        Upload(image);
+    else
+        LOG_ERROR("Texture", "Failed to load texture: {}", path);
+}
+
+bool Texture::Decode(const std::string& path, TextureImage& image)
+{
+    // El archivo se lee entero con AsyncIO y stb decodifica desde ese mismo búfer
+    const FileReadResult file = AsyncIO::Get().Read(path).get();
+    if (!file.Success)
+        return false;
+    return Decode(file.GetBytes(), file.BytesRead, image);
+}
+
+bool Texture::Decode(const unsigned char* data, size_t size, TextureImage& image)
+{
+    if (size == 0)
+        return false;
 
-    if (m_Data)
+    int channels = 0;
+    unsigned char* pixels = stbi_load_from_memory(data, static_cast<int>(size), &image.Width, &image.Height, &channels, STBI_rgb_alpha);
+    if (!pixels)
+        return false;
+
+    image.Pixels.assign(pixels, pixels + static_cast<size_t>(image.Width) * image.Height * 4);
+    stbi_image_free(pixels);
+    return true;
+}
+
+void Texture::GenerateStreaming(const std::string& path)
+{
+    m_Streaming = true;
+    GenerateFromImage(path);
+}
+
+void Texture::GenerateStreaming(const std::string& path, std::vector<TextureImage> mips)
+{
+    m_Streaming = true;
+    m_Path = path;
+    UploadMipChain(std::move(mips));
+}
+
+void Texture::Upload(const TextureImage& image)
+{
+    if (m_Streaming)
     {
-        ToImage(m_Width, m_Height, m_Data);
-        GenerateMipmaps();
+        UploadMipChain(BuildMipChain(image));
+        return;
     }
-    else
+
+    // El objeto nuevo se prepara completo antes de liberar el anterior, para que el cambio
+    // de handle sea atómico entre frames
+    const unsigned int previous = m_Texture;
+    Init();
+    ToImage(image.Width, image.Height, image.Pixels.data());
+    GenerateMipmaps();
+    FinishUpload(previous, image.Width, image.Height);
+}
+
+void Texture::UploadMipChain(std::vector<TextureImage> mips)
+{
+    const unsigned int previous = m_Texture;
+    Init();
+
+    const int width = mips.front().Width;
+    const int height = mips.front().Height;
+
+    m_Mips = std::move(mips);
+    m_MipLastUsed.assign(m_Mips.size(), 0);
+
+    // Primer nivel de la cola: a partir de él todo cabe en StreamingTailSize
+    m_TailMip = GetMipCount() - 1;
+    while (m_TailMip > 0 && std::max(m_Mips[m_TailMip - 1].Width, m_Mips[m_TailMip - 1].Height) <= StreamingTailSize)
+        m_TailMip--;
+    m_ResidentMip = m_TailMip;
+
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAX_LEVEL, GetMipCount() - 1);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_BASE_LEVEL, m_ResidentMip);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR_MIPMAP_LINEAR);
+    for (int level = m_TailMip; level < GetMipCount(); level++)
+        UploadMip(level);
+
+    // Solo quedan los tamaños: la cola ya está en la GPU y el resto se relee cuando se pida
+    for (int level = 0; level < GetMipCount(); level++)
+        ReleaseMipData(level);
+    m_Reload.reset();
+    m_ReloadFailed = false;
+    FinishUpload(previous, width, height);
+}
+
+void Texture::FinishUpload(unsigned int previous, int width, int height)
+{
+    glBindTexture(GL_TEXTURE_2D, 0);
+
+    RenderCapture::Invalidate(CaptureResource::Texture, previous);
+    glDeleteTextures(1, &previous);
+
+    m_Width = width;
+    m_Height = height;
+    m_NrChannels = 4;
+
+    TrackGPUMemory();
+}
+
+std::vector<TextureImage> Texture::BuildMipChain(const TextureImage& image)
+{
+    std::vector<TextureImage> mips;
+    mips.push_back(image);
+
+    // Filtro de caja 2x2; en lados impares el último texel se repite
+    while (mips.back().Width > 1 || mips.back().Height > 1)
     {
-        std::cerr << "Failed to load texture: " << path;
+        const TextureImage& source = mips.back();
+        TextureImage mip;
+        mip.Width = std::max(1, source.Width / 2);
+        mip.Height = std::max(1, source.Height / 2);
+        mip.Pixels.resize(static_cast<size_t>(mip.Width) * mip.Height * 4);
+
+        for (int y = 0; y < mip.Height; y++)
+        {
+            const int y0 = std::min(y * 2, source.Height - 1);
+            const int y1 = std::min(y * 2 + 1, source.Height - 1);
+            for (int x = 0; x < mip.Width; x++)
+            {
+                const int x0 = std::min(x * 2, source.Width - 1);
+                const int x1 = std::min(x * 2 + 1, source.Width - 1);
+                for (int c = 0; c < 4; c++)
+                {
+                    const unsigned int sum = source.Pixels[(static_cast<size_t>(y0) * source.Width + x0) * 4 + c] +
+                                             source.Pixels[(static_cast<size_t>(y0) * source.Width + x1) * 4 + c] +
+                                             source.Pixels[(static_cast<size_t>(y1) * source.Width + x0) * 4 + c] +
+                                             source.Pixels[(static_cast<size_t>(y1) * source.Width + x1) * 4 + c];
+                    mip.Pixels[(static_cast<size_t>(y) * mip.Width + x) * 4 + c] = static_cast<unsigned char>((sum + 2) / 4);
+                }
+            }
+        }
+
+        mips.push_back(std::move(mip));
     }
-    stbi_image_free(m_Data);
 
+    return mips;
+}
+
+void Texture::UploadMip(int level) const
+{
+    const TextureImage& mip = m_Mips[level];
+    glTexImage2D(GL_TEXTURE_2D, level, GL_RGBA8, mip.Width, mip.Height, 0, GL_RGBA, GL_UNSIGNED_BYTE, mip.Pixels.data());
+    RenderCounters::TextureUpload(mip.Pixels.size());
+}
+
+bool Texture::PrepareMips(int level)
+{
+    if (!m_Streaming)
+        return false;
+    level = std::max(level, 0);
+
+    const auto complete = [this, level]()
+    {
+        for (int i = level; i < m_ResidentMip; i++)
+        {
+            if (m_Mips[i].Pixels.empty())
+                return false;
+        }
+        return true;
+    };
+    if (complete())
+        return true;
+    if (m_ReloadFailed)
+        return false;
+    if (!m_Reload)
+    {
+        RequestMipReload();
+        return false;
+    }
+
+    std::vector<TextureImage> mips;
+    {
+        std::lock_guard<std::mutex> lock(m_Reload->Mutex);
+        if (!m_Reload->Done)
+            return false;
+        mips = std::move(m_Reload->Mips);
+    }
+    m_Reload.reset();
+
+    if (mips.empty())
+    {
+        // Sin reintentos: la textura se queda en los mips que ya tiene hasta que se recargue
+        m_ReloadFailed = true;
+        LOG_ERROR("Texture", "Failed to reload mips of {}, streaming stops at mip {}", m_Path, m_ResidentMip);
+        return false;
+    }
+
+    // Solo los niveles que se han pedido; el resto de la relectura se descarta
+    for (int i = level; i < std::min(m_ResidentMip, static_cast<int>(mips.size())); i++)
+    {
+        if (m_Mips[i].Pixels.empty())
+            m_Mips[i].Pixels = std::move(mips[i].Pixels);
+    }
+    return complete();
+}
+
+void Texture::RequestMipReload()
+{
+    auto reload = std::make_shared<MipReload>();
+    m_Reload = reload;
+
+    // El hilo de trabajo solo toca su copia: si la textura se destruye antes, el resultado se pierde
+    ThreadPool::Get().Submit([reload, path = m_Path, width = m_Width, height = m_Height, count = m_TailMip]() {
+        MEMORY_TAG(Texture);
+        TextureImage image;
+        std::vector<TextureImage> mips;
+        // Si la imagen cambió en disco no encaja con los mips que hay: la aplicará HotReload
+        if (Decode(path, image) && image.Width == width && image.Height == height)
+        {
+            mips = BuildMipChain(image);
+            mips.resize(static_cast<size_t>(count));
+        }
+
+        std::lock_guard<std::mutex> lock(reload->Mutex);
+        reload->Mips = std::move(mips);
+        reload->Done = true;
+    });
+}
+
+void Texture::ReleaseMipData(int level)
+{
+    std::vector<unsigned char>().swap(m_Mips[level].Pixels);
+}
+
+bool Texture::StreamIn()
+{
+    if (!m_Streaming || m_ResidentMip == 0 || !PrepareMips(m_ResidentMip - 1))
+        return false;
+
+    Bind();
+    UploadMip(m_ResidentMip - 1);
+    // El nivel ya está completo antes de exponerlo al muestreo
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_BASE_LEVEL, --m_ResidentMip);
     glBindTexture(GL_TEXTURE_2D, 0);
+    // Ya está en la GPU; si se expulsa, se volverá a leer del archivo
+    ReleaseMipData(m_ResidentMip);
+    TrackGPUMemory();
+    return true;
+}
+
+bool Texture::Evict()
+{
+    if (!m_Streaming || m_ResidentMip >= m_TailMip)
+        return false;
+
+    Bind();
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_BASE_LEVEL, m_ResidentMip + 1);
+    // Redefinir el nivel con tamaño cero libera su memoria
+    glTexImage2D(GL_TEXTURE_2D, m_ResidentMip, GL_RGBA8, 0, 0, 0, GL_RGBA, GL_UNSIGNED_BYTE, nullptr);
+    glBindTexture(GL_TEXTURE_2D, 0);
+    m_ResidentMip++;
+    TrackGPUMemory();
+    return true;
+}
+
+void Texture::MarkUsed(int level, uint64_t frame)
+{
+    for (int i = std::max(level, 0); i < GetMipCount(); i++)
+        m_MipLastUsed[i] = frame;
+}
+
+size_t Texture::GetMipBytes(int level) const
+{
+    return static_cast<size_t>(m_Mips[level].Width) * m_Mips[level].Height * 4;
+}
+
+size_t Texture::GetResidentBytes() const
+{
+    if (!m_Streaming)
+        return static_cast<size_t>(m_Width) * m_Height * 4 * 4 / 3;
+
+    size_t bytes = 0;
+    for (int level = m_ResidentMip; level < GetMipCount(); level++)
+        bytes += GetMipBytes(level);
+    return bytes;
+}
+
+size_t Texture::GetCPUBytes() const
+{
+    size_t bytes = 0;
+    for (const TextureImage& mip : m_Mips)
+        bytes += mip.Pixels.size();
+    return bytes;
+}
+
+size_t Texture::GetTotalBytes() const
+{
+    if (!m_Streaming)
+        return GetResidentBytes();
+
+    size_t bytes = 0;
+    for (int level = 0; level < GetMipCount(); level++)
+        bytes += GetMipBytes(level);
+    return bytes;
 }
 
 void Texture::ToImage(int width, int height, const unsigned char* data)
 {
     glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, width, height, 0, GL_RGBA, GL_UNSIGNED_BYTE, data);
+    // Sin datos solo se reserva almacenamiento (p. ej. el color de un FBO), no hay subida
+    if (data)
+        RenderCounters::TextureUpload(static_cast<uint64_t>(width) * height * 4);
 }
 
 void Texture::GenerateMipmaps()
@@ -2,8 +2,19 @@
 
 #include <glad/glad.h>
 #include <stb_image.h>
+#include <cstdint>
 #include <iostream>
+#include <memory>
+#include <mutex>
 #include <string>
+#include <vector>
+
+// Imagen decodificada en CPU (siempre RGBA8), lista para subir desde el hilo de OpenGL
+struct TextureImage
+{
+    int Width{}, Height{};
+    std::vector<unsigned char> Pixels;
+};
 
 class Texture
 {
@@ -12,10 +23,53 @@ public:
     ~Texture();
 
     void Init();
-    void Shutdown() const;
+    void Shutdown();
     void Bind() const;
     void GenerateFromImage(const std::string& path);
 
+    // Decodificar no usa OpenGL, así que puede hacerse desde cualquier hilo
+    static bool Decode(const std::string& path, TextureImage& image);
+    static bool Decode(const unsigned char* data, size_t size, TextureImage& image);
+    // Crea un objeto de textura nuevo con 'image' y solo entonces sustituye al anterior
+    void Upload(const TextureImage& image);
+
+    // Streaming de mips: al cargar solo quedan residentes los mips de la cola (lado <= StreamingTailSize).
+    // TextureStreamer sube o expulsa niveles de uno en uno moviendo GL_TEXTURE_BASE_LEVEL.
+    // La cadena en CPU no se conserva: tras la carga solo quedan los tamaños. Los niveles que se piden
+    // se releen del archivo en un hilo de trabajo (PrepareMips) y su copia se libera al subirlos, así
+    // que cada textura ocupa en RAM solo lo que está esperando subida.
+    static constexpr int StreamingTailSize = 64;
+
+    void GenerateStreaming(const std::string& path);
+    // Con la cadena ya construida (BuildMipChain en un hilo de trabajo): en el hilo de OpenGL solo
+    // queda subirla. 'path' queda para las recargas y para releer los mips.
+    void GenerateStreaming(const std::string& path, std::vector<TextureImage> mips);
+    // Cadena completa con filtro de caja, desde 'image' hasta 1x1. No usa OpenGL.
+    static std::vector<TextureImage> BuildMipChain(const TextureImage& image);
+    bool IsStreaming() const { return m_Streaming; }
+
+    int GetMipCount() const { return static_cast<int>(m_Mips.size()); }
+    int GetResidentMip() const { return m_ResidentMip; }
+    int GetTailMip() const { return m_TailMip; }
+    size_t GetMipBytes(int level) const;
+    size_t GetResidentBytes() const;
+    size_t GetTotalBytes() const;
+
+    // Deja en CPU los niveles [level, residente) para StreamIn. Si falta alguno lo pide al archivo en
+    // un hilo de trabajo y devuelve false hasta que llega.
+    bool PrepareMips(int level);
+    bool IsReloadingMips() const { return m_Reload != nullptr; }
+    // Bytes de mips en CPU pendientes de subida
+    size_t GetCPUBytes() const;
+
+    // Sube el siguiente mip más detallado (false si sus datos aún no están en CPU) / libera el más detallado residente
+    bool StreamIn();
+    bool Evict();
+
+    // Marca como usados en 'frame' el nivel pedido y todos los más pequeños
+    void MarkUsed(int level, uint64_t frame);
+    uint64_t GetLastUsed(int level) const { return m_MipLastUsed[level]; }
+
     static Texture Create();
     static void ToImage(int width, int height, const unsigned char* data);
     static void GenerateMipmaps();
@@ -25,9 +79,39 @@ public:
     int GetWidth() const;
     int GetHeight() const;
     int GetNrChannels() const;
+    const std::string& GetPath() const { return m_Path; }
 
 private:
+    // Relectura de los niveles por encima de la cola; el hilo de trabajo la comparte con la textura
+    struct MipReload
+    {
+        std::mutex Mutex;
+        bool Done = false;
+        // Vacío si el archivo ya no se pudo leer o cambió de tamaño
+        std::vector<TextureImage> Mips;
+    };
+
+    void UploadMipChain(std::vector<TextureImage> mips);
+    // Sustituye el objeto de textura 'previous' por el recién subido
+    void FinishUpload(unsigned int previous, int width, int height);
+    void RequestMipReload();
+    void ReleaseMipData(int level);
+    void UploadMip(int level) const;
+    // Actualiza la memoria de GPU declarada al MemoryTracker tras subir o expulsar mips
+    void TrackGPUMemory();
+
     unsigned int m_Texture{};
     unsigned char* m_Data{};
     int m_Width{}, m_Height{}, m_NrChannels{};
+    std::string m_Path;
+
+    bool m_Streaming = false;
+    std::vector<TextureImage> m_Mips;
+    std::vector<uint64_t> m_MipLastUsed;
+    int m_ResidentMip{};
+    int m_TailMip{};
+    std::shared_ptr<MipReload> m_Reload;
+    bool m_ReloadFailed = false;
+
+    size_t m_GPUBytes{};
 };
\ No newline at end of file
@@ -0,0 +1,147 @@
+#include "TextureStreamer.h"
+#include "MemoryTracker.h"
+#include "Profiler.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+std::vector<Texture*> TextureStreamer::s_Textures;
+std::unordered_map<Texture*, int> TextureStreamer::s_Requests;
+
+size_t TextureStreamer::s_BudgetBytes = TextureStreamer::DefaultBudgetBytes;
+uint64_t TextureStreamer::s_Frame = 1;
+TextureStreamingStats TextureStreamer::s_Stats;
+
+void TextureStreamer::Register(Texture* texture)
+{
+    if (texture->IsStreaming() && std::find(s_Textures.begin(), s_Textures.end(), texture) == s_Textures.end())
+        s_Textures.push_back(texture);
+}
+
+void TextureStreamer::Unregister(Texture* texture)
+{
+    s_Textures.erase(std::remove(s_Textures.begin(), s_Textures.end(), texture), s_Textures.end());
+    s_Requests.erase(texture);
+}
+
+void TextureStreamer::RequestMip(Texture* texture, float texelsPerPixel)
+{
+    if (!texture || !texture->IsStreaming())
+        return;
+
+    // Con un texel por píxel basta el mip 0; cada potencia de dos más, un nivel más pequeño
+    const int level = texelsPerPixel > 1.0f ? static_cast<int>(std::floor(std::log2(texelsPerPixel))) : 0;
+    const int clamped = std::min(level, texture->GetMipCount() - 1);
+
+    auto [it, inserted] = s_Requests.try_emplace(texture, clamped);
+    if (!inserted)
+        it->second = std::min(it->second, clamped);
+}
+
+size_t TextureStreamer::GetResidentBytes()
+{
+    size_t bytes = 0;
+    for (const Texture* texture : s_Textures)
+        bytes += texture->GetResidentBytes();
+    return bytes;
+}
+
+// Expulsa el mip más detallado de la textura menos usada recientemente.
+// Los mips usados en el frame actual no se tocan.
+bool TextureStreamer::EvictLeastRecentlyUsed()
+{
+    Texture* victim = nullptr;
+    uint64_t oldest = std::numeric_limits<uint64_t>::max();
+
+    for (Texture* texture : s_Textures)
+    {
+        const int level = texture->GetResidentMip();
+        if (level >= texture->GetTailMip())
+            continue;
+
+        const uint64_t lastUsed = texture->GetLastUsed(level);
+        if (lastUsed < s_Frame && lastUsed < oldest)
+        {
+            oldest = lastUsed;
+            victim = texture;
+        }
+    }
+
+    if (!victim)
+        return false;
+
+    victim->Evict();
+    s_Stats.Evicted++;
+    return true;
+}
+
+void TextureStreamer::Update()
+{
+    PROFILE_SCOPE("TextureStreamer::Update");
+    MEMORY_TAG(Texture);
+
+    for (const auto& [texture, level] : s_Requests)
+        texture->MarkUsed(level, s_Frame);
+
+    size_t residentBytes = GetResidentBytes();
+    unsigned int uploads = 0;
+    unsigned int pending = 0;
+
+    for (const auto& [texture, level] : s_Requests)
+    {
+        // Antes de expulsar nada para hacerle sitio: sus datos pueden estar aún leyéndose del archivo
+        if (texture->GetResidentMip() > level && !texture->PrepareMips(level))
+        {
+            pending += texture->GetResidentMip() - level;
+            continue;
+        }
+
+        while (texture->GetResidentMip() > level)
+        {
+            const size_t bytes = texture->GetMipBytes(texture->GetResidentMip() - 1);
+
+            // Hace sitio con mips antiguos; si no hay, el mip espera a que se libere presupuesto
+            while (residentBytes + bytes > s_BudgetBytes && EvictLeastRecentlyUsed())
+                residentBytes = GetResidentBytes();
+
+            if (uploads >= MaxUploadsPerFrame || residentBytes + bytes > s_BudgetBytes)
+            {
+                pending += texture->GetResidentMip() - level;
+                break;
+            }
+
+            // Sin sus datos en CPU (p. ej. la expulsión de arriba se llevó un nivel de esta misma textura)
+            // el mip no sube: sigue pendiente y no cuenta en el presupuesto
+            if (!texture->StreamIn())
+            {
+                pending += texture->GetResidentMip() - level;
+                break;
+            }
+            residentBytes += bytes;
+            uploads++;
+            s_Stats.StreamedIn++;
+        }
+    }
+
+    // Si el presupuesto se redujo, se expulsa lo que ya no cabe
+    while (residentBytes > s_BudgetBytes && EvictLeastRecentlyUsed())
+        residentBytes = GetResidentBytes();
+
+    s_Stats.BudgetBytes = s_BudgetBytes;
+    s_Stats.ResidentBytes = residentBytes;
+    s_Stats.FullBytes = 0;
+    s_Stats.CPUBytes = 0;
+    s_Stats.ReloadingTextures = 0;
+    for (const Texture* texture : s_Textures)
+    {
+        s_Stats.FullBytes += texture->GetTotalBytes();
+        s_Stats.CPUBytes += texture->GetCPUBytes();
+        s_Stats.ReloadingTextures += texture->IsReloadingMips() ? 1 : 0;
+    }
+    s_Stats.TextureCount = static_cast<unsigned int>(s_Textures.size());
+    s_Stats.PendingMips = pending;
+
+    s_Requests.clear();
+    s_Frame++;
+}
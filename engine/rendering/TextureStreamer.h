@@ -0,0 +1,60 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+#include "Texture.h"
+
+struct TextureStreamingStats
+{
+    size_t BudgetBytes{};
+    size_t ResidentBytes{};
+    // Memoria que ocuparían todas las texturas con la cadena completa residente
+    size_t FullBytes{};
+    // Mips en RAM esperando subida (releídos del archivo) y texturas con una relectura en curso
+    size_t CPUBytes{};
+    unsigned int ReloadingTextures{};
+    unsigned int TextureCount{};
+    unsigned int PendingMips{};
+    unsigned int StreamedIn{};
+    unsigned int Evicted{};
+};
+
+// Decide qué mips de cada textura en streaming deben estar en VRAM.
+// Durante el frame el renderer pide un mip por uso (RequestMip); en Update() se suben los
+// niveles que falten, limitados por frame, y si se supera el presupuesto se expulsan
+// primero los mips usados hace más tiempo. Los datos de un mip que no está en la GPU se releen del
+// archivo (Texture::PrepareMips), así que puede tardar unos frames más en subirse.
+class TextureStreamer
+{
+public:
+    static constexpr size_t DefaultBudgetBytes = 64ull * 1024 * 1024;
+    static constexpr unsigned int MaxUploadsPerFrame = 2;
+
+    static void Register(Texture* texture);
+    static void Unregister(Texture* texture);
+
+    // 'texelsPerPixel': texels de mip 0 que cubre cada píxel en pantalla
+    static void RequestMip(Texture* texture, float texelsPerPixel);
+    static void Update();
+
+    static void SetBudget(size_t bytes) { s_BudgetBytes = bytes; }
+    static size_t GetBudget() { return s_BudgetBytes; }
+
+    static const TextureStreamingStats& GetStats() { return s_Stats; }
+    static const std::vector<Texture*>& GetTextures() { return s_Textures; }
+
+private:
+    static size_t GetResidentBytes();
+    static bool EvictLeastRecentlyUsed();
+
+    static std::vector<Texture*> s_Textures;
+    // Mip más detallado pedido este frame por textura
+    static std::unordered_map<Texture*, int> s_Requests;
+
+    static size_t s_BudgetBytes;
+    static uint64_t s_Frame;
+    static TextureStreamingStats s_Stats;
+};
@@ -1,4 +1,6 @@
 #include "VertexArray.h"
+#include "RenderStats.h"
+#include "RenderCapture.h"
 
 VertexArray::VertexArray()
 {
@@ -18,6 +20,7 @@ VertexArray VertexArray::Create()
 void VertexArray::Bind() const
 {
     glBindVertexArray(m_VAO);
+    RenderCounters::Bind(RenderBind::VertexArray);
 }
 
 void VertexArray::Unbind()
@@ -27,5 +30,6 @@ void VertexArray::Unbind()
 
 void VertexArray::Shutdown() const
 {
+    RenderCapture::Invalidate(CaptureResource::VertexArray, m_VAO);
     glDeleteVertexArrays(1, &m_VAO);
 }
@@ -2,6 +2,9 @@
 
 #include <glad/glad.h>
 
+#include "VertexBuffer.h"
+#include "VertexLayout.h"
+
 class VertexArray
 {
 public:
@@ -14,6 +17,15 @@ public:
     static void Unbind();
     void Shutdown() const;
 
+    // Asocia 'buffer' al VAO con los atributos descritos por el VertexStream 'Stream'
+    template <typename Stream>
+    void AddStream(const VertexBuffer& buffer) const
+    {
+        Bind();
+        buffer.Bind();
+        Stream::Apply();
+    }
+
 private:
     unsigned int m_VAO{};
 };
\ No newline at end of file
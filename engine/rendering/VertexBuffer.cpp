@@ -1,4 +1,7 @@
 #include "VertexBuffer.h"
+#include "MemoryTracker.h"
+#include "RenderStats.h"
+#include "RenderCapture.h"
 
 VertexBuffer::VertexBuffer()
 {
@@ -18,19 +21,31 @@ VertexBuffer VertexBuffer::Create()
 void VertexBuffer::Bind() const
 {
     glBindBuffer(GL_ARRAY_BUFFER, m_VBO);
+    RenderCounters::Bind(RenderBind::Buffer);
 }
 void VertexBuffer::Unbind()
 {
     glBindBuffer(GL_ARRAY_BUFFER, 0);
 }
 
-void VertexBuffer::SetData(int size, const void* data) const
+void VertexBuffer::SetData(int size, const void* data)
 {
     Bind();
     glBufferData(GL_ARRAY_BUFFER, size, data, GL_STATIC_DRAW);
+    RenderCounters::BufferUpload(size);
+    RenderCapture::Invalidate(CaptureResource::Buffer, m_VBO);
+
+    // glBufferData sustituye el almacenamiento anterior
+    TRACK_GPU_MEMORY(Buffer, size - m_Size);
+    m_Size = size;
 }
 
-void VertexBuffer::Shutdown() const
+void VertexBuffer::Shutdown()
 {
+    RenderCapture::Invalidate(CaptureResource::Buffer, m_VBO);
+    TRACK_GPU_MEMORY(Buffer, -m_Size);
+    m_Size = 0;
+
     glDeleteBuffers(1, &m_VBO);
+    m_VBO = 0;
 }
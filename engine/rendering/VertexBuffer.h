@@ -12,9 +12,11 @@ public:
 
     void Bind() const;
     static void Unbind();
-    void SetData(int size, const void* data) const;
-    void Shutdown() const;
+    void SetData(int size, const void* data);
+    void Shutdown();
 
 private:
     unsigned int m_VBO{};
+    // Bytes reservados en GPU por el último SetData
+    int m_Size{};
 };
\ No newline at end of file
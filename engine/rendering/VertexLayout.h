@@ -0,0 +1,90 @@
+#pragma once
+
+#include <glad/glad.h>
+#include <cstddef>
+#include <cstdint>
+#include <tuple>
+
+// Descripción en tiempo de compilación de un flujo de vértices.
+// Cada atributo conoce su localización, componentes y tipo; el flujo calcula el stride
+// y los offsets, y genera las llamadas a glVertexAttribPointer al aplicarse.
+
+template <GLenum Type>
+struct GLTypeSize;
+
+template <> struct GLTypeSize<GL_FLOAT> { static constexpr GLsizei Value = 4; };
+template <> struct GLTypeSize<GL_HALF_FLOAT> { static constexpr GLsizei Value = 2; };
+template <> struct GLTypeSize<GL_SHORT> { static constexpr GLsizei Value = 2; };
+template <> struct GLTypeSize<GL_UNSIGNED_SHORT> { static constexpr GLsizei Value = 2; };
+template <> struct GLTypeSize<GL_BYTE> { static constexpr GLsizei Value = 1; };
+template <> struct GLTypeSize<GL_UNSIGNED_BYTE> { static constexpr GLsizei Value = 1; };
+
+template <unsigned int L, GLint N, GLenum T, bool Norm = false>
+struct VertexAttribute
+{
+    static constexpr bool IsPadding = false;
+    static constexpr unsigned int Location = L;
+    static constexpr GLint Components = N;
+    static constexpr GLenum Type = T;
+    static constexpr GLboolean Normalized = Norm ? GL_TRUE : GL_FALSE;
+    static constexpr GLsizei Size = N * GLTypeSize<T>::Value;
+};
+
+// Bytes de relleno para mantener los atributos alineados a 4 bytes
+template <GLsizei Bytes>
+struct VertexPadding
+{
+    static constexpr bool IsPadding = true;
+    static constexpr GLsizei Size = Bytes;
+};
+
+namespace VertexFormat
+{
+    template <unsigned int L> using Float2 = VertexAttribute<L, 2, GL_FLOAT>;
+    template <unsigned int L> using Float3 = VertexAttribute<L, 3, GL_FLOAT>;
+    template <unsigned int L> using Half2 = VertexAttribute<L, 2, GL_HALF_FLOAT>;
+    template <unsigned int L> using Half3 = VertexAttribute<L, 3, GL_HALF_FLOAT>;
+    // Normal en codificación octaédrica: dos componentes snorm16, se decodifica en el shader
+    template <unsigned int L> using Octahedral16 = VertexAttribute<L, 2, GL_SHORT, true>;
+    template <unsigned int L> using Unorm8x4 = VertexAttribute<L, 4, GL_UNSIGNED_BYTE, true>;
+    // Valores cuantizados a un rango conocido (p. ej. la caja de la malla); el shader los devuelve a él
+    template <unsigned int L> using Unorm16x2 = VertexAttribute<L, 2, GL_UNSIGNED_SHORT, true>;
+    template <unsigned int L> using Unorm16x3 = VertexAttribute<L, 3, GL_UNSIGNED_SHORT, true>;
+}
+
+template <typename... Attributes>
+struct VertexStream
+{
+    static constexpr GLsizei Stride = (Attributes::Size + ...);
+
+    // Requiere el VAO y el VBO del flujo ya vinculados
+    static void Apply()
+    {
+        GLsizei offset = 0;
+        (ApplyAttribute<Attributes>(offset), ...);
+    }
+
+private:
+    template <typename Attribute>
+    static void ApplyAttribute(GLsizei& offset)
+    {
+        if constexpr (!Attribute::IsPadding)
+        {
+            glVertexAttribPointer(Attribute::Location, Attribute::Components, Attribute::Type, Attribute::Normalized,
+                                  Stride, reinterpret_cast<void*>(static_cast<std::uintptr_t>(offset)));
+            glEnableVertexAttribArray(Attribute::Location);
+        }
+        offset += Attribute::Size;
+    }
+};
+
+// Conjunto de flujos que forman un vértice completo; cada flujo vive en su propio VBO
+template <typename... Streams>
+struct VertexLayout
+{
+    static constexpr unsigned int StreamCount = sizeof...(Streams);
+    static constexpr GLsizei VertexSize = (Streams::Stride + ...);
+
+    template <std::size_t Index>
+    using Stream = std::tuple_element_t<Index, std::tuple<Streams...>>;
+};
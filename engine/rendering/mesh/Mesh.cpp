@@ -0,0 +1,208 @@
+#include "Mesh.h"
+
+#include <glm/gtc/matrix_transform.hpp>
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+
+#include "MeshOptimizer.h"
+#include "RenderStats.h"
+#include "RenderCapture.h"
+
+namespace
+{
+    std::uint8_t PackUnorm8(float value)
+    {
+        return static_cast<std::uint8_t>(std::lround(std::clamp(value, 0.0f, 1.0f) * 255.0f));
+    }
+
+    // 'value' dentro de [min, min + extent]; con extent 0 todos los valores son min
+    std::uint16_t QuantizeUnorm16(float value, float min, float extent)
+    {
+        if (extent <= 0.0f)
+            return 0;
+        return static_cast<std::uint16_t>(std::lround(std::clamp((value - min) / extent, 0.0f, 1.0f) * 65535.0f));
+    }
+}
+
+Mesh::Mesh(MeshData data, MeshVertexFormat format) : m_Data(std::move(data)), m_Format(format)
+{
+    // Datos que no pasaron por MeshOptimizer: un único LOD con todo el índice
+    if (m_Data.LODs.empty())
+        m_Data.LODs.push_back({ 0, static_cast<unsigned int>(m_Data.Indices.size()), 0.0f });
+    if (m_Data.BoundsRadius <= 0.0f)
+        MeshOptimizer::ComputeBounds(m_Data);
+    if (m_Data.UVDensity <= 0.0f)
+        MeshOptimizer::ComputeUVDensity(m_Data);
+    if (m_Data.Meshlets.empty())
+        m_Data.Meshlets = MeshletBuilder::Build(m_Data.Vertices, m_Data.Indices, m_Data.LODs[0].IndexOffset, m_Data.LODs[0].IndexCount);
+
+    Upload();
+}
+
+Mesh::~Mesh()
+{
+    Shutdown();
+}
+
+void Mesh::Upload()
+{
+    m_VAO = std::make_unique<VertexArray>();
+    m_VBO = std::make_unique<VertexBuffer>();
+    m_IBO = std::make_unique<IndexBuffer>();
+    m_AttributeVBO.reset();
+
+    m_VAO->Bind();
+    m_IBO->SetData(static_cast<int>(sizeof(unsigned int) * m_Data.Indices.size()), m_Data.Indices.data());
+
+    if (m_Format == MeshVertexFormat::Compressed)
+        UploadCompressed();
+    else
+        UploadFloat();
+
+    // El IBO queda registrado en el VAO, así que se desvincula después del VAO
+    VertexArray::Unbind();
+    VertexBuffer::Unbind();
+    IndexBuffer::Unbind();
+}
+
+void Mesh::UploadFloat()
+{
+    m_PositionMin = glm::vec3(0.0f);
+    m_PositionExtent = glm::vec3(1.0f);
+    m_TexCoordMin = glm::vec2(0.0f);
+    m_TexCoordExtent = glm::vec2(1.0f);
+
+    m_VBO->SetData(static_cast<int>(sizeof(MeshVertex) * m_Data.Vertices.size()), m_Data.Vertices.data());
+    m_VAO->AddStream<FloatVertexLayout::Stream<0>>(*m_VBO);
+}
+
+void Mesh::UploadCompressed()
+{
+    std::vector<PackedPosition> positions(m_Data.Vertices.size());
+    std::vector<PackedAttributes> attributes(m_Data.Vertices.size());
+
+    // Caja de posiciones y de UV: 16 bits repartidos sobre lo que la malla usa de verdad
+    glm::vec3 positionMax(0.0f);
+    glm::vec2 texCoordMax(0.0f);
+    m_PositionMin = glm::vec3(0.0f);
+    m_TexCoordMin = glm::vec2(0.0f);
+    if (!m_Data.Vertices.empty())
+    {
+        m_PositionMin = positionMax = m_Data.Vertices.front().Position;
+        m_TexCoordMin = texCoordMax = m_Data.Vertices.front().TexCoord;
+    }
+    for (const MeshVertex& vertex : m_Data.Vertices)
+    {
+        m_PositionMin = glm::min(m_PositionMin, vertex.Position);
+        positionMax = glm::max(positionMax, vertex.Position);
+        m_TexCoordMin = glm::min(m_TexCoordMin, vertex.TexCoord);
+        texCoordMax = glm::max(texCoordMax, vertex.TexCoord);
+    }
+    m_PositionExtent = positionMax - m_PositionMin;
+    m_TexCoordExtent = texCoordMax - m_TexCoordMin;
+
+    for (size_t i = 0; i < m_Data.Vertices.size(); i++)
+    {
+        const MeshVertex& vertex = m_Data.Vertices[i];
+
+        for (int c = 0; c < 3; c++)
+            positions[i].Position[c] = QuantizeUnorm16(vertex.Position[c], m_PositionMin[c], m_PositionExtent[c]);
+        positions[i].Padding = 0;
+
+        for (int c = 0; c < 3; c++)
+            attributes[i].Color[c] = PackUnorm8(vertex.Color[c]);
+        attributes[i].Color[3] = 255;
+        attributes[i].TexCoord[0] = QuantizeUnorm16(vertex.TexCoord.x, m_TexCoordMin.x, m_TexCoordExtent.x);
+        attributes[i].TexCoord[1] = QuantizeUnorm16(vertex.TexCoord.y, m_TexCoordMin.y, m_TexCoordExtent.y);
+    }
+
+    m_AttributeVBO = std::make_unique<VertexBuffer>();
+
+    m_VBO->SetData(static_cast<int>(sizeof(PackedPosition) * positions.size()), positions.data());
+    m_VAO->AddStream<CompressedPositionStream>(*m_VBO);
+
+    m_AttributeVBO->SetData(static_cast<int>(sizeof(PackedAttributes) * attributes.size()), attributes.data());
+    m_VAO->AddStream<CompressedAttributeStream>(*m_AttributeVBO);
+}
+
+void Mesh::SetVertexFormat(MeshVertexFormat format)
+{
+    if (format == m_Format)
+        return;
+
+    m_Format = format;
+    Shutdown();
+    Upload();
+}
+
+unsigned int Mesh::GetVertexSize() const
+{
+    return m_Format == MeshVertexFormat::Compressed ? CompressedVertexLayout::VertexSize : FloatVertexLayout::VertexSize;
+}
+
+glm::mat4 Mesh::GetPositionTransform() const
+{
+    return glm::scale(glm::translate(glm::mat4(1.0f), m_PositionMin), m_PositionExtent);
+}
+
+void Mesh::Draw(unsigned int lod) const
+{
+    if (!m_VAO || m_Data.LODs.empty())
+        return;
+
+    const MeshLOD& range = m_Data.LODs[std::min(lod, GetLODCount() - 1)];
+
+    m_VAO->Bind();
+    const void* offset = reinterpret_cast<void*>(static_cast<size_t>(range.IndexOffset) * sizeof(unsigned int));
+    glDrawElements(GL_TRIANGLES, static_cast<GLsizei>(range.IndexCount), GL_UNSIGNED_INT, offset);
+    RenderCapture::OnDrawElements(GL_TRIANGLES, static_cast<GLsizei>(range.IndexCount), GL_UNSIGNED_INT, offset);
+    RenderCounters::Draw(range.IndexCount);
+}
+
+void Mesh::DrawMeshlets(const MeshletDrawList& drawList) const
+{
+    DrawMeshlets(drawList.Counts.data(), drawList.Offsets.data(), static_cast<GLsizei>(drawList.Counts.size()));
+}
+
+void Mesh::DrawMeshlets(const GLsizei* counts, const void* const* offsets, GLsizei drawCount) const
+{
+    if (!m_VAO || drawCount == 0)
+        return;
+
+    m_VAO->Bind();
+    glMultiDrawElements(GL_TRIANGLES, counts, GL_UNSIGNED_INT, offsets, drawCount);
+    RenderCapture::OnMultiDrawElements(GL_TRIANGLES, counts, GL_UNSIGNED_INT, offsets, drawCount);
+
+    uint64_t indexCount = 0;
+    for (GLsizei i = 0; i < drawCount; i++)
+        indexCount += static_cast<uint64_t>(counts[i]);
+    RenderCounters::MultiDraw(indexCount, static_cast<uint32_t>(drawCount));
+}
+
+unsigned int Mesh::SelectLOD(float pixelsPerUnit, unsigned int currentLOD, float thresholdPixels, float hysteresis) const
+{
+    if (m_Data.LODs.size() < 2)
+        return 0;
+
+    unsigned int lod = std::min(currentLOD, GetLODCount() - 1);
+    auto projectedError = [&](unsigned int level) { return m_Data.LODs[level].Error * pixelsPerUnit; };
+
+    // Se refina solo si el error supera claramente el umbral y se simplifica solo si
+    // queda claramente por debajo; entre ambos límites se mantiene el LOD actual.
+    while (lod > 0 && projectedError(lod) > thresholdPixels * (1.0f + hysteresis))
+        lod--;
+    while (lod + 1 < GetLODCount() && projectedError(lod + 1) <= thresholdPixels * (1.0f - hysteresis))
+        lod++;
+
+    return lod;
+}
+
+void Mesh::Shutdown()
+{
+    // Los destructores de los búferes ya llaman a su propio Shutdown()
+    m_VAO.reset();
+    m_VBO.reset();
+    m_AttributeVBO.reset();
+    m_IBO.reset();
+}
@@ -0,0 +1,162 @@
+#pragma once
+
+#include <glad/glad.h>
+#include <glm/glm.hpp>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "VertexArray.h"
+#include "VertexBuffer.h"
+#include "IndexBuffer.h"
+#include "VertexLayout.h"
+#include "Meshlet.h"
+
+// Vértice intercalado que usan todos los importadores.
+// Posición y color ocupan las localizaciones 0 y 1 del shader, igual que el cubo.
+struct MeshVertex
+{
+    glm::vec3 Position;
+    glm::vec3 Color;
+    glm::vec3 Normal;
+    glm::vec2 TexCoord;
+};
+
+// Formato de los vértices en GPU.
+// Float: un único flujo intercalado con MeshVertex tal cual (44 bytes).
+// Compressed: flujo de posiciones aparte (8 bytes) y flujo de atributos con color unorm8 y UV (8 bytes).
+// Los shaders no iluminan, así que la normal no se sube (VertexFormat::Octahedral16 si hiciera falta).
+// Posiciones y UV van en unorm16 cuantizadas a su caja en la malla: la precisión es relativa al
+// tamaño de la malla, sin el desbordamiento ni la pérdida de half lejos del origen (unidades en
+// centímetros, UV con repetición). GetPositionTransform y GetTexCoordTransform las devuelven a su rango.
+enum class MeshVertexFormat
+{
+    Float,
+    Compressed
+};
+
+struct PackedPosition
+{
+    std::uint16_t Position[3];
+    std::uint16_t Padding;
+};
+
+struct PackedAttributes
+{
+    std::uint8_t Color[4];
+    std::uint16_t TexCoord[2];
+};
+
+using FloatVertexLayout = VertexLayout<
+    VertexStream<VertexFormat::Float3<0>, VertexFormat::Float3<1>, VertexFormat::Float3<2>, VertexFormat::Float2<3>>>;
+
+using CompressedPositionStream = VertexStream<VertexFormat::Unorm16x3<0>, VertexPadding<2>>;
+using CompressedAttributeStream = VertexStream<VertexFormat::Unorm8x4<1>, VertexFormat::Unorm16x2<3>>;
+using CompressedVertexLayout = VertexLayout<CompressedPositionStream, CompressedAttributeStream>;
+
+static_assert(FloatVertexLayout::VertexSize == sizeof(MeshVertex), "FloatVertexLayout does not match MeshVertex");
+static_assert(CompressedPositionStream::Stride == sizeof(PackedPosition), "Position stream does not match PackedPosition");
+static_assert(CompressedAttributeStream::Stride == sizeof(PackedAttributes), "Attribute stream does not match PackedAttributes");
+
+// Resultados del optimizador, útiles para mostrarlos en el editor.
+struct MeshStats
+{
+    unsigned int ImportedVertexCount{};
+    unsigned int VertexCount{};
+    unsigned int TriangleCount{};
+
+    // ACMR: fallos de caché por triángulo. ATVR: fallos por vértice único.
+    float ACMRBefore{}, ACMRAfter{};
+    float ATVRBefore{}, ATVRAfter{};
+};
+
+// Rango de un nivel de detalle dentro del índice compartido.
+// 'Error' es la desviación geométrica máxima respecto al LOD 0, en unidades del objeto.
+struct MeshLOD
+{
+    unsigned int IndexOffset{};
+    unsigned int IndexCount{};
+    float Error{};
+};
+
+// Geometría en memoria de CPU, tal como sale del importador.
+// Todos los LODs viven concatenados en 'Indices' (el LOD 0 primero) y comparten 'Vertices'.
+struct MeshData
+{
+    std::string Name;
+    std::vector<MeshVertex> Vertices;
+    std::vector<unsigned int> Indices;
+    std::vector<MeshLOD> LODs;
+    // Particiones del LOD 0 para el descarte por grupos de triángulos
+    std::vector<Meshlet> Meshlets;
+    MeshStats Stats;
+
+    glm::vec3 BoundsCenter{0.0f};
+    float BoundsRadius{};
+
+    // Unidades de UV por unidad del objeto, para estimar qué mip de textura se ve en pantalla
+    float UVDensity{};
+};
+
+class Mesh
+{
+public:
+    explicit Mesh(MeshData data, MeshVertexFormat format = MeshVertexFormat::Compressed);
+    ~Mesh();
+
+    Mesh(const Mesh&) = delete;
+    Mesh& operator=(const Mesh&) = delete;
+
+    void Draw(unsigned int lod = 0) const;
+    // Dibuja solo los rangos del LOD 0 que sobrevivieron a MeshletCuller::Cull
+    void DrawMeshlets(const MeshletDrawList& drawList) const;
+    // Rangos ya copiados fuera de un MeshletDrawList (FramePacket)
+    void DrawMeshlets(const GLsizei* counts, const void* const* offsets, GLsizei drawCount) const;
+    void Shutdown();
+
+    // Vuelve a subir los vértices con otro formato (los datos de CPU se conservan)
+    void SetVertexFormat(MeshVertexFormat format);
+    MeshVertexFormat GetVertexFormat() const { return m_Format; }
+    // Bytes por vértice en GPU, sumando todos los flujos
+    unsigned int GetVertexSize() const;
+
+    // Lleva las posiciones de la GPU a unidades del objeto: se multiplica a la derecha de la matriz
+    // de modelo. Identidad en formato Float.
+    glm::mat4 GetPositionTransform() const;
+    // UV de la GPU a las de la malla: xy escala, zw desplazamiento. (1, 1, 0, 0) en formato Float.
+    glm::vec4 GetTexCoordTransform() const { return glm::vec4(m_TexCoordExtent.x, m_TexCoordExtent.y, m_TexCoordMin.x, m_TexCoordMin.y); }
+
+    // Elige el LOD más simple cuyo error proyectado no supere 'thresholdPixels'.
+    // 'pixelsPerUnit' es el tamaño en píxeles de una unidad del objeto a su distancia actual.
+    // La histéresis evita que el LOD oscile cuando el error ronda el umbral.
+    unsigned int SelectLOD(float pixelsPerUnit, unsigned int currentLOD, float thresholdPixels, float hysteresis) const;
+
+    unsigned int GetLODCount() const { return static_cast<unsigned int>(m_Data.LODs.size()); }
+    const std::vector<Meshlet>& GetMeshlets() const { return m_Data.Meshlets; }
+
+    const std::string& GetName() const { return m_Data.Name; }
+    const MeshStats& GetStats() const { return m_Data.Stats; }
+    const MeshData& GetData() const { return m_Data; }
+
+private:
+    void Upload();
+
+    void UploadFloat();
+    void UploadCompressed();
+
+    MeshData m_Data;
+    MeshVertexFormat m_Format;
+
+    // Rango al que se cuantizan posiciones y UV en formato Compressed
+    glm::vec3 m_PositionMin{0.0f};
+    glm::vec3 m_PositionExtent{1.0f};
+    glm::vec2 m_TexCoordMin{0.0f};
+    glm::vec2 m_TexCoordExtent{1.0f};
+
+    std::unique_ptr<VertexArray> m_VAO;
+    // En formato Compressed m_VBO guarda las posiciones y m_AttributeVBO el resto
+    std::unique_ptr<VertexBuffer> m_VBO;
+    std::unique_ptr<VertexBuffer> m_AttributeVBO;
+    std::unique_ptr<IndexBuffer> m_IBO;
+};
@@ -0,0 +1,908 @@
+#include "MeshImporter.h"
+#include "MeshOptimizer.h"
+#include "MemoryTracker.h"
+#include "Profiler.h"
+#include "Log.h"
+
+#include <algorithm>
+#include <cctype>
+#include <climits>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <glm/gtc/matrix_transform.hpp>
+#include <sstream>
+
+namespace
+{
+    std::string GetExtension(const std::string& path)
+    {
+        const size_t dot = path.find_last_of('.');
+        if (dot == std::string::npos)
+            return {};
+
+        std::string extension = path.substr(dot + 1);
+        std::transform(extension.begin(), extension.end(), extension.begin(), [](unsigned char c) { return static_cast<char>(std::tolower(c)); });
+        return extension;
+    }
+
+    std::string GetDirectory(const std::string& path)
+    {
+        const size_t slash = path.find_last_of("/\\");
+        return slash == std::string::npos ? std::string() : path.substr(0, slash + 1);
+    }
+
+    std::string GetStem(const std::string& path)
+    {
+        const size_t slash = path.find_last_of("/\\");
+        std::string name = slash == std::string::npos ? path : path.substr(slash + 1);
+        const size_t dot = name.find_last_of('.');
+        return dot == std::string::npos ? name : name.substr(0, dot);
+    }
+
+    bool ReadBinaryFile(const std::string& path, std::vector<unsigned char>& out)
+    {
+        std::ifstream file(path, std::ios::binary | std::ios::ate);
+        if (!file.is_open())
+            return false;
+
+        const std::streamsize size = file.tellg();
+        file.seekg(0, std::ios::beg);
+        out.resize(static_cast<size_t>(size));
+        return static_cast<bool>(file.read(reinterpret_cast<char*>(out.data()), size));
+    }
+
+    // --- JSON mínimo para glTF ---
+
+    struct JsonValue
+    {
+        enum class Type { Null, Bool, Number, String, Array, Object };
+
+        Type type = Type::Null;
+        bool boolean = false;
+        double number = 0.0;
+        std::string string;
+        std::vector<JsonValue> items;
+        std::vector<std::string> keys; // Solo para objetos, en paralelo a 'items'
+
+        const JsonValue& operator[](const std::string& key) const
+        {
+            for (size_t i = 0; i < keys.size(); i++)
+                if (keys[i] == key)
+                    return items[i];
+            return Null();
+        }
+
+        const JsonValue& operator[](size_t index) const
+        {
+            return index < items.size() ? items[index] : Null();
+        }
+
+        bool IsNull() const { return type == Type::Null; }
+        size_t Size() const { return type == Type::Array ? items.size() : 0; }
+        double AsNumber(double fallback = 0.0) const { return type == Type::Number ? number : fallback; }
+        // Convertir a int un double fuera de rango es UB: esos valores (y NaN) dan 'fallback'
+        bool IsInt() const { return type == Type::Number && number >= static_cast<double>(INT_MIN) && number <= static_cast<double>(INT_MAX); }
+        int AsInt(int fallback = 0) const { return IsInt() ? static_cast<int>(number) : fallback; }
+        bool AsBool(bool fallback = false) const { return type == Type::Bool ? boolean : fallback; }
+
+        static const JsonValue& Null()
+        {
+            static const JsonValue null;
+            return null;
+        }
+    };
+
+    class JsonParser
+    {
+    public:
+        // Anidamiento máximo de objetos y arreglos: cada nivel es una llamada recursiva
+        static constexpr int MaxDepth = 256;
+
+        explicit JsonParser(const std::string& text) : m_Text(text) {}
+
+        bool Parse(JsonValue& out)
+        {
+            SkipWhitespace();
+            if (!ParseValue(out))
+                return false;
+            SkipWhitespace();
+            return m_Pos == m_Text.size();
+        }
+
+    private:
+        void SkipWhitespace()
+        {
+            while (m_Pos < m_Text.size() && std::isspace(static_cast<unsigned char>(m_Text[m_Pos])))
+                m_Pos++;
+        }
+
+        bool Consume(char c)
+        {
+            SkipWhitespace();
+            if (m_Pos < m_Text.size() && m_Text[m_Pos] == c)
+            {
+                m_Pos++;
+                return true;
+            }
+            return false;
+        }
+
+        bool ParseValue(JsonValue& out)
+        {
+            SkipWhitespace();
+            if (m_Pos >= m_Text.size())
+                return false;
+
+            const char c = m_Text[m_Pos];
+            if (c == '{' || c == '[')
+            {
+                if (m_Depth >= MaxDepth)
+                    return false;
+                m_Depth++;
+                const bool parsed = c == '{' ? ParseObject(out) : ParseArray(out);
+                m_Depth--;
+                return parsed;
+            }
+            if (c == '"')
+            {
+                out.type = JsonValue::Type::String;
+                return ParseString(out.string);
+            }
+            if (m_Text.compare(m_Pos, 4, "true") == 0)
+            {
+                out.type = JsonValue::Type::Bool;
+                out.boolean = true;
+                m_Pos += 4;
+                return true;
+            }
+            if (m_Text.compare(m_Pos, 5, "false") == 0)
+            {
+                out.type = JsonValue::Type::Bool;
+                m_Pos += 5;
+                return true;
+            }
+            if (m_Text.compare(m_Pos, 4, "null") == 0)
+            {
+                m_Pos += 4;
+                return true;
+            }
+            return ParseNumber(out);
+        }
+
+        bool ParseObject(JsonValue& out)
+        {
+            out.type = JsonValue::Type::Object;
+            m_Pos++;
+            if (Consume('}'))
+                return true;
+
+            do
+            {
+                SkipWhitespace();
+                std::string key;
+                if (!ParseString(key) || !Consume(':'))
+                    return false;
+
+                out.keys.push_back(std::move(key));
+                out.items.emplace_back();
+                if (!ParseValue(out.items.back()))
+                    return false;
+            } while (Consume(','));
+
+            return Consume('}');
+        }
+
+        bool ParseArray(JsonValue& out)
+        {
+            out.type = JsonValue::Type::Array;
+            m_Pos++;
+            if (Consume(']'))
+                return true;
+
+            do
+            {
+                out.items.emplace_back();
+                if (!ParseValue(out.items.back()))
+                    return false;
+            } while (Consume(','));
+
+            return Consume(']');
+        }
+
+        bool ParseString(std::string& out)
+        {
+            if (m_Pos >= m_Text.size() || m_Text[m_Pos] != '"')
+                return false;
+            m_Pos++;
+
+            while (m_Pos < m_Text.size())
+            {
+                const char c = m_Text[m_Pos++];
+                if (c == '"')
+                    return true;
+                if (c != '\\')
+                {
+                    out += c;
+                    continue;
+                }
+                if (m_Pos >= m_Text.size())
+                    return false;
+
+                const char escaped = m_Text[m_Pos++];
+                switch (escaped)
+                {
+                    case 'b': out += '\b'; break;
+                    case 'f': out += '\f'; break;
+                    case 'n': out += '\n'; break;
+                    case 'r': out += '\r'; break;
+                    case 't': out += '\t'; break;
+                    case 'u':
+                    {
+                        if (m_Pos + 4 > m_Text.size())
+                            return false;
+                        const auto code = static_cast<unsigned int>(std::strtoul(m_Text.substr(m_Pos, 4).c_str(), nullptr, 16));
+                        m_Pos += 4;
+                        // Las URIs de glTF solo necesitan el plano básico en UTF-8
+                        if (code < 0x80)
+                        {
+                            out += static_cast<char>(code);
+                        }
+                        else if (code < 0x800)
+                        {
+                            out += static_cast<char>(0xC0 | (code >> 6));
+                            out += static_cast<char>(0x80 | (code & 0x3F));
+                        }
+                        else
+                        {
+                            out += static_cast<char>(0xE0 | (code >> 12));
+                            out += static_cast<char>(0x80 | ((code >> 6) & 0x3F));
+                            out += static_cast<char>(0x80 | (code & 0x3F));
+                        }
+                        break;
+                    }
+                    default: out += escaped; break;
+                }
+            }
+            return false;
+        }
+
+        bool ParseNumber(JsonValue& out)
+        {
+            const char* begin = m_Text.c_str() + m_Pos;
+            char* end = nullptr;
+            out.number = std::strtod(begin, &end);
+            if (end == begin)
+                return false;
+
+            out.type = JsonValue::Type::Number;
+            m_Pos += static_cast<size_t>(end - begin);
+            return true;
+        }
+
+        const std::string& m_Text;
+        size_t m_Pos = 0;
+        int m_Depth = 0;
+    };
+
+    bool DecodeBase64(const std::string& input, std::vector<unsigned char>& out)
+    {
+        auto decode = [](char c) -> int
+        {
+            if (c >= 'A' && c <= 'Z') return c - 'A';
+            if (c >= 'a' && c <= 'z') return c - 'a' + 26;
+            if (c >= '0' && c <= '9') return c - '0' + 52;
+            if (c == '+') return 62;
+            if (c == '/') return 63;
+            return -1;
+        };
+
+        unsigned int buffer = 0;
+        int bits = 0;
+        for (const char c : input)
+        {
+            if (c == '=')
+                break;
+            const int value = decode(c);
+            if (value < 0)
+                return false;
+
+            buffer = (buffer << 6) | static_cast<unsigned int>(value);
+            bits += 6;
+            if (bits >= 8)
+            {
+                bits -= 8;
+                out.push_back(static_cast<unsigned char>((buffer >> bits) & 0xFF));
+            }
+        }
+        return true;
+    }
+
+    // --- Lectura de accessors glTF ---
+
+    struct GLTFContext
+    {
+        JsonValue Document;
+        std::vector<std::vector<unsigned char>> Buffers;
+        bool MissingNormals = false;
+    };
+
+    int ComponentCount(const std::string& type)
+    {
+        if (type == "SCALAR") return 1;
+        if (type == "VEC2") return 2;
+        if (type == "VEC3") return 3;
+        if (type == "VEC4") return 4;
+        if (type == "MAT4") return 16;
+        return 0;
+    }
+
+    size_t ComponentSize(int componentType)
+    {
+        switch (componentType)
+        {
+            case 5120: case 5121: return 1;  // BYTE, UNSIGNED_BYTE
+            case 5122: case 5123: return 2;  // SHORT, UNSIGNED_SHORT
+            case 5125: case 5126: return 4;  // UNSIGNED_INT, FLOAT
+            default: return 0;
+        }
+    }
+
+    double ReadComponent(const unsigned char* data, int componentType, bool normalized)
+    {
+        switch (componentType)
+        {
+            case 5120: { int8_t v; std::memcpy(&v, data, 1); return normalized ? std::max(v / 127.0, -1.0) : v; }
+            case 5121: { uint8_t v; std::memcpy(&v, data, 1); return normalized ? v / 255.0 : v; }
+            case 5122: { int16_t v; std::memcpy(&v, data, 2); return normalized ? std::max(v / 32767.0, -1.0) : v; }
+            case 5123: { uint16_t v; std::memcpy(&v, data, 2); return normalized ? v / 65535.0 : v; }
+            case 5125: { uint32_t v; std::memcpy(&v, data, 4); return v; }
+            case 5126: { float v; std::memcpy(&v, data, 4); return v; }
+            default: return 0.0;
+        }
+    }
+
+    // Elementos como máximo de un accessor sin bufferView (todo ceros)
+    constexpr size_t MaxUnbackedCount = size_t{1} << 24;
+
+    // Devuelve los elementos del accessor como doubles, 'outComponents' por elemento
+    bool ReadAccessor(const GLTFContext& context, int accessorIndex, std::vector<double>& out, int& outComponents)
+    {
+        const JsonValue& accessor = context.Document["accessors"][static_cast<size_t>(accessorIndex)];
+        if (accessor.IsNull())
+            return false;
+
+        const int componentType = accessor["componentType"].AsInt();
+        const size_t componentSize = ComponentSize(componentType);
+        // 'count' es obligatorio: si falta o no cabe en un int se rechaza como negativo
+        const int countValue = accessor["count"].AsInt(-1);
+        const bool normalized = accessor["normalized"].AsBool();
+        outComponents = ComponentCount(accessor["type"].string);
+
+        if (componentSize == 0 || outComponents == 0)
+            return false;
+
+        // Un valor negativo convertido a size_t sería un tamaño enorme
+        if (countValue < 0)
+        {
+            LOG_ERROR("Mesh", "glTF: accessor {} has a negative or invalid count", accessorIndex);
+            return false;
+        }
+        const auto count = static_cast<size_t>(countValue);
+
+        if (!accessor["sparse"].IsNull())
+            LOG_WARNING("Mesh", "glTF: sparse accessors are not supported, using base values");
+
+        // Un accessor sin bufferView se inicializa a ceros según la especificación. Sin búfer no hay
+        // tamaño con el que comparar 'count': se limita para no reservar memoria sin fin.
+        if (accessor["bufferView"].IsNull())
+        {
+            if (count > MaxUnbackedCount)
+            {
+                LOG_ERROR("Mesh", "glTF: accessor {} without bufferView has too many elements", accessorIndex);
+                return false;
+            }
+            out.assign(count * static_cast<size_t>(outComponents), 0.0);
+            return true;
+        }
+
+        const JsonValue& view = context.Document["bufferViews"][static_cast<size_t>(accessor["bufferView"].AsInt())];
+        const auto bufferIndex = static_cast<size_t>(view["buffer"].AsInt());
+        if (view.IsNull() || bufferIndex >= context.Buffers.size())
+            return false;
+
+        const std::vector<unsigned char>& buffer = context.Buffers[bufferIndex];
+        // Ausente: el valor por defecto; presente pero sin ser un int válido: -1, que se rechaza abajo
+        auto optionalInt = [](const JsonValue& value, int fallback) { return value.IsNull() ? fallback : value.AsInt(-1); };
+        const int viewOffset = optionalInt(view["byteOffset"], 0);
+        const int accessorOffset = optionalInt(accessor["byteOffset"], 0);
+        const size_t elementSize = componentSize * static_cast<size_t>(outComponents);
+        const int strideValue = optionalInt(view["byteStride"], static_cast<int>(elementSize));
+        if (viewOffset < 0 || accessorOffset < 0 || strideValue < 0)
+        {
+            LOG_ERROR("Mesh", "glTF: accessor {} has a negative or invalid offset or stride", accessorIndex);
+            return false;
+        }
+
+        // Comprobación antes de reservar 'out', sin desbordar size_t: un count enorme se rechaza
+        // aquí en vez de agotar la memoria. Un stride menor que el elemento solapa los elementos.
+        const size_t offset = static_cast<size_t>(viewOffset) + static_cast<size_t>(accessorOffset);
+        const auto stride = static_cast<size_t>(strideValue);
+        if (stride < elementSize)
+        {
+            LOG_ERROR("Mesh", "glTF: accessor {} has a byteStride smaller than its elements", accessorIndex);
+            return false;
+        }
+        if (count > 0 && (offset > buffer.size() || elementSize > buffer.size() - offset ||
+                          count - 1 > (buffer.size() - offset - elementSize) / stride))
+        {
+            LOG_ERROR("Mesh", "glTF: accessor {} is out of buffer bounds", accessorIndex);
+            return false;
+        }
+
+        out.assign(count * static_cast<size_t>(outComponents), 0.0);
+
+        for (size_t i = 0; i < count; i++)
+        {
+            const unsigned char* element = buffer.data() + offset + stride * i;
+            for (int c = 0; c < outComponents; c++)
+                out[i * outComponents + c] = ReadComponent(element + componentSize * c, componentType, normalized);
+        }
+        return true;
+    }
+
+    glm::mat4 NodeTransform(const JsonValue& node)
+    {
+        glm::mat4 transform(1.0f);
+
+        const JsonValue& matrix = node["matrix"];
+        if (matrix.Size() == 16)
+        {
+            for (int column = 0; column < 4; column++)
+                for (int row = 0; row < 4; row++)
+                    transform[column][row] = static_cast<float>(matrix[static_cast<size_t>(column * 4 + row)].AsNumber());
+            return transform;
+        }
+
+        const JsonValue& t = node["translation"];
+        const JsonValue& r = node["rotation"];
+        const JsonValue& s = node["scale"];
+
+        if (t.Size() == 3)
+            transform = glm::translate(transform, glm::vec3(static_cast<float>(t[0].AsNumber()), static_cast<float>(t[1].AsNumber()), static_cast<float>(t[2].AsNumber())));
+
+        if (r.Size() == 4)
+        {
+            // Cuaternión (x, y, z, w) a matriz de rotación
+            const auto x = static_cast<float>(r[0].AsNumber());
+            const auto y = static_cast<float>(r[1].AsNumber());
+            const auto z = static_cast<float>(r[2].AsNumber());
+            const auto w = static_cast<float>(r[3].AsNumber(1.0));
+
+            glm::mat4 rotation(1.0f);
+            rotation[0][0] = 1.0f - 2.0f * (y * y + z * z);
+            rotation[0][1] = 2.0f * (x * y + z * w);
+            rotation[0][2] = 2.0f * (x * z - y * w);
+            rotation[1][0] = 2.0f * (x * y - z * w);
+            rotation[1][1] = 1.0f - 2.0f * (x * x + z * z);
+            rotation[1][2] = 2.0f * (y * z + x * w);
+            rotation[2][0] = 2.0f * (x * z + y * w);
+            rotation[2][1] = 2.0f * (y * z - x * w);
+            rotation[2][2] = 1.0f - 2.0f * (x * x + y * y);
+            transform = transform * rotation;
+        }
+
+        if (s.Size() == 3)
+            transform = glm::scale(transform, glm::vec3(static_cast<float>(s[0].AsNumber(1.0)), static_cast<float>(s[1].AsNumber(1.0)), static_cast<float>(s[2].AsNumber(1.0))));
+
+        return transform;
+    }
+
+    void AppendPrimitive(GLTFContext& context, const JsonValue& primitive, const glm::mat4& transform, MeshData& outData)
+    {
+        if (primitive["mode"].AsInt(4) != 4)
+        {
+            LOG_WARNING("Mesh", "glTF: skipping primitive with non-triangle mode");
+            return;
+        }
+
+        const JsonValue& attributes = primitive["attributes"];
+        std::vector<double> positions, normals, texCoords, colors;
+        int positionComponents = 0, normalComponents = 0, texCoordComponents = 0, colorComponents = 0;
+
+        if (attributes["POSITION"].IsNull() || !ReadAccessor(context, attributes["POSITION"].AsInt(), positions, positionComponents) || positionComponents != 3)
+        {
+            LOG_WARNING("Mesh", "glTF: skipping primitive without valid POSITION attribute");
+            return;
+        }
+
+        bool hasNormals = !attributes["NORMAL"].IsNull() && ReadAccessor(context, attributes["NORMAL"].AsInt(), normals, normalComponents) && normalComponents == 3;
+        bool hasTexCoords = !attributes["TEXCOORD_0"].IsNull() && ReadAccessor(context, attributes["TEXCOORD_0"].AsInt(), texCoords, texCoordComponents) && texCoordComponents == 2;
+        bool hasColors = !attributes["COLOR_0"].IsNull() && ReadAccessor(context, attributes["COLOR_0"].AsInt(), colors, colorComponents) && colorComponents >= 3;
+
+        // Los atributos se leen por índice de vértice: uno con otro número de elementos se ignora
+        const size_t vertexCount = positions.size() / 3;
+        const auto matchesVertexCount = [vertexCount](bool present, const std::vector<double>& values, int components, const char* name)
+        {
+            if (present && values.size() != vertexCount * static_cast<size_t>(components))
+            {
+                LOG_WARNING("Mesh", "glTF: ignoring {} attribute whose count does not match POSITION", name);
+                return false;
+            }
+            return present;
+        };
+        hasNormals = matchesVertexCount(hasNormals, normals, normalComponents, "NORMAL");
+        hasTexCoords = matchesVertexCount(hasTexCoords, texCoords, texCoordComponents, "TEXCOORD_0");
+        hasColors = matchesVertexCount(hasColors, colors, colorComponents, "COLOR_0");
+        context.MissingNormals |= !hasNormals;
+
+        const glm::mat3 normalMatrix = glm::transpose(glm::inverse(glm::mat3(transform)));
+        const auto baseVertex = static_cast<unsigned int>(outData.Vertices.size());
+
+        for (size_t i = 0; i < vertexCount; i++)
+        {
+            MeshVertex vertex{};
+            const glm::vec4 position = transform * glm::vec4(static_cast<float>(positions[i * 3]), static_cast<float>(positions[i * 3 + 1]), static_cast<float>(positions[i * 3 + 2]), 1.0f);
+            vertex.Position = glm::vec3(position);
+            vertex.Color = glm::vec3(1.0f);
+
+            if (hasNormals)
+                vertex.Normal = glm::normalize(normalMatrix * glm::vec3(static_cast<float>(normals[i * 3]), static_cast<float>(normals[i * 3 + 1]), static_cast<float>(normals[i * 3 + 2])));
+            if (hasTexCoords)
+                vertex.TexCoord = glm::vec2(static_cast<float>(texCoords[i * 2]), static_cast<float>(texCoords[i * 2 + 1]));
+            if (hasColors)
+                vertex.Color = glm::vec3(static_cast<float>(colors[i * colorComponents]), static_cast<float>(colors[i * colorComponents + 1]), static_cast<float>(colors[i * colorComponents + 2]));
+
+            outData.Vertices.push_back(vertex);
+        }
+
+        if (!primitive["indices"].IsNull())
+        {
+            std::vector<double> indices;
+            int indexComponents = 0;
+            if (!ReadAccessor(context, primitive["indices"].AsInt(), indices, indexComponents))
+                return;
+
+            for (size_t i = 0; i + 2 < indices.size(); i += 3)
+            {
+                const auto a = static_cast<unsigned int>(indices[i]);
+                const auto b = static_cast<unsigned int>(indices[i + 1]);
+                const auto c = static_cast<unsigned int>(indices[i + 2]);
+                if (a >= vertexCount || b >= vertexCount || c >= vertexCount)
+                    continue;
+
+                outData.Indices.insert(outData.Indices.end(), { baseVertex + a, baseVertex + b, baseVertex + c });
+            }
+        }
+        else
+        {
+            for (size_t i = 0; i + 2 < vertexCount; i += 3)
+                outData.Indices.insert(outData.Indices.end(), { baseVertex + static_cast<unsigned int>(i), baseVertex + static_cast<unsigned int>(i + 1), baseVertex + static_cast<unsigned int>(i + 2) });
+        }
+    }
+
+    void ProcessNode(GLTFContext& context, int nodeIndex, const glm::mat4& parentTransform, MeshData& outData, int depth)
+    {
+        const JsonValue& node = context.Document["nodes"][static_cast<size_t>(nodeIndex)];
+        if (node.IsNull() || depth > 64)
+            return;
+
+        const glm::mat4 transform = parentTransform * NodeTransform(node);
+
+        if (!node["mesh"].IsNull())
+        {
+            const JsonValue& mesh = context.Document["meshes"][static_cast<size_t>(node["mesh"].AsInt())];
+            for (const JsonValue& primitive : mesh["primitives"].items)
+                AppendPrimitive(context, primitive, transform, outData);
+        }
+
+        for (const JsonValue& child : node["children"].items)
+            ProcessNode(context, child.AsInt(), transform, outData, depth + 1);
+    }
+}
+
+bool MeshImporter::Load(const std::string& path, MeshData& outData)
+{
+    PROFILE_SCOPE("MeshImporter::Load");
+    MEMORY_TAG(Mesh);
+
+    const std::string extension = GetExtension(path);
+
+    bool loaded = false;
+    if (extension == "obj")
+    {
+        loaded = LoadOBJ(path, outData);
+    }
+    else if (extension == "gltf" || extension == "glb")
+    {
+        loaded = LoadGLTF(path, outData);
+    }
+    else
+    {
+        LOG_ERROR("Mesh", "Unsupported mesh format: {}", path);
+        return false;
+    }
+
+    if (loaded && outData.Name.empty())
+        outData.Name = GetStem(path);
+
+    return loaded;
+}
+
+bool MeshImporter::LoadOBJ(const std::string& path, MeshData& outData)
+{
+    std::ifstream file(path);
+    if (!file.is_open())
+    {
+        LOG_ERROR("Mesh", "Failed to open mesh: {}", path);
+        return false;
+    }
+
+    std::vector<glm::vec3> positions;
+    std::vector<glm::vec3> colors;
+    std::vector<glm::vec3> normals;
+    std::vector<glm::vec2> texCoords;
+    bool missingNormals = false;
+
+    // Resuelve índices OBJ (base 1, negativos relativos al final)
+    auto resolve = [](long index, size_t count) -> long
+    {
+        if (index > 0)
+            return index - 1;
+        if (index < 0)
+            return static_cast<long>(count) + index;
+        return -1;
+    };
+
+    std::string line;
+    std::vector<MeshVertex> face;
+    while (std::getline(file, line))
+    {
+        std::istringstream stream(line);
+        std::string keyword;
+        stream >> keyword;
+
+        if (keyword == "v")
+        {
+            glm::vec3 position(0.0f);
+            glm::vec3 color(1.0f);
+            stream >> position.x >> position.y >> position.z;
+            // Extensión común: "v x y z r g b"
+            if (!(stream >> color.x >> color.y >> color.z))
+                color = glm::vec3(1.0f);
+
+            positions.push_back(position);
+            colors.push_back(color);
+        }
+        else if (keyword == "vn")
+        {
+            glm::vec3 normal(0.0f);
+            stream >> normal.x >> normal.y >> normal.z;
+            normals.push_back(normal);
+        }
+        else if (keyword == "vt")
+        {
+            glm::vec2 texCoord(0.0f);
+            stream >> texCoord.x >> texCoord.y;
+            texCoords.push_back(texCoord);
+        }
+        else if (keyword == "o" && outData.Name.empty())
+        {
+            stream >> outData.Name;
+        }
+        else if (keyword == "f")
+        {
+            face.clear();
+
+            std::string corner;
+            while (stream >> corner)
+            {
+                long v = 0, vt = 0, vn = 0;
+                const char* cursor = corner.c_str();
+                char* end = nullptr;
+
+                v = std::strtol(cursor, &end, 10);
+                if (*end == '/')
+                {
+                    cursor = end + 1;
+                    if (*cursor != '/')
+                        vt = std::strtol(cursor, &end, 10);
+                    else
+                        end = const_cast<char*>(cursor);
+
+                    if (*end == '/')
+                        vn = std::strtol(end + 1, &end, 10);
+                }
+
+                const long positionIndex = resolve(v, positions.size());
+                if (positionIndex < 0 || static_cast<size_t>(positionIndex) >= positions.size())
+                    continue;
+
+                MeshVertex vertex{};
+                vertex.Position = positions[static_cast<size_t>(positionIndex)];
+                vertex.Color = colors[static_cast<size_t>(positionIndex)];
+
+                const long texCoordIndex = resolve(vt, texCoords.size());
+                if (texCoordIndex >= 0 && static_cast<size_t>(texCoordIndex) < texCoords.size())
+                    vertex.TexCoord = texCoords[static_cast<size_t>(texCoordIndex)];
+
+                const long normalIndex = resolve(vn, normals.size());
+                if (normalIndex >= 0 && static_cast<size_t>(normalIndex) < normals.size())
+                    vertex.Normal = normals[static_cast<size_t>(normalIndex)];
+                else
+                    missingNormals = true;
+
+                face.push_back(vertex);
+            }
+
+            // Triangulación en abanico de polígonos convexos
+            for (size_t i = 2; i < face.size(); i++)
+            {
+                const auto base = static_cast<unsigned int>(outData.Vertices.size());
+                outData.Vertices.push_back(face[0]);
+                outData.Vertices.push_back(face[i - 1]);
+                outData.Vertices.push_back(face[i]);
+                outData.Indices.insert(outData.Indices.end(), { base, base + 1, base + 2 });
+            }
+        }
+    }
+
+    if (outData.Indices.empty())
+    {
+        LOG_ERROR("Mesh", "Mesh has no faces: {}", path);
+        return false;
+    }
+
+    // Sin normales en el archivo: se fusionan primero los vértices compartidos
+    // para que las normales calculadas salgan suaves y no facetadas
+    if (missingNormals)
+    {
+        MeshOptimizer::DeduplicateVertices(outData);
+        ComputeNormals(outData);
+    }
+
+    return true;
+}
+
+bool MeshImporter::LoadGLTF(const std::string& path, MeshData& outData)
+{
+    std::vector<unsigned char> file;
+    if (!ReadBinaryFile(path, file))
+    {
+        LOG_ERROR("Mesh", "Failed to open mesh: {}", path);
+        return false;
+    }
+
+    GLTFContext context;
+    std::string json;
+    std::vector<unsigned char> binaryChunk;
+
+    // GLB: cabecera de 12 bytes seguida de un chunk JSON y un chunk BIN opcional
+    if (file.size() >= 12 && std::memcmp(file.data(), "glTF", 4) == 0)
+    {
+        size_t offset = 12;
+        while (offset + 8 <= file.size())
+        {
+            uint32_t chunkLength = 0, chunkType = 0;
+            std::memcpy(&chunkLength, file.data() + offset, 4);
+            std::memcpy(&chunkType, file.data() + offset + 4, 4);
+            offset += 8;
+
+            if (offset + chunkLength > file.size())
+                break;
+
+            if (chunkType == 0x4E4F534A)
+                json.assign(reinterpret_cast<const char*>(file.data() + offset), chunkLength);
+            else if (chunkType == 0x004E4942)
+                binaryChunk.assign(file.begin() + static_cast<long>(offset), file.begin() + static_cast<long>(offset + chunkLength));
+
+            offset += chunkLength;
+        }
+    }
+    else
+    {
+        json.assign(file.begin(), file.end());
+    }
+
+    if (!JsonParser(json).Parse(context.Document))
+    {
+        LOG_ERROR("Mesh", "Failed to parse glTF: {}", path);
+        return false;
+    }
+
+    const std::string directory = GetDirectory(path);
+    for (const JsonValue& buffer : context.Document["buffers"].items)
+    {
+        std::vector<unsigned char> data;
+        const std::string& uri = buffer["uri"].string;
+
+        if (uri.empty())
+        {
+            data = binaryChunk;
+        }
+        else if (uri.compare(0, 5, "data:") == 0)
+        {
+            const size_t comma = uri.find(',');
+            if (comma == std::string::npos || !DecodeBase64(uri.substr(comma + 1), data))
+                LOG_ERROR("Mesh", "glTF: failed to decode embedded buffer");
+        }
+        else if (!ReadBinaryFile(directory + uri, data))
+        {
+            LOG_ERROR("Mesh", "glTF: failed to read buffer {}", directory + uri);
+        }
+
+        context.Buffers.push_back(std::move(data));
+    }
+
+    const JsonValue& scenes = context.Document["scenes"];
+    if (scenes.Size() > 0)
+    {
+        const JsonValue& scene = scenes[static_cast<size_t>(context.Document["scene"].AsInt(0))];
+        for (const JsonValue& node : scene["nodes"].items)
+            ProcessNode(context, node.AsInt(), glm::mat4(1.0f), outData, 0);
+    }
+    else
+    {
+        // Sin escenas: se importan todas las mallas sin transformar
+        for (const JsonValue& mesh : context.Document["meshes"].items)
+            for (const JsonValue& primitive : mesh["primitives"].items)
+                AppendPrimitive(context, primitive, glm::mat4(1.0f), outData);
+    }
+
+    if (outData.Indices.empty())
+    {
+        LOG_ERROR("Mesh", "glTF has no triangle geometry: {}", path);
+        return false;
+    }
+
+    if (context.MissingNormals)
+        ComputeNormals(outData);
+
+    return true;
+}
+
+MeshData MeshImporter::FromPositionsAndColors(const std::vector<float>& vertices, const std::vector<unsigned int>& indices)
+{
+    MeshData data;
+    data.Vertices.reserve(vertices.size() / 6);
+
+    for (size_t i = 0; i + 5 < vertices.size(); i += 6)
+    {
+        MeshVertex vertex{};
+        vertex.Position = glm::vec3(vertices[i], vertices[i + 1], vertices[i + 2]);
+        vertex.Color = glm::vec3(vertices[i + 3], vertices[i + 4], vertices[i + 5]);
+        data.Vertices.push_back(vertex);
+    }
+
+    data.Indices = indices;
+    ComputeNormals(data);
+    return data;
+}
+
+void MeshImporter::ComputeNormals(MeshData& data)
+{
+    // Normales suaves ponderadas por área; sustituye las que falten o sean nulas
+    std::vector<glm::vec3> accumulated(data.Vertices.size(), glm::vec3(0.0f));
+
+    for (size_t i = 0; i + 2 < data.Indices.size(); i += 3)
+    {
+        const glm::vec3& a = data.Vertices[data.Indices[i]].Position;
+        const glm::vec3& b = data.Vertices[data.Indices[i + 1]].Position;
+        const glm::vec3& c = data.Vertices[data.Indices[i + 2]].Position;
+        const glm::vec3 normal = glm::cross(b - a, c - a);
+
+        accumulated[data.Indices[i]] += normal;
+        accumulated[data.Indices[i + 1]] += normal;
+        accumulated[data.Indices[i + 2]] += normal;
+    }
+
+    for (size_t i = 0; i < data.Vertices.size(); i++)
+    {
+        if (glm::dot(data.Vertices[i].Normal, data.Vertices[i].Normal) > 0.0f)
+            continue;
+
+        const float length = glm::length(accumulated[i]);
+        data.Vertices[i].Normal = length > 0.0f ? accumulated[i] / length : glm::vec3(0.0f, 1.0f, 0.0f);
+    }
+}
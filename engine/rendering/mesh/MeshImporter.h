@@ -0,0 +1,23 @@
+#pragma once
+
+#include <string>
+#include <vector>
+
+#include "Mesh.h"
+
+// Importadores de geometría. Todos devuelven vértices sin optimizar;
+// el pipeline de MeshOptimizer se aplica después.
+class MeshImporter
+{
+public:
+    // Elige el importador según la extensión (.obj, .gltf, .glb)
+    static bool Load(const std::string& path, MeshData& outData);
+
+    static bool LoadOBJ(const std::string& path, MeshData& outData);
+    static bool LoadGLTF(const std::string& path, MeshData& outData);
+
+    // Convierte datos intercalados posición/color (como los del cubo) a MeshData
+    static MeshData FromPositionsAndColors(const std::vector<float>& vertices, const std::vector<unsigned int>& indices);
+
+    static void ComputeNormals(MeshData& data);
+};
@@ -0,0 +1,516 @@
+#include "MeshOptimizer.h"
+#include "MeshSimplifier.h"
+#include "MemoryTracker.h"
+#include "Profiler.h"
+#include "Log.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <numeric>
+#include <unordered_map>
+
+namespace
+{
+    // Parámetros del algoritmo "Linear-Speed Vertex Cache Optimisation" de Tom Forsyth
+    constexpr unsigned int ForsythCacheSize = 32;
+    constexpr float ForsythCacheDecayPower = 1.5f;
+    constexpr float ForsythLastTriangleScore = 0.75f;
+    constexpr float ForsythValenceBoostScale = 2.0f;
+    constexpr float ForsythValenceBoostPower = 0.5f;
+
+    // Degradación máxima del ACMR que se acepta al partir clusters para el overdraw
+    constexpr float OverdrawThreshold = 1.05f;
+
+    float ForsythVertexScore(int cachePosition, unsigned int remainingTriangles)
+    {
+        if (remainingTriangles == 0)
+            return -1.0f;
+
+        float score = 0.0f;
+        if (cachePosition >= 0)
+        {
+            if (cachePosition < 3)
+            {
+                score = ForsythLastTriangleScore;
+            }
+            else
+            {
+                const float scaler = 1.0f / static_cast<float>(ForsythCacheSize - 3);
+                score = std::pow(1.0f - static_cast<float>(cachePosition - 3) * scaler, ForsythCacheDecayPower);
+            }
+        }
+
+        score += ForsythValenceBoostScale * std::pow(static_cast<float>(remainingTriangles), -ForsythValenceBoostPower);
+        return score;
+    }
+
+    struct VertexHasher
+    {
+        size_t operator()(const MeshVertex& vertex) const
+        {
+            // FNV-1a sobre los bytes del vértice (MeshVertex no tiene relleno)
+            const auto* bytes = reinterpret_cast<const unsigned char*>(&vertex);
+            size_t hash = 14695981039346656037ull;
+            for (size_t i = 0; i < sizeof(MeshVertex); i++)
+            {
+                hash ^= bytes[i];
+                hash *= 1099511628211ull;
+            }
+            return hash;
+        }
+    };
+
+    struct VertexEqual
+    {
+        bool operator()(const MeshVertex& a, const MeshVertex& b) const
+        {
+            return std::memcmp(&a, &b, sizeof(MeshVertex)) == 0;
+        }
+    };
+}
+
+void MeshOptimizer::Optimize(MeshData& mesh)
+{
+    PROFILE_SCOPE("MeshOptimizer::Optimize");
+    MEMORY_TAG(Mesh);
+
+    if (mesh.Indices.empty())
+        return;
+
+    const auto importedVertexCount = static_cast<unsigned int>(mesh.Vertices.size());
+
+    DeduplicateVertices(mesh);
+
+    const VertexCacheStatistics before = AnalyzeVertexCache(mesh.Indices, mesh.Vertices.size());
+
+    OptimizeVertexCache(mesh.Indices, mesh.Vertices.size());
+    OptimizeOverdraw(mesh.Indices, mesh.Vertices);
+
+    // El reordenado de vértices posterior es un renombrado, no cambia el ACMR del LOD 0
+    const VertexCacheStatistics after = AnalyzeVertexCache(mesh.Indices, mesh.Vertices.size());
+    const auto triangleCount = static_cast<unsigned int>(mesh.Indices.size() / 3);
+
+    ComputeBounds(mesh);
+    ComputeUVDensity(mesh);
+    // Los meshlets se cortan sobre el orden final del LOD 0, que ocupa el inicio del índice
+    mesh.Meshlets = MeshletBuilder::Build(mesh.Vertices, mesh.Indices, 0, static_cast<unsigned int>(mesh.Indices.size()));
+    GenerateLODs(mesh);
+    OptimizeVertexFetch(mesh);
+
+    mesh.Stats.ImportedVertexCount = importedVertexCount;
+    mesh.Stats.VertexCount = static_cast<unsigned int>(mesh.Vertices.size());
+    mesh.Stats.TriangleCount = triangleCount;
+    mesh.Stats.ACMRBefore = before.ACMR;
+    mesh.Stats.ACMRAfter = after.ACMR;
+    mesh.Stats.ATVRBefore = before.ATVR;
+    mesh.Stats.ATVRAfter = after.ATVR;
+
+    LOG_INFO("Mesh", "Mesh '{}': {} -> {} vertices, {} triangles, ACMR {} -> {}, ATVR {} -> {}, {} meshlets", mesh.Name,
+             importedVertexCount, mesh.Stats.VertexCount, mesh.Stats.TriangleCount, before.ACMR, after.ACMR, before.ATVR, after.ATVR,
+             mesh.Meshlets.size());
+
+    for (size_t i = 1; i < mesh.LODs.size(); i++)
+        LOG_INFO("Mesh", "  LOD {}: {} triangles, error {}", i, mesh.LODs[i].IndexCount / 3, mesh.LODs[i].Error);
+}
+
+void MeshOptimizer::ComputeBounds(MeshData& mesh)
+{
+    if (mesh.Vertices.empty())
+        return;
+
+    glm::vec3 minimum = mesh.Vertices[0].Position;
+    glm::vec3 maximum = mesh.Vertices[0].Position;
+    for (const MeshVertex& vertex : mesh.Vertices)
+    {
+        minimum = glm::min(minimum, vertex.Position);
+        maximum = glm::max(maximum, vertex.Position);
+    }
+
+    mesh.BoundsCenter = (minimum + maximum) * 0.5f;
+    mesh.BoundsRadius = 0.0f;
+    for (const MeshVertex& vertex : mesh.Vertices)
+        mesh.BoundsRadius = std::max(mesh.BoundsRadius, glm::distance(mesh.BoundsCenter, vertex.Position));
+}
+
+void MeshOptimizer::ComputeUVDensity(MeshData& mesh)
+{
+    // Relación media entre área en UV y área en el objeto, sumada sobre todos los triángulos
+    double uvArea = 0.0, objectArea = 0.0;
+    for (size_t i = 0; i + 2 < mesh.Indices.size(); i += 3)
+    {
+        const MeshVertex& a = mesh.Vertices[mesh.Indices[i]];
+        const MeshVertex& b = mesh.Vertices[mesh.Indices[i + 1]];
+        const MeshVertex& c = mesh.Vertices[mesh.Indices[i + 2]];
+
+        const glm::vec2 uv0 = b.TexCoord - a.TexCoord;
+        const glm::vec2 uv1 = c.TexCoord - a.TexCoord;
+        uvArea += std::abs(uv0.x * uv1.y - uv0.y * uv1.x) * 0.5;
+        objectArea += glm::length(glm::cross(b.Position - a.Position, c.Position - a.Position)) * 0.5;
+    }
+
+    if (uvArea > 0.0 && objectArea > 0.0)
+        mesh.UVDensity = static_cast<float>(std::sqrt(uvArea / objectArea));
+    else if (mesh.BoundsRadius > 0.0f)
+        // Sin UVs se supone que la textura cubre el objeto una vez
+        mesh.UVDensity = 1.0f / (2.0f * mesh.BoundsRadius);
+}
+
+void MeshOptimizer::GenerateLODs(MeshData& mesh)
+{
+    PROFILE_SCOPE("MeshOptimizer::GenerateLODs");
+
+    // Se asume que 'Indices' contiene solo el LOD 0
+    std::vector<std::vector<unsigned int>> levels;
+    std::vector<float> errors;
+    levels.push_back(mesh.Indices);
+    errors.push_back(0.0f);
+
+    const float maxError = mesh.BoundsRadius * LODMaxError;
+
+    while (levels.size() < MaxLODCount)
+    {
+        const float remainingError = maxError - errors.back();
+        if (remainingError <= 0.0f)
+            break;
+
+        const std::vector<unsigned int>& previous = levels.back();
+        const size_t target = static_cast<size_t>(static_cast<float>(previous.size() / 3) * LODReduction) * 3;
+
+        // Cada nivel parte del anterior, así que los errores se acumulan
+        float error = 0.0f;
+        std::vector<unsigned int> simplified = MeshSimplifier::Simplify(mesh.Vertices, previous, target, remainingError, &error);
+
+        // Si el límite de error impide una reducción apreciable, la cadena termina aquí
+        if (simplified.empty() || static_cast<float>(simplified.size()) > static_cast<float>(previous.size()) * 0.9f)
+            break;
+
+        OptimizeVertexCache(simplified, mesh.Vertices.size());
+        errors.push_back(errors.back() + error);
+        levels.push_back(std::move(simplified));
+    }
+
+    mesh.Indices.clear();
+    mesh.LODs.clear();
+    for (size_t i = 0; i < levels.size(); i++)
+    {
+        mesh.LODs.push_back({ static_cast<unsigned int>(mesh.Indices.size()), static_cast<unsigned int>(levels[i].size()), errors[i] });
+        mesh.Indices.insert(mesh.Indices.end(), levels[i].begin(), levels[i].end());
+    }
+}
+
+void MeshOptimizer::DeduplicateVertices(MeshData& mesh)
+{
+    std::unordered_map<MeshVertex, unsigned int, VertexHasher, VertexEqual> uniqueVertices;
+    uniqueVertices.reserve(mesh.Vertices.size());
+
+    std::vector<MeshVertex> vertices;
+    vertices.reserve(mesh.Vertices.size());
+
+    std::vector<unsigned int> remap(mesh.Vertices.size());
+    for (size_t i = 0; i < mesh.Vertices.size(); i++)
+    {
+        const auto [it, inserted] = uniqueVertices.emplace(mesh.Vertices[i], static_cast<unsigned int>(vertices.size()));
+        if (inserted)
+            vertices.push_back(mesh.Vertices[i]);
+
+        remap[i] = it->second;
+    }
+
+    for (unsigned int& index : mesh.Indices)
+        index = remap[index];
+
+    mesh.Vertices = std::move(vertices);
+}
+
+void MeshOptimizer::OptimizeVertexCache(std::vector<unsigned int>& indices, size_t vertexCount)
+{
+    const size_t triangleCount = indices.size() / 3;
+    if (triangleCount == 0)
+        return;
+
+    // Listas de adyacencia vértice -> triángulos en un único array contiguo
+    std::vector<unsigned int> remaining(vertexCount, 0);
+    for (const unsigned int index : indices)
+        remaining[index]++;
+
+    std::vector<unsigned int> offsets(vertexCount + 1, 0);
+    for (size_t v = 0; v < vertexCount; v++)
+        offsets[v + 1] = offsets[v] + remaining[v];
+
+    std::vector<unsigned int> adjacency(indices.size());
+    {
+        std::vector<unsigned int> fill(offsets.begin(), offsets.end() - 1);
+        for (size_t t = 0; t < triangleCount; t++)
+            for (size_t k = 0; k < 3; k++)
+                adjacency[fill[indices[t * 3 + k]]++] = static_cast<unsigned int>(t);
+    }
+
+    std::vector<int> cachePosition(vertexCount, -1);
+    std::vector<float> vertexScore(vertexCount);
+    for (size_t v = 0; v < vertexCount; v++)
+        vertexScore[v] = ForsythVertexScore(-1, remaining[v]);
+
+    std::vector<float> triangleScore(triangleCount);
+    std::vector<bool> emitted(triangleCount, false);
+    for (size_t t = 0; t < triangleCount; t++)
+        triangleScore[t] = vertexScore[indices[t * 3]] + vertexScore[indices[t * 3 + 1]] + vertexScore[indices[t * 3 + 2]];
+
+    std::vector<unsigned int> result;
+    result.reserve(indices.size());
+
+    std::vector<unsigned int> cache;
+    std::vector<unsigned int> newCache;
+    cache.reserve(ForsythCacheSize + 3);
+    newCache.reserve(ForsythCacheSize + 3);
+
+    auto best = static_cast<long long>(std::max_element(triangleScore.begin(), triangleScore.end()) - triangleScore.begin());
+    size_t cursor = 0;
+
+    while (best >= 0)
+    {
+        const auto triangle = static_cast<size_t>(best);
+        emitted[triangle] = true;
+
+        const unsigned int* tri = &indices[triangle * 3];
+        result.insert(result.end(), tri, tri + 3);
+
+        // El triángulo emitido deja de contar para la valencia de sus vértices
+        for (size_t k = 0; k < 3; k++)
+        {
+            const unsigned int v = tri[k];
+            unsigned int* begin = &adjacency[offsets[v]];
+            unsigned int* end = begin + remaining[v];
+            unsigned int* found = std::find(begin, end, static_cast<unsigned int>(triangle));
+            std::swap(*found, *(end - 1));
+            remaining[v]--;
+        }
+
+        // Los vértices del triángulo pasan al frente de la caché LRU
+        newCache.assign(tri, tri + 3);
+        for (const unsigned int v : cache)
+            if (v != tri[0] && v != tri[1] && v != tri[2])
+                newCache.push_back(v);
+
+        for (size_t i = 0; i < newCache.size(); i++)
+        {
+            const unsigned int v = newCache[i];
+            cachePosition[v] = i < ForsythCacheSize ? static_cast<int>(i) : -1;
+            vertexScore[v] = ForsythVertexScore(cachePosition[v], remaining[v]);
+        }
+
+        // Solo hace falta volver a puntuar los triángulos que tocan la caché
+        best = -1;
+        float bestScore = -1.0f;
+        for (const unsigned int v : newCache)
+        {
+            for (unsigned int i = offsets[v]; i < offsets[v] + remaining[v]; i++)
+            {
+                const unsigned int t = adjacency[i];
+                const float score = vertexScore[indices[t * 3]] + vertexScore[indices[t * 3 + 1]] + vertexScore[indices[t * 3 + 2]];
+                triangleScore[t] = score;
+                if (score > bestScore)
+                {
+                    bestScore = score;
+                    best = t;
+                }
+            }
+        }
+
+        if (newCache.size() > ForsythCacheSize)
+            newCache.resize(ForsythCacheSize);
+        std::swap(cache, newCache);
+
+        // Sin candidatos en caché: se continúa por el primer triángulo pendiente
+        if (best < 0)
+        {
+            while (cursor < triangleCount && emitted[cursor])
+                cursor++;
+            if (cursor < triangleCount)
+                best = static_cast<long long>(cursor);
+        }
+    }
+
+    indices = std::move(result);
+}
+
+void MeshOptimizer::OptimizeOverdraw(std::vector<unsigned int>& indices, const std::vector<MeshVertex>& vertices)
+{
+    const size_t triangleCount = indices.size() / 3;
+    if (triangleCount == 0)
+        return;
+
+    // Se parte el orden optimizado en clusters (Sander et al., "Fast Triangle Reordering"):
+    // primero en cada frontera dura, un triángulo cuyos tres vértices fallan en la caché,
+    // y después en fronteras suaves donde el ACMR acumulado del cluster no supera en más
+    // de OverdrawThreshold al del cluster completo. Así el reordenado apenas empeora el ACMR.
+    std::vector<unsigned int> cacheTime(vertices.size(), 0);
+    unsigned int timestamp = AnalysisCacheSize + 1;
+
+    auto countMisses = [&](size_t triangle)
+    {
+        unsigned int misses = 0;
+        for (size_t k = 0; k < 3; k++)
+        {
+            const unsigned int v = indices[triangle * 3 + k];
+            if (timestamp - cacheTime[v] > AnalysisCacheSize)
+            {
+                cacheTime[v] = timestamp++;
+                misses++;
+            }
+        }
+        return misses;
+    };
+
+    std::vector<unsigned int> hardBoundaries;
+    for (size_t t = 0; t < triangleCount; t++)
+        if (countMisses(t) == 3 || t == 0)
+            hardBoundaries.push_back(static_cast<unsigned int>(t));
+    hardBoundaries.push_back(static_cast<unsigned int>(triangleCount));
+
+    std::vector<unsigned int> clusters;
+    for (size_t h = 0; h + 1 < hardBoundaries.size(); h++)
+    {
+        const unsigned int start = hardBoundaries[h];
+        const unsigned int end = hardBoundaries[h + 1];
+
+        // Se vacía la caché simulada para medir el cluster de forma aislada
+        timestamp += AnalysisCacheSize + 1;
+        unsigned int clusterMisses = 0;
+        for (unsigned int t = start; t < end; t++)
+            clusterMisses += countMisses(t);
+
+        const float clusterThreshold = OverdrawThreshold * static_cast<float>(clusterMisses) / static_cast<float>(end - start);
+
+        clusters.push_back(start);
+        timestamp += AnalysisCacheSize + 1;
+        unsigned int softStart = start;
+        unsigned int misses = 0;
+        for (unsigned int t = start; t < end; t++)
+        {
+            misses += countMisses(t);
+            if (t + 1 < end && static_cast<float>(misses) / static_cast<float>(t - softStart + 1) <= clusterThreshold)
+            {
+                clusters.push_back(t + 1);
+                softStart = t + 1;
+                misses = 0;
+                timestamp += AnalysisCacheSize + 1;
+            }
+        }
+    }
+    clusters.push_back(static_cast<unsigned int>(triangleCount));
+
+    const size_t clusterCount = clusters.size() - 1;
+    if (clusterCount < 2)
+        return;
+
+    // Centroide de la malla ponderado por área
+    glm::vec3 meshCentroid(0.0f);
+    float meshArea = 0.0f;
+    for (size_t t = 0; t < triangleCount; t++)
+    {
+        const glm::vec3& a = vertices[indices[t * 3]].Position;
+        const glm::vec3& b = vertices[indices[t * 3 + 1]].Position;
+        const glm::vec3& c = vertices[indices[t * 3 + 2]].Position;
+        const float area = glm::length(glm::cross(b - a, c - a));
+        meshCentroid += (a + b + c) * (area / 3.0f);
+        meshArea += area;
+    }
+    if (meshArea > 0.0f)
+        meshCentroid /= meshArea;
+
+    // Los clusters más "exteriores" (mirando hacia fuera del centro) se dibujan primero,
+    // de modo que ocluyen a los interiores y reducen el sombreado de píxeles ocultos.
+    std::vector<float> sortKey(clusterCount);
+    for (size_t i = 0; i < clusterCount; i++)
+    {
+        glm::vec3 centroid(0.0f);
+        glm::vec3 normal(0.0f);
+        float area = 0.0f;
+
+        for (unsigned int t = clusters[i]; t < clusters[i + 1]; t++)
+        {
+            const glm::vec3& a = vertices[indices[t * 3]].Position;
+            const glm::vec3& b = vertices[indices[t * 3 + 1]].Position;
+            const glm::vec3& c = vertices[indices[t * 3 + 2]].Position;
+            const glm::vec3 n = glm::cross(b - a, c - a);
+            const float triangleArea = glm::length(n);
+
+            centroid += (a + b + c) * (triangleArea / 3.0f);
+            normal += n;
+            area += triangleArea;
+        }
+
+        if (area > 0.0f)
+            centroid /= area;
+
+        const float normalLength = glm::length(normal);
+        sortKey[i] = normalLength > 0.0f ? glm::dot(centroid - meshCentroid, normal / normalLength) : 0.0f;
+    }
+
+    std::vector<unsigned int> order(clusterCount);
+    std::iota(order.begin(), order.end(), 0u);
+    std::stable_sort(order.begin(), order.end(), [&](unsigned int a, unsigned int b) { return sortKey[a] > sortKey[b]; });
+
+    std::vector<unsigned int> result;
+    result.reserve(indices.size());
+    for (const unsigned int cluster : order)
+        result.insert(result.end(), indices.begin() + clusters[cluster] * 3, indices.begin() + clusters[cluster + 1] * 3);
+
+    indices = std::move(result);
+}
+
+void MeshOptimizer::OptimizeVertexFetch(MeshData& mesh)
+{
+    // Los vértices se reordenan según su primer uso en el índice, así las lecturas
+    // de la GPU avanzan casi secuencialmente por el VBO. Los no referenciados se descartan.
+    constexpr unsigned int unused = ~0u;
+    std::vector<unsigned int> remap(mesh.Vertices.size(), unused);
+
+    std::vector<MeshVertex> vertices;
+    vertices.reserve(mesh.Vertices.size());
+
+    for (unsigned int& index : mesh.Indices)
+    {
+        if (remap[index] == unused)
+        {
+            remap[index] = static_cast<unsigned int>(vertices.size());
+            vertices.push_back(mesh.Vertices[index]);
+        }
+        index = remap[index];
+    }
+
+    mesh.Vertices = std::move(vertices);
+}
+
+VertexCacheStatistics MeshOptimizer::AnalyzeVertexCache(const std::vector<unsigned int>& indices, size_t vertexCount, unsigned int cacheSize)
+{
+    VertexCacheStatistics statistics;
+    if (indices.empty() || vertexCount == 0)
+        return statistics;
+
+    // Simulación de una caché FIFO mediante marcas de tiempo
+    std::vector<unsigned int> cacheTime(vertexCount, 0);
+    unsigned int timestamp = cacheSize + 1;
+    size_t uniqueVertices = 0;
+
+    std::vector<bool> seen(vertexCount, false);
+    for (const unsigned int index : indices)
+    {
+        if (timestamp - cacheTime[index] > cacheSize)
+        {
+            cacheTime[index] = timestamp++;
+            statistics.Misses++;
+        }
+
+        if (!seen[index])
+        {
+            seen[index] = true;
+            uniqueVertices++;
+        }
+    }
+
+    statistics.ACMR = static_cast<float>(statistics.Misses) / static_cast<float>(indices.size() / 3);
+    statistics.ATVR = static_cast<float>(statistics.Misses) / static_cast<float>(uniqueVertices);
+    return statistics;
+}
@@ -0,0 +1,41 @@
+#pragma once
+
+#include <cstddef>
+#include <vector>
+
+#include "Mesh.h"
+
+struct VertexCacheStatistics
+{
+    unsigned int Misses{};
+    float ACMR{};
+    float ATVR{};
+};
+
+// Pipeline de optimización que se aplica a toda malla importada:
+// deduplicado -> caché post-transformación -> overdraw -> cadena de LODs -> localidad de lectura de vértices.
+class MeshOptimizer
+{
+public:
+    // Tamaño de la caché FIFO simulada para las estadísticas (típico en GPUs actuales)
+    static constexpr unsigned int AnalysisCacheSize = 16;
+
+    // Cadena de LODs: cada nivel apunta a la mitad de triángulos del anterior, sin superar
+    // un error acumulado de LODMaxError veces el radio de la malla.
+    static constexpr unsigned int MaxLODCount = 6;
+    static constexpr float LODReduction = 0.5f;
+    static constexpr float LODMaxError = 0.05f;
+
+    static void Optimize(MeshData& mesh);
+
+    static void ComputeBounds(MeshData& mesh);
+    static void ComputeUVDensity(MeshData& mesh);
+    static void GenerateLODs(MeshData& mesh);
+
+    static void DeduplicateVertices(MeshData& mesh);
+    static void OptimizeVertexCache(std::vector<unsigned int>& indices, size_t vertexCount);
+    static void OptimizeOverdraw(std::vector<unsigned int>& indices, const std::vector<MeshVertex>& vertices);
+    static void OptimizeVertexFetch(MeshData& mesh);
+
+    static VertexCacheStatistics AnalyzeVertexCache(const std::vector<unsigned int>& indices, size_t vertexCount, unsigned int cacheSize = AnalysisCacheSize);
+};
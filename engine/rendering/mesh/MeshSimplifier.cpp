@@ -0,0 +1,315 @@
+#include "MeshSimplifier.h"
+#include "Profiler.h"
+
+#include <algorithm>
+#include <cmath>
+#include <unordered_map>
+
+namespace
+{
+    // Peso extra de los planos perpendiculares a los bordes abiertos, para que no se encojan
+    constexpr float BorderWeight = 10.0f;
+
+    enum class VertexKind : unsigned char
+    {
+        Manifold, // Interior: puede colapsar hacia cualquier vecino
+        Border,   // Borde abierto: solo colapsa a lo largo del propio borde
+        Locked    // Costura de atributos o topología compleja: no se mueve
+    };
+
+    struct Quadric
+    {
+        // Matriz simétrica A (6 términos), vector b (3) y constante c, más el peso acumulado
+        float a00{}, a11{}, a22{}, a01{}, a02{}, a12{};
+        float b0{}, b1{}, b2{};
+        float c{};
+        float w{};
+
+        static Quadric FromPlane(const glm::vec3& n, float d, float weight)
+        {
+            Quadric q;
+            q.a00 = n.x * n.x * weight; q.a11 = n.y * n.y * weight; q.a22 = n.z * n.z * weight;
+            q.a01 = n.x * n.y * weight; q.a02 = n.x * n.z * weight; q.a12 = n.y * n.z * weight;
+            q.b0 = n.x * d * weight; q.b1 = n.y * d * weight; q.b2 = n.z * d * weight;
+            q.c = d * d * weight;
+            q.w = weight;
+            return q;
+        }
+
+        Quadric& operator+=(const Quadric& o)
+        {
+            a00 += o.a00; a11 += o.a11; a22 += o.a22;
+            a01 += o.a01; a02 += o.a02; a12 += o.a12;
+            b0 += o.b0; b1 += o.b1; b2 += o.b2;
+            c += o.c;
+            w += o.w;
+            return *this;
+        }
+
+        // Distancia al cuadrado media (ponderada) de 'p' a los planos acumulados
+        float Error(const glm::vec3& p) const
+        {
+            const float rx = a00 * p.x + a01 * p.y + a02 * p.z + b0;
+            const float ry = a01 * p.x + a11 * p.y + a12 * p.z + b1;
+            const float rz = a02 * p.x + a12 * p.y + a22 * p.z + b2;
+            const float error = p.x * rx + p.y * ry + p.z * rz + b0 * p.x + b1 * p.y + b2 * p.z + c;
+            return w > 0.0f ? std::fabs(error) / w : 0.0f;
+        }
+    };
+
+    struct Collapse
+    {
+        unsigned int From;
+        unsigned int To;
+        float Cost;
+    };
+
+    unsigned long long EdgeKey(unsigned int a, unsigned int b)
+    {
+        return (static_cast<unsigned long long>(a) << 32) | b;
+    }
+
+    glm::vec3 TriangleNormal(const glm::vec3& a, const glm::vec3& b, const glm::vec3& c)
+    {
+        return glm::cross(b - a, c - a);
+    }
+}
+
+std::vector<unsigned int> MeshSimplifier::Simplify(const std::vector<MeshVertex>& vertices, const std::vector<unsigned int>& indices,
+                                                   size_t targetIndexCount, float targetError, float* outError)
+{
+    PROFILE_SCOPE("MeshSimplifier::Simplify");
+
+    std::vector<unsigned int> result = indices;
+    float resultError = 0.0f;
+
+    const size_t vertexCount = vertices.size();
+    if (result.size() <= targetIndexCount || vertexCount == 0)
+    {
+        if (outError)
+            *outError = 0.0f;
+        return result;
+    }
+
+    // Vértices con la misma posición (costuras de UV/normal) se agrupan; la topología se
+    // analiza sobre esa versión soldada para no abrir grietas en las costuras.
+    std::vector<unsigned int> weld(vertexCount);
+    std::vector<unsigned int> groupSize(vertexCount, 0);
+    {
+        struct PositionHasher
+        {
+            size_t operator()(const glm::vec3& p) const
+            {
+                const auto hx = std::hash<float>()(p.x);
+                const auto hy = std::hash<float>()(p.y);
+                const auto hz = std::hash<float>()(p.z);
+                return hx ^ (hy * 31) ^ (hz * 131);
+            }
+        };
+
+        std::unordered_map<glm::vec3, unsigned int, PositionHasher> firstByPosition;
+        firstByPosition.reserve(vertexCount);
+        for (unsigned int v = 0; v < vertexCount; v++)
+        {
+            weld[v] = firstByPosition.emplace(vertices[v].Position, v).first->second;
+            groupSize[weld[v]]++;
+        }
+    }
+
+    // Aristas orientadas soldadas; una arista sin su opuesta es un borde abierto
+    std::unordered_map<unsigned long long, unsigned int> edgeCount;
+    edgeCount.reserve(result.size());
+    for (size_t i = 0; i < result.size(); i += 3)
+        for (size_t k = 0; k < 3; k++)
+            edgeCount[EdgeKey(weld[result[i + k]], weld[result[i + (k + 1) % 3]])]++;
+
+    std::vector<VertexKind> kind(vertexCount, VertexKind::Manifold);
+    std::vector<unsigned int> borderEdges(vertexCount, 0);
+    for (const auto& [key, count] : edgeCount)
+    {
+        const auto a = static_cast<unsigned int>(key >> 32);
+        const auto b = static_cast<unsigned int>(key & 0xFFFFFFFFu);
+        const auto opposite = edgeCount.find(EdgeKey(b, a));
+        const unsigned int oppositeCount = opposite == edgeCount.end() ? 0 : opposite->second;
+
+        if (count > 1 || oppositeCount > 1)
+        {
+            kind[a] = kind[b] = VertexKind::Locked;
+        }
+        else if (oppositeCount == 0)
+        {
+            borderEdges[a]++;
+            borderEdges[b]++;
+        }
+    }
+
+    for (unsigned int v = 0; v < vertexCount; v++)
+    {
+        const unsigned int w = weld[v];
+        if (groupSize[w] > 1 || kind[w] == VertexKind::Locked || borderEdges[w] > 2)
+            kind[v] = VertexKind::Locked;
+        else if (borderEdges[w] > 0)
+            kind[v] = VertexKind::Border;
+    }
+
+    // Cuádricas iniciales: planos de los triángulos ponderados por área y planos de borde
+    std::vector<Quadric> quadrics(vertexCount);
+    for (size_t i = 0; i < result.size(); i += 3)
+    {
+        const unsigned int tri[3] = { result[i], result[i + 1], result[i + 2] };
+        const glm::vec3& p0 = vertices[tri[0]].Position;
+        const glm::vec3 normal = TriangleNormal(p0, vertices[tri[1]].Position, vertices[tri[2]].Position);
+        const float area = glm::length(normal);
+        if (area <= 0.0f)
+            continue;
+
+        const glm::vec3 n = normal / area;
+        const Quadric plane = Quadric::FromPlane(n, -glm::dot(n, p0), area);
+        for (const unsigned int v : tri)
+            quadrics[v] += plane;
+
+        for (size_t k = 0; k < 3; k++)
+        {
+            const unsigned int a = tri[k];
+            const unsigned int b = tri[(k + 1) % 3];
+            if (edgeCount.count(EdgeKey(weld[b], weld[a])) != 0)
+                continue;
+
+            const glm::vec3 edge = vertices[b].Position - vertices[a].Position;
+            const float edgeLength = glm::length(edge);
+            if (edgeLength <= 0.0f)
+                continue;
+
+            const glm::vec3 borderNormal = glm::normalize(glm::cross(edge, n));
+            const Quadric border = Quadric::FromPlane(borderNormal, -glm::dot(borderNormal, vertices[a].Position), edgeLength * edgeLength * BorderWeight);
+            quadrics[a] += border;
+            quadrics[b] += border;
+        }
+    }
+
+    const float maxCost = targetError * targetError;
+    std::vector<unsigned int> remap(vertexCount);
+    std::vector<bool> touched(vertexCount);
+    std::vector<Collapse> collapses;
+    std::vector<unsigned int> triangleOffsets(vertexCount + 1);
+    std::vector<unsigned int> vertexTriangles;
+
+    // Pasadas sucesivas: se colapsan en lote las aristas más baratas que no comparten vértices
+    while (result.size() > targetIndexCount)
+    {
+        const size_t triangleCount = result.size() / 3;
+
+        std::fill(triangleOffsets.begin(), triangleOffsets.end(), 0u);
+        for (const unsigned int index : result)
+            triangleOffsets[index + 1]++;
+        for (size_t v = 0; v < vertexCount; v++)
+            triangleOffsets[v + 1] += triangleOffsets[v];
+
+        vertexTriangles.resize(result.size());
+        {
+            std::vector<unsigned int> fill(triangleOffsets.begin(), triangleOffsets.end() - 1);
+            for (size_t t = 0; t < triangleCount; t++)
+                for (size_t k = 0; k < 3; k++)
+                    vertexTriangles[fill[result[t * 3 + k]]++] = static_cast<unsigned int>(t);
+        }
+
+        collapses.clear();
+        for (size_t t = 0; t < triangleCount; t++)
+        {
+            for (size_t k = 0; k < 3; k++)
+            {
+                const unsigned int from = result[t * 3 + k];
+                const unsigned int to = result[t * 3 + (k + 1) % 3];
+
+                if (kind[from] == VertexKind::Locked)
+                    continue;
+                if (kind[from] == VertexKind::Border && (kind[to] == VertexKind::Manifold || edgeCount.count(EdgeKey(weld[to], weld[from])) != 0))
+                    continue;
+
+                Quadric q = quadrics[from];
+                q += quadrics[to];
+                const float cost = q.Error(vertices[to].Position);
+                if (cost <= maxCost)
+                    collapses.push_back({ from, to, cost });
+            }
+        }
+
+        if (collapses.empty())
+            break;
+
+        std::sort(collapses.begin(), collapses.end(), [](const Collapse& a, const Collapse& b) { return a.Cost < b.Cost; });
+
+        // Cada colapso elimina unos dos triángulos: se limita el lote para no pasarse del objetivo
+        const size_t collapseLimit = (result.size() - targetIndexCount) / 6 + 1;
+        size_t applied = 0;
+
+        for (unsigned int v = 0; v < vertexCount; v++)
+            remap[v] = v;
+        std::fill(touched.begin(), touched.end(), false);
+
+        for (const Collapse& collapse : collapses)
+        {
+            if (applied >= collapseLimit)
+                break;
+            if (touched[collapse.From] || touched[collapse.To])
+                continue;
+
+            // Se rechaza el colapso si invierte la orientación de algún triángulo vecino
+            bool flips = false;
+            for (unsigned int i = triangleOffsets[collapse.From]; i < triangleOffsets[collapse.From + 1] && !flips; i++)
+            {
+                const unsigned int* tri = &result[vertexTriangles[i] * 3];
+                if (tri[0] == collapse.To || tri[1] == collapse.To || tri[2] == collapse.To)
+                    continue;
+
+                glm::vec3 p[3];
+                for (size_t k = 0; k < 3; k++)
+                    p[k] = vertices[tri[k]].Position;
+
+                const glm::vec3 before = TriangleNormal(p[0], p[1], p[2]);
+                for (size_t k = 0; k < 3; k++)
+                    if (tri[k] == collapse.From)
+                        p[k] = vertices[collapse.To].Position;
+
+                const glm::vec3 after = TriangleNormal(p[0], p[1], p[2]);
+                flips = glm::dot(before, after) <= 0.0f;
+            }
+            if (flips)
+                continue;
+
+            // Los vecinos de 'From' quedan bloqueados en esta pasada, su entorno va a cambiar
+            for (unsigned int i = triangleOffsets[collapse.From]; i < triangleOffsets[collapse.From + 1]; i++)
+                for (size_t k = 0; k < 3; k++)
+                    touched[result[vertexTriangles[i] * 3 + k]] = true;
+
+            remap[collapse.From] = collapse.To;
+            quadrics[collapse.To] += quadrics[collapse.From];
+            resultError = std::max(resultError, collapse.Cost);
+            applied++;
+        }
+
+        if (applied == 0)
+            break;
+
+        // Reescribe el índice y descarta los triángulos degenerados
+        size_t write = 0;
+        for (size_t i = 0; i < result.size(); i += 3)
+        {
+            const unsigned int a = remap[result[i]];
+            const unsigned int b = remap[result[i + 1]];
+            const unsigned int c = remap[result[i + 2]];
+            if (a == b || b == c || a == c)
+                continue;
+
+            result[write++] = a;
+            result[write++] = b;
+            result[write++] = c;
+        }
+        result.resize(write);
+    }
+
+    if (outError)
+        *outError = std::sqrt(resultError);
+
+    return result;
+}
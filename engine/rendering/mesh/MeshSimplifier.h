@@ -0,0 +1,18 @@
+#pragma once
+
+#include <cstddef>
+#include <vector>
+
+#include "Mesh.h"
+
+// Simplificador por colapso de aristas con métricas cuádricas (Garland-Heckbert).
+// Solo reescribe índices: los vértices supervivientes siguen siendo los originales,
+// así todos los LODs comparten el mismo VBO.
+class MeshSimplifier
+{
+public:
+    // Reduce 'indices' hasta 'targetIndexCount' sin superar 'targetError' (distancia en
+    // unidades del objeto). Devuelve el nuevo índice y el error alcanzado en 'outError'.
+    static std::vector<unsigned int> Simplify(const std::vector<MeshVertex>& vertices, const std::vector<unsigned int>& indices,
+                                              size_t targetIndexCount, float targetError, float* outError = nullptr);
+};
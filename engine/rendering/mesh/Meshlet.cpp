@@ -0,0 +1,211 @@
+#include "Meshlet.h"
+#include "Mesh.h"
+#include "Profiler.h"
+
+#include <algorithm>
+#include <cmath>
+
+MeshletCullStats& MeshletCullStats::operator+=(const MeshletCullStats& other)
+{
+    Total += other.Total;
+    Visible += other.Visible;
+    FrustumCulled += other.FrustumCulled;
+    BackfaceCulled += other.BackfaceCulled;
+    Ranges += other.Ranges;
+    return *this;
+}
+
+void MeshletDrawList::Clear()
+{
+    // Se conserva la capacidad de los vectores para no reservar memoria cada frame
+    Counts.clear();
+    Offsets.clear();
+    Stats = MeshletCullStats();
+}
+
+namespace
+{
+    void ComputeMeshletBounds(Meshlet& meshlet, const std::vector<MeshVertex>& vertices, const std::vector<unsigned int>& indices)
+    {
+        const unsigned int begin = meshlet.IndexOffset;
+        const unsigned int end = meshlet.IndexOffset + meshlet.IndexCount;
+
+        glm::vec3 minimum = vertices[indices[begin]].Position;
+        glm::vec3 maximum = minimum;
+        for (unsigned int i = begin; i < end; i++)
+        {
+            minimum = glm::min(minimum, vertices[indices[i]].Position);
+            maximum = glm::max(maximum, vertices[indices[i]].Position);
+        }
+
+        meshlet.Center = (minimum + maximum) * 0.5f;
+        meshlet.Radius = 0.0f;
+        for (unsigned int i = begin; i < end; i++)
+            meshlet.Radius = std::max(meshlet.Radius, glm::distance(meshlet.Center, vertices[indices[i]].Position));
+
+        // Eje del cono: media de las normales unitarias de los triángulos
+        glm::vec3 axis(0.0f);
+        std::vector<glm::vec3> normals;
+        normals.reserve(meshlet.IndexCount / 3);
+        for (unsigned int i = begin; i < end; i += 3)
+        {
+            const glm::vec3& a = vertices[indices[i]].Position;
+            const glm::vec3 n = glm::cross(vertices[indices[i + 1]].Position - a, vertices[indices[i + 2]].Position - a);
+            const float length = glm::length(n);
+            normals.push_back(length > 0.0f ? n / length : glm::vec3(0.0f));
+            axis += normals.back();
+        }
+
+        const float axisLength = glm::length(axis);
+        if (axisLength <= 0.0f)
+            return;
+        axis /= axisLength;
+
+        float minDot = 1.0f;
+        for (const glm::vec3& n : normals)
+            minDot = std::min(minDot, glm::dot(axis, n));
+
+        // Normales demasiado dispersas: el meshlet siempre tiene alguna cara visible
+        if (minDot <= 0.1f)
+            return;
+
+        // Vértice del cono: punto del eje por detrás de todos los planos de los triángulos
+        float maxT = 0.0f;
+        for (unsigned int i = begin, t = 0; i < end; i += 3, t++)
+        {
+            const float dn = glm::dot(axis, normals[t]);
+            if (dn <= 0.0f)
+                continue;
+            const float dc = glm::dot(meshlet.Center - vertices[indices[i]].Position, normals[t]);
+            maxT = std::max(maxT, dc / dn);
+        }
+
+        meshlet.ConeAxis = axis;
+        meshlet.ConeApex = meshlet.Center - axis * maxT;
+        meshlet.ConeCutoff = std::sqrt(1.0f - minDot * minDot);
+    }
+}
+
+std::vector<Meshlet> MeshletBuilder::Build(const std::vector<MeshVertex>& vertices, const std::vector<unsigned int>& indices,
+                                           unsigned int indexOffset, unsigned int indexCount)
+{
+    PROFILE_SCOPE("MeshletBuilder::Build");
+
+    std::vector<Meshlet> meshlets;
+
+    // Marca por vértice del último meshlet que lo usó, para contar vértices únicos en O(1)
+    std::vector<unsigned int> lastMeshlet(vertices.size(), ~0u);
+
+    Meshlet current;
+    current.IndexOffset = indexOffset;
+
+    auto flush = [&]()
+    {
+        if (current.IndexCount == 0)
+            return;
+        ComputeMeshletBounds(current, vertices, indices);
+        meshlets.push_back(current);
+
+        const unsigned int nextOffset = current.IndexOffset + current.IndexCount;
+        current = Meshlet();
+        current.IndexOffset = nextOffset;
+    };
+
+    for (unsigned int i = indexOffset; i + 2 < indexOffset + indexCount; i += 3)
+    {
+        const auto id = static_cast<unsigned int>(meshlets.size());
+
+        unsigned int newVertices = 0;
+        for (unsigned int k = 0; k < 3; k++)
+            if (lastMeshlet[indices[i + k]] != id)
+                newVertices++;
+
+        if (current.VertexCount + newVertices > MaxVertices || current.IndexCount / 3 + 1 > MaxTriangles)
+            flush();
+
+        const auto target = static_cast<unsigned int>(meshlets.size());
+        for (unsigned int k = 0; k < 3; k++)
+        {
+            if (lastMeshlet[indices[i + k]] != target)
+            {
+                lastMeshlet[indices[i + k]] = target;
+                current.VertexCount++;
+            }
+        }
+        current.IndexCount += 3;
+    }
+    flush();
+
+    return meshlets;
+}
+
+void MeshletCuller::Cull(const std::vector<Meshlet>& meshlets, const glm::mat4& model, const glm::mat4& viewProjection,
+                         const glm::vec3& cameraPosition, MeshletDrawList& outDrawList)
+{
+    PROFILE_SCOPE("MeshletCuller::Cull");
+
+    outDrawList.Clear();
+    outDrawList.Stats.Total = static_cast<unsigned int>(meshlets.size());
+
+    // Planos del frustum (Gribb-Hartmann) en espacio del objeto, normalizados
+    const glm::mat4 clip = viewProjection * model;
+    glm::vec4 planes[6];
+    for (int i = 0; i < 3; i++)
+    {
+        for (int c = 0; c < 4; c++)
+        {
+            planes[i * 2][c] = clip[c][3] + clip[c][i];
+            planes[i * 2 + 1][c] = clip[c][3] - clip[c][i];
+        }
+    }
+    for (glm::vec4& plane : planes)
+        plane /= glm::length(glm::vec3(plane));
+
+    const glm::vec3 camera = glm::vec3(glm::inverse(model) * glm::vec4(cameraPosition, 1.0f));
+
+    unsigned int rangeEnd = ~0u;
+    for (const Meshlet& meshlet : meshlets)
+    {
+        bool outside = false;
+        for (const glm::vec4& plane : planes)
+        {
+            if (glm::dot(glm::vec3(plane), meshlet.Center) + plane.w < -meshlet.Radius)
+            {
+                outside = true;
+                break;
+            }
+        }
+        if (outside)
+        {
+            outDrawList.Stats.FrustumCulled++;
+            continue;
+        }
+
+        if (meshlet.ConeCutoff < 1.0f)
+        {
+            const glm::vec3 toApex = meshlet.ConeApex - camera;
+            const float distance = glm::length(toApex);
+            if (distance > 0.0f && glm::dot(toApex, meshlet.ConeAxis) >= meshlet.ConeCutoff * distance)
+            {
+                outDrawList.Stats.BackfaceCulled++;
+                continue;
+            }
+        }
+
+        outDrawList.Stats.Visible++;
+
+        // Meshlets consecutivos en el índice se fusionan en un único rango
+        if (meshlet.IndexOffset == rangeEnd)
+        {
+            outDrawList.Counts.back() += static_cast<GLsizei>(meshlet.IndexCount);
+        }
+        else
+        {
+            outDrawList.Counts.push_back(static_cast<GLsizei>(meshlet.IndexCount));
+            outDrawList.Offsets.push_back(reinterpret_cast<const void*>(static_cast<size_t>(meshlet.IndexOffset) * sizeof(unsigned int)));
+        }
+        rangeEnd = meshlet.IndexOffset + meshlet.IndexCount;
+    }
+
+    outDrawList.Stats.Ranges = static_cast<unsigned int>(outDrawList.Counts.size());
+}
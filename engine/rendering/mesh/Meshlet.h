@@ -0,0 +1,70 @@
+#pragma once
+
+#include <glad/glad.h>
+#include <glm/glm.hpp>
+#include <vector>
+
+struct MeshVertex;
+
+// Grupo pequeño de triángulos contiguos en el índice del LOD 0, con volúmenes
+// precalculados para descartarlo en CPU antes de dibujar.
+struct Meshlet
+{
+    unsigned int IndexOffset{};
+    unsigned int IndexCount{};
+    unsigned int VertexCount{};
+
+    // Esfera envolvente en espacio del objeto
+    glm::vec3 Center{0.0f};
+    float Radius{};
+
+    // Cono de normales: si la cámara queda dentro del cono trasero, todo el meshlet
+    // está de espaldas. Un ConeCutoff >= 1 desactiva la prueba (normales muy dispersas).
+    glm::vec3 ConeApex{0.0f};
+    glm::vec3 ConeAxis{0.0f};
+    float ConeCutoff = 1.0f;
+};
+
+struct MeshletCullStats
+{
+    unsigned int Total{};
+    unsigned int Visible{};
+    unsigned int FrustumCulled{};
+    unsigned int BackfaceCulled{};
+    // Rangos tras fusionar meshlets contiguos, es decir, sub-draws de glMultiDrawElements
+    unsigned int Ranges{};
+
+    MeshletCullStats& operator+=(const MeshletCullStats& other);
+};
+
+// Rangos de índice supervivientes, listos para glMultiDrawElements
+struct MeshletDrawList
+{
+    std::vector<GLsizei> Counts;
+    std::vector<const void*> Offsets;
+    MeshletCullStats Stats;
+
+    void Clear();
+};
+
+class MeshletBuilder
+{
+public:
+    static constexpr unsigned int MaxVertices = 64;
+    static constexpr unsigned int MaxTriangles = 124;
+
+    // Parte 'indexCount' índices a partir de 'indexOffset' en meshlets consecutivos,
+    // respetando el orden ya optimizado para la caché.
+    static std::vector<Meshlet> Build(const std::vector<MeshVertex>& vertices, const std::vector<unsigned int>& indices,
+                                      unsigned int indexOffset, unsigned int indexCount);
+};
+
+class MeshletCuller
+{
+public:
+    // Descarta meshlets fuera del frustum o de espaldas y agrupa los supervivientes contiguos.
+    // Se trabaja en espacio del objeto: planos extraídos de 'viewProjection * model' y cámara
+    // llevada al objeto con la inversa de 'model'.
+    static void Cull(const std::vector<Meshlet>& meshlets, const glm::mat4& model, const glm::mat4& viewProjection,
+                     const glm::vec3& cameraPosition, MeshletDrawList& outDrawList);
+};
@@ -2,9 +2,16 @@
 out vec4 FragColor;
 
 in vec3 ourColor;
+in vec2 TexCoord;
 uniform vec3 color;
 
+uniform sampler2D diffuseTexture;
+uniform bool useTexture;
+
 void main()
 {
-    FragColor = vec4(ourColor, 1.0) * vec4(color, 1.0);
+    vec4 base = vec4(ourColor, 1.0) * vec4(color, 1.0);
+    if (useTexture)
+        base *= texture(diffuseTexture, TexCoord);
+    FragColor = base;
 }
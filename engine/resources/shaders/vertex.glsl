@@ -1,15 +1,20 @@
 #version 330 core
 layout(location = 0) in vec3 aPos;
 layout(location = 1) in vec3 aColor;
+layout(location = 3) in vec2 aTexCoord;
 
 out vec3 ourColor;
+out vec2 TexCoord;
 
 uniform mat4 model;
 uniform mat4 view;
 uniform mat4 projection;
+// UV de la malla a partir de las del vértice: xy escala, zw desplazamiento (Mesh::GetTexCoordTransform)
+uniform vec4 texCoordTransform;
 
 void main()
 {
     gl_Position = projection * view * model * vec4(aPos, 1.0);
     ourColor = aColor;
+    TexCoord = aTexCoord * texCoordTransform.xy + texCoordTransform.zw;
 }
@@ -5,6 +5,16 @@ glm::mat4 Camera::GetViewMatrix() const
     return glm::lookAt(Position, Position + Front, Up);
 }
 
+glm::mat4 Camera::GetProjectionMatrix(float aspectRatio) const
+{
+    return glm::perspective(glm::radians(FieldOfView), aspectRatio, NearPlane, FarPlane);
+}
+
+float Camera::GetPixelsPerUnit(float viewportHeight) const
+{
+    return viewportHeight / (2.0f * std::tan(glm::radians(FieldOfView) * 0.5f));
+}
+
 void Camera::ProcessKeyboard(CameraMovement direction, float deltaTime)
 {
     float velocity = MovementSpeed * deltaTime;
@@ -35,6 +35,10 @@ public:
     float MovementSpeed;
     float MouseSensitivity;
     float Zoom;
+    // Projection
+    float FieldOfView = ZOOM;
+    float NearPlane = 0.1f;
+    float FarPlane = 100.0f;
 
     Camera(glm::vec3 position = glm::vec3(0.0f, 0.0f, 0.0f), glm::vec3 up = glm::vec3(0.0f, 1.0f, 0.0f), float yaw = YAW, float pitch = PITCH) : Front(glm::vec3(0.0f, 0.0f, -1.0f)), MovementSpeed(SPEED), MouseSensitivity(SENSITIVITY), Zoom(ZOOM)
     {
@@ -54,6 +58,9 @@ public:
     }
 
     glm::mat4 GetViewMatrix() const;
+    glm::mat4 GetProjectionMatrix(float aspectRatio) const;
+    // Pixels covered by one world unit at distance 1, used for screen-space error
+    float GetPixelsPerUnit(float viewportHeight) const;
     glm::mat4 LookAt(glm::vec3 position, glm::vec3 direction, glm::vec3 up);
 
     void ProcessKeyboard(CameraMovement direction, float deltaTime);
@@ -25,11 +25,22 @@ Cube::Cube(const std::string& cubeName)
     name = cubeName;
 }
 
-void Cube::Draw() const
+void Cube::Draw(float alpha)
 {
-    *m_ModelMatrix = translate(*m_ModelMatrix, *m_Position);
-    if(length(*m_Rotation) != 0)
-        *m_ModelMatrix = rotate(*m_ModelMatrix, glm::radians(length(*m_Rotation)), normalize(*m_Rotation));
-    *m_ModelMatrix = scale(*m_ModelMatrix, *m_Scale);
+    const glm::vec3 position = mix(m_PreviousPosition, m_Position, alpha);
+    const glm::vec3 rotation = mix(m_PreviousRotation, m_Rotation, alpha);
+    const glm::vec3 scaling = mix(m_PreviousScale, m_Scale, alpha);
+
+    m_ModelMatrix = translate(m_ModelMatrix, position);
+    if(length(rotation) != 0)
+        m_ModelMatrix = rotate(m_ModelMatrix, glm::radians(length(rotation)), normalize(rotation));
+    m_ModelMatrix = scale(m_ModelMatrix, scaling);
+}
+
+void Cube::SavePreviousTransform()
+{
+    m_PreviousPosition = m_Position;
+    m_PreviousRotation = m_Rotation;
+    m_PreviousScale = m_Scale;
 }
 
@@ -11,19 +11,25 @@ class Cube{
 public:
   Cube(const std::string& cubeName);
 
-  void Draw() const;
+  // Matriz de modelo interpolada entre el paso de simulación anterior (alpha 0) y el actual (alpha 1)
+  void Draw(float alpha = 1.0f);
+  // Guarda la transformación actual como la del paso anterior; se llama al empezar cada paso fijo
+  void SavePreviousTransform();
 
-  void SetPosition(const glm::vec3& newPosition){ *m_Position = newPosition; }
-  glm::vec3* GetPosition() const{ return m_Position; }
+  void SetPosition(const glm::vec3& newPosition){ m_Position = newPosition; }
+  glm::vec3* GetPosition(){ return &m_Position; }
 
-  void SetRotation(const glm::vec3& newRotation){ *m_Rotation = newRotation; }
-  glm::vec3* GetRotation() const{ return m_Rotation; }
+  void SetRotation(const glm::vec3& newRotation){ m_Rotation = newRotation; }
+  glm::vec3* GetRotation(){ return &m_Rotation; }
 
-  void SetScale(const glm::vec3& newScale){ *m_Scale = newScale; }
-  glm::vec3* GetScale() const{ return m_Scale; }
+  void SetScale(const glm::vec3& newScale){ m_Scale = newScale; }
+  glm::vec3* GetScale(){ return &m_Scale; }
 
-  glm::mat4* GetModelMatrix() const{ return m_ModelMatrix; }
-  glm::vec3* GetShaderColor() const{ return m_ShaderColor; }
+  glm::mat4* GetModelMatrix(){ return &m_ModelMatrix; }
+  glm::vec3* GetShaderColor(){ return &m_ShaderColor; }
+
+  void SetLOD(unsigned int lod){ m_LOD = lod; }
+  unsigned int GetLOD() const{ return m_LOD; }
   static std::vector<float>& GetVertices() { return s_Vertices; }
   static std::vector<unsigned int>& GetIndices() { return s_Indices; }
 
@@ -33,10 +39,16 @@ private:
   static std::vector<float> s_Vertices;
   static std::vector<unsigned int> s_Indices;
 
-  glm::vec3* m_Position = new glm::vec3{0.0f, 0.0f, 0.0f};
-  glm::vec3* m_Rotation = new glm::vec3{0.0f, 0.0f, 0.0f};
-  glm::vec3* m_Scale = new glm::vec3{1.0f, 1.0f, 1.0f};
+  glm::vec3 m_Position{0.0f, 0.0f, 0.0f};
+  glm::vec3 m_Rotation{0.0f, 0.0f, 0.0f};
+  glm::vec3 m_Scale{1.0f, 1.0f, 1.0f};
+
+  glm::vec3 m_PreviousPosition{0.0f, 0.0f, 0.0f};
+  glm::vec3 m_PreviousRotation{0.0f, 0.0f, 0.0f};
+  glm::vec3 m_PreviousScale{1.0f, 1.0f, 1.0f};
+
+  glm::mat4 m_ModelMatrix{1.0f};
+  glm::vec3 m_ShaderColor{1.0f, 1.0f, 1.0f};
 
-  glm::mat4* m_ModelMatrix = new glm::mat4(1.0f);
-  glm::vec3* m_ShaderColor = new glm::vec3(1.0f, 1.0f, 1.0f);
+  unsigned int m_LOD = 0;
 };